@@ -0,0 +1,21 @@
+﻿
+#pragma once
+
+namespace principia {
+namespace base {
+namespace internal_cpuid {
+
+// Returns true if the processor supports the FMA3 instructions and the
+// operating system saves the AVX registers, i.e., if the instructions
+// |vfmadd...sd| and friends may be executed.  The result is determined using
+// the CPUID instruction.
+bool CPUSupportsFMA();
+
+}  // namespace internal_cpuid
+
+using internal_cpuid::CPUSupportsFMA;
+
+}  // namespace base
+}  // namespace principia
+
+#include "base/cpuid_body.hpp"
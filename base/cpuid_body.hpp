@@ -0,0 +1,47 @@
+﻿
+#pragma once
+
+#include "base/cpuid.hpp"
+
+#include <cstdint>
+
+#include "base/macros.hpp"
+
+// Must come after macros.hpp, which defines |PRINCIPIA_COMPILER_MSVC|.
+#if PRINCIPIA_COMPILER_MSVC
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace principia {
+namespace base {
+namespace internal_cpuid {
+
+inline bool CPUSupportsFMA() {
+#if PRINCIPIA_COMPILER_MSVC
+  // See the Intel® 64 and IA-32 Architectures Software Developer’s Manual,
+  // Volume 2A, CPUID—CPU Identification, and the Intel® 64 and IA-32
+  // Architectures Optimization Reference Manual, section 11.14.
+  constexpr int fma = 1 << 12;
+  constexpr int osxsave = 1 << 27;
+  constexpr int avx = 1 << 28;
+  int registers[4];  // EAX, EBX, ECX, EDX.
+  __cpuid(registers, 1);
+  int const ecx = registers[2];
+  if ((ecx & (fma | osxsave | avx)) != (fma | osxsave | avx)) {
+    return false;
+  }
+  // The operating system must save the XMM and YMM states.
+  std::uint64_t const xcr0 = _xgetbv(0);
+  return (xcr0 & 0b110) == 0b110;
+#else
+  // This checks the same bits as above.  Initialization is needed because we
+  // may be called during dynamic initialization.
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("fma");
+#endif
+}
+
+}  // namespace internal_cpuid
+}  // namespace base
+}  // namespace principia
@@ -4,7 +4,7 @@
 #include <cstdint>
 #include <memory>
 
-#include "base/thread_pool.hpp"
+#include "base/work_stealing_executor.hpp"
 
 namespace principia {
 namespace base {
@@ -17,7 +17,7 @@ class Graveyard {
   void Bury(std::unique_ptr<T> t);
 
  private:
-  ThreadPool<void> gravedigger_;
+  WorkStealingExecutor gravedigger_;
 };
 
 }  // namespace base
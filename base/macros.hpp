@@ -126,6 +126,24 @@ inline void noreturn() { std::exit(0); }
 // 64-bit architectures.
 #define PRINCIPIA_USE_SSE3_INTRINSICS !_DEBUG
 
+// AVX and FMA are only used if the compiler targets a processor that has them.
+// MSVC doesn't define __FMA__, but all the processors with AVX2 have FMA.  The
+// released binaries don't target such processors, so only the SSE2 code ships.
+// The AVX and FMA code may be built and tested on Linux and macOS by running
+// make with ARCH_ARGS="-mavx2 -mfma".
+#if defined(__AVX__) && !_DEBUG
+#  define PRINCIPIA_USE_AVX_INTRINSICS 1
+#else
+#  define PRINCIPIA_USE_AVX_INTRINSICS 0
+#endif
+#if (defined(__FMA__) ||                                    \
+     (PRINCIPIA_COMPILER_MSVC && defined(__AVX2__))) &&   \
+    !_DEBUG
+#  define PRINCIPIA_USE_FMA_INTRINSICS 1
+#else
+#  define PRINCIPIA_USE_FMA_INTRINSICS 0
+#endif
+
 // Thread-safety analysis.
 #if PRINCIPIA_COMPILER_CLANG || PRINCIPIA_COMPILER_CLANG_CL
 #  define THREAD_ANNOTATION_ATTRIBUTE__(x) __attribute__((x))
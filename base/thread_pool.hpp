@@ -1,25 +1,28 @@
 #pragma once
 
-#include <deque>
+#include <atomic>
 #include <functional>
 #include <future>
-#include <list>
-#include <thread>
 
-#include "absl/base/thread_annotations.h"
-#include "absl/synchronization/mutex.h"
+#include "base/work_stealing_executor.hpp"
 
 namespace principia {
 namespace base {
 
 // A pool of threads that are created at construction and to which functions can
 // be added for asynchronous execution.  This class is thread-safe.
+// This is a facade over |WorkStealingExecutor| for clients that want a
+// |std::future| for each call.  Clients that add many small tasks should use
+// the executor and a |Completion| directly, as they are cheaper.
 template<typename T>
 class ThreadPool final {
  public:
   // Constructs a pool with the given number of threads.
   explicit ThreadPool(std::int64_t pool_size);
 
+  // Drops the calls that have not started executing, the futures of which
+  // report |std::future_errc::broken_promise|, and joins the threads.  The
+  // tasks added directly to |executor()| are executed.
   ~ThreadPool();
 
   // Adds a call to the execution queue, and returns a future that the client
@@ -27,23 +30,14 @@ class ThreadPool final {
   // the result.
   std::future<T> Add(std::function<T()> function);
 
+  // The executor that runs the calls.
+  WorkStealingExecutor& executor();
+
  private:
-  // The queue element contains a |function| to execute and a |promise| used to
-  // communicate the result to the caller.
-  struct Call {
-    std::function<T()> function;
-    std::promise<T> promise;
-  };
-
-  // The loop executed on each thread to extract an element from the queue,
-  // execute it, and set its result in the promise.
-  void DequeueCallAndExecute();
-
-  absl::Mutex lock_;
-  bool shutdown_ GUARDED_BY(lock_) = false;
-  std::deque<Call> calls_ GUARDED_BY(lock_);
-
-  std::list<std::thread> threads_;
+  // Declared before |executor_| as the calls check it while the executor is
+  // being destroyed.
+  std::atomic<bool> shutdown_ = false;
+  WorkStealingExecutor executor_;
 };
 
 }  // namespace base
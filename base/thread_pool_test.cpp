@@ -1,9 +1,13 @@
 
 #include "base/thread_pool.hpp"
 
+#include <chrono>
+#include <future>
+#include <thread>
 #include <vector>
 
 #include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
 #include "glog/logging.h"
 #include "gmock/gmock.h"
 
@@ -51,5 +55,26 @@ TEST_F(ThreadPoolTest, ParallelExecution) {
   EXPECT_FALSE(monotonically_increasing);
 }
 
+// Check that the calls that have not started executing when the pool is
+// destroyed are dropped.
+TEST_F(ThreadPoolTest, DropsPendingCallsOnDestruction) {
+  std::future<void> running;
+  std::future<void> pending;
+  bool pending_executed = false;
+  {
+    ThreadPool<void> pool(/*pool_size=*/1);
+    absl::Notification started;
+    running = pool.Add([&started]() {
+      started.Notify();
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    });
+    pending = pool.Add([&pending_executed]() { pending_executed = true; });
+    started.WaitForNotification();
+  }
+  running.get();
+  EXPECT_FALSE(pending_executed);
+  EXPECT_THROW(pending.get(), std::future_error);
+}
+
 }  // namespace base
 }  // namespace principia
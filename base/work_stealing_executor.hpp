@@ -0,0 +1,189 @@
+﻿
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace principia {
+namespace base {
+namespace internal_work_stealing_executor {
+
+// Tracks the completion of a number of tasks added to a
+// |WorkStealingExecutor|.  Unlike a |std::future|, it doesn't allocate, and a
+// single |Completion| may track any number of tasks, e.g., all the tasks of a
+// fan-out.  A |Completion| must outlive the tasks that it tracks.
+class Completion final {
+ public:
+  Completion() = default;
+  Completion(Completion const&) = delete;
+  Completion& operator=(Completion const&) = delete;
+
+  // Waits until the task that completed this object, if any, no longer refers
+  // to it, so that it is safe to destroy it as soon as |Wait| returns or |done|
+  // returns true.
+  ~Completion();
+
+  // True if all the tasks tracked by this object have been executed.
+  bool done() const;
+
+  // Blocks until all the tasks tracked by this object have been executed.
+  // Note that calling this from a task running on the executor blocks the
+  // worker that runs that task.
+  void Wait() const;
+
+ private:
+  void Expect();
+  void Complete();
+
+  std::atomic<std::int64_t> pending_tasks_ = 0;
+  // Used to wake up the waiters.  |pending_tasks_| only goes to zero while this
+  // lock is held, and the lock is not accessed by |Complete| after that, so a
+  // waiter that acquires it after observing zero may destroy this object.
+  mutable absl::Mutex lock_;
+
+  friend class Task;
+  friend class WorkStealingExecutor;
+};
+
+// A type-erased, move-only |void()| callable, which notifies an optional
+// |Completion| when it has been executed.  Callables that fit in
+// |inline_capacity| bytes are stored inline, so that scheduling them doesn't
+// allocate; larger ones are moved to the heap.
+class Task final {
+ public:
+  static constexpr std::size_t inline_capacity = 96;
+
+  Task() = default;
+  template<typename Function>
+  Task(Function&& function, Completion* completion);
+
+  Task(Task&& other) noexcept;
+  Task& operator=(Task&& other) noexcept;
+  ~Task();
+
+  // Executes and destroys the callable, and then notifies the completion, if
+  // any.  Must only be called once.
+  void operator()();
+
+ private:
+  // The operations on the object of type |Stored| held in |storage_|.
+  struct Operations final {
+    void (*invoke)(void* storage);
+    void (*move)(void* from, void* to);
+    void (*destroy)(void* storage);
+  };
+
+  template<typename Stored>
+  static Operations const operations_for_;
+
+  // Holds a callable that doesn't fit in |storage_|.
+  template<typename F>
+  struct OnHeap final {
+    void operator()();
+    std::unique_ptr<F> f;
+  };
+
+  void Reset();
+
+  alignas(std::max_align_t) std::byte storage_[inline_capacity];
+  Operations const* operations_ = nullptr;
+  Completion* completion_ = nullptr;
+};
+
+// A double-ended queue of tasks held in a ring buffer.  The buffer grows
+// geometrically when full and is never shrunk, so that, in steady state,
+// adding and removing tasks doesn't allocate.  This class is not thread-safe.
+class TaskDeque final {
+ public:
+  TaskDeque();
+
+  bool empty() const;
+
+  void PushBack(Task task);
+  // These functions return false if the deque is empty.
+  bool PopBack(Task& task);
+  bool PopFront(Task& task);
+
+ private:
+  std::int64_t capacity() const;
+  void Grow();
+
+  std::vector<Task> tasks_;
+  std::int64_t front_ = 0;
+  std::int64_t size_ = 0;
+};
+
+// An executor that runs tasks on a fixed number of worker threads.  Each worker
+// has its own deque of tasks: it takes the most recently added tasks from its
+// own deque, and when that deque is empty it steals the oldest tasks from the
+// deques of the other workers.  Tasks added from a worker go to the deque of
+// that worker, which is good for locality and avoids contention on fan-out;
+// tasks added from other threads are distributed round-robin.  This class is
+// thread-safe.
+class WorkStealingExecutor final {
+ public:
+  explicit WorkStealingExecutor(std::int64_t number_of_workers);
+
+  // Executes the tasks that have been added and not yet executed, and joins
+  // the workers.
+  ~WorkStealingExecutor();
+
+  // Schedules |function|, which must be callable as |void()|, for execution
+  // on one of the workers.  If |completion| is not null, it tracks the
+  // execution of |function|.
+  template<typename Function>
+  void Add(Function&& function, Completion* completion = nullptr);
+
+  std::int64_t number_of_workers() const;
+
+ private:
+  struct Worker final {
+    absl::Mutex lock;
+    TaskDeque tasks GUARDED_BY(lock);
+  };
+
+  void Enqueue(Task task);
+
+  // Takes a task from the deque of the given worker or, failing that, steals
+  // one from another worker.  Returns false if all the deques are empty.
+  bool Dequeue(std::int64_t worker_index, Task& task);
+
+  // The loop executed by each worker.
+  void Work(std::int64_t worker_index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<std::int64_t> next_worker_ = 0;
+
+  // The number of tasks in all the deques.
+  std::atomic<std::int64_t> queued_tasks_ = 0;
+  // The number of workers blocked in |Work| waiting for tasks.  Used to avoid
+  // locking |idle_lock_| when adding tasks if no worker needs to be woken up.
+  std::atomic<std::int64_t> idle_workers_ = 0;
+  absl::Mutex idle_lock_;
+  bool shutdown_ GUARDED_BY(idle_lock_) = false;
+
+  std::vector<std::thread> threads_;
+
+  // The executor and the index of the worker running on the current thread,
+  // if any.
+  inline static thread_local WorkStealingExecutor const* current_executor_ =
+      nullptr;
+  inline static thread_local std::int64_t current_worker_index_ = 0;
+};
+
+}  // namespace internal_work_stealing_executor
+
+using internal_work_stealing_executor::Completion;
+using internal_work_stealing_executor::WorkStealingExecutor;
+
+}  // namespace base
+}  // namespace principia
+
+#include "base/work_stealing_executor_body.hpp"
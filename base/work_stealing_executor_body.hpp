@@ -0,0 +1,283 @@
+﻿
+#pragma once
+
+#include "base/work_stealing_executor.hpp"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "glog/logging.h"
+
+namespace principia {
+namespace base {
+namespace internal_work_stealing_executor {
+
+// The initial capacity of the deque of each worker.
+constexpr std::int64_t initial_deque_capacity = 1024;
+
+inline Completion::~Completion() {
+  absl::MutexLock l(&lock_);
+}
+
+inline bool Completion::done() const {
+  return pending_tasks_.load() == 0;
+}
+
+inline void Completion::Wait() const {
+  auto const done = [this]() { return this->done(); };
+  absl::MutexLock l(&lock_);
+  lock_.Await(absl::Condition(&done));
+}
+
+inline void Completion::Expect() {
+  pending_tasks_.fetch_add(1);
+}
+
+inline void Completion::Complete() {
+  // The tasks that are not the last one don't need to lock, as no waiter may
+  // return before the last one completes.
+  std::int64_t pending_tasks = pending_tasks_.load();
+  while (pending_tasks > 1) {
+    if (pending_tasks_.compare_exchange_weak(pending_tasks,
+                                             pending_tasks - 1)) {
+      return;
+    }
+  }
+  // The last task decrements under the lock, so that a waiter cannot observe
+  // zero and destroy this object before we are done with |lock_|.  Releasing
+  // the lock causes the waiters to reevaluate their condition.
+  absl::MutexLock l(&lock_);
+  pending_tasks_.fetch_sub(1);
+}
+
+template<typename Stored>
+Task::Operations const Task::operations_for_ = {
+    /*invoke=*/[](void* const storage) {
+      (*static_cast<Stored*>(storage))();
+    },
+    /*move=*/[](void* const from, void* const to) {
+      new (to) Stored(std::move(*static_cast<Stored*>(from)));
+      static_cast<Stored*>(from)->~Stored();
+    },
+    /*destroy=*/[](void* const storage) {
+      static_cast<Stored*>(storage)->~Stored();
+    }};
+
+template<typename Function>
+Task::Task(Function&& function, Completion* const completion)
+    : completion_(completion) {
+  using F = std::decay_t<Function>;
+  if constexpr (sizeof(F) <= inline_capacity &&
+                alignof(F) <= alignof(std::max_align_t) &&
+                std::is_nothrow_move_constructible_v<F>) {
+    new (storage_) F(std::forward<Function>(function));
+    operations_ = &operations_for_<F>;
+  } else {
+    new (storage_)
+        OnHeap<F>{std::make_unique<F>(std::forward<Function>(function))};
+    operations_ = &operations_for_<OnHeap<F>>;
+  }
+  if (completion_ != nullptr) {
+    completion_->Expect();
+  }
+}
+
+template<typename F>
+void Task::OnHeap<F>::operator()() {
+  (*f)();
+}
+
+inline Task::Task(Task&& other) noexcept
+    : operations_(other.operations_),
+      completion_(other.completion_) {
+  if (operations_ != nullptr) {
+    operations_->move(other.storage_, storage_);
+    other.operations_ = nullptr;
+    other.completion_ = nullptr;
+  }
+}
+
+inline Task& Task::operator=(Task&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    operations_ = other.operations_;
+    completion_ = other.completion_;
+    if (operations_ != nullptr) {
+      operations_->move(other.storage_, storage_);
+      other.operations_ = nullptr;
+      other.completion_ = nullptr;
+    }
+  }
+  return *this;
+}
+
+inline Task::~Task() {
+  Reset();
+}
+
+inline void Task::operator()() {
+  CHECK(operations_ != nullptr);
+  operations_->invoke(storage_);
+  // Destroy the callable before notifying the completion, as its captures may
+  // refer to objects that the waiters will destroy.
+  Reset();
+  if (completion_ != nullptr) {
+    completion_->Complete();
+    completion_ = nullptr;
+  }
+}
+
+inline void Task::Reset() {
+  if (operations_ != nullptr) {
+    operations_->destroy(storage_);
+    operations_ = nullptr;
+  }
+}
+
+inline TaskDeque::TaskDeque() : tasks_(initial_deque_capacity) {}
+
+inline bool TaskDeque::empty() const {
+  return size_ == 0;
+}
+
+inline void TaskDeque::PushBack(Task task) {
+  if (size_ == capacity()) {
+    Grow();
+  }
+  tasks_[(front_ + size_) % capacity()] = std::move(task);
+  ++size_;
+}
+
+inline bool TaskDeque::PopBack(Task& task) {
+  if (size_ == 0) {
+    return false;
+  }
+  --size_;
+  task = std::move(tasks_[(front_ + size_) % capacity()]);
+  return true;
+}
+
+inline bool TaskDeque::PopFront(Task& task) {
+  if (size_ == 0) {
+    return false;
+  }
+  task = std::move(tasks_[front_]);
+  front_ = (front_ + 1) % capacity();
+  --size_;
+  return true;
+}
+
+inline std::int64_t TaskDeque::capacity() const {
+  return static_cast<std::int64_t>(tasks_.size());
+}
+
+inline void TaskDeque::Grow() {
+  std::vector<Task> tasks(2 * capacity());
+  for (std::int64_t i = 0; i < size_; ++i) {
+    tasks[i] = std::move(tasks_[(front_ + i) % capacity()]);
+  }
+  tasks_.swap(tasks);
+  front_ = 0;
+}
+
+inline WorkStealingExecutor::WorkStealingExecutor(
+    std::int64_t const number_of_workers) {
+  CHECK_LT(0, number_of_workers);
+  for (std::int64_t i = 0; i < number_of_workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (std::int64_t i = 0; i < number_of_workers; ++i) {
+    threads_.emplace_back(&WorkStealingExecutor::Work, this, i);
+  }
+}
+
+inline WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    absl::MutexLock l(&idle_lock_);
+    shutdown_ = true;
+  }
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+template<typename Function>
+void WorkStealingExecutor::Add(Function&& function,
+                               Completion* const completion) {
+  Enqueue(Task(std::forward<Function>(function), completion));
+}
+
+inline std::int64_t WorkStealingExecutor::number_of_workers() const {
+  return static_cast<std::int64_t>(workers_.size());
+}
+
+inline void WorkStealingExecutor::Enqueue(Task task) {
+  std::int64_t const worker_index =
+      current_executor_ == this
+          ? current_worker_index_
+          : next_worker_.fetch_add(1) % number_of_workers();
+  {
+    Worker& worker = *workers_[worker_index];
+    absl::MutexLock l(&worker.lock);
+    worker.tasks.PushBack(std::move(task));
+  }
+  // An idle worker increments |idle_workers_| before checking |queued_tasks_|,
+  // and we increment |queued_tasks_| before checking |idle_workers_|, so either
+  // that worker sees our task, or we see that it is idle and wake it up.
+  queued_tasks_.fetch_add(1);
+  if (idle_workers_.load() > 0) {
+    // Releasing the lock causes the idle workers to reevaluate their
+    // condition.
+    absl::MutexLock l(&idle_lock_);
+  }
+}
+
+inline bool WorkStealingExecutor::Dequeue(std::int64_t const worker_index,
+                                          Task& task) {
+  {
+    Worker& worker = *workers_[worker_index];
+    absl::MutexLock l(&worker.lock);
+    if (worker.tasks.PopBack(task)) {
+      queued_tasks_.fetch_sub(1);
+      return true;
+    }
+  }
+  for (std::int64_t i = 1; i < number_of_workers(); ++i) {
+    Worker& victim = *workers_[(worker_index + i) % number_of_workers()];
+    absl::MutexLock l(&victim.lock);
+    if (victim.tasks.PopFront(task)) {
+      queued_tasks_.fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void WorkStealingExecutor::Work(std::int64_t const worker_index) {
+  current_executor_ = this;
+  current_worker_index_ = worker_index;
+  auto const has_tasks_or_shutdown = [this]() {
+    return queued_tasks_.load() > 0 || shutdown_;
+  };
+  for (;;) {
+    Task task;
+    if (Dequeue(worker_index, task)) {
+      task();
+      continue;
+    }
+    absl::MutexLock l(&idle_lock_);
+    idle_workers_.fetch_add(1);
+    idle_lock_.Await(absl::Condition(&has_tasks_or_shutdown));
+    idle_workers_.fetch_sub(1);
+    // Tasks that were added before the shutdown are executed before exiting.
+    if (shutdown_ && queued_tasks_.load() == 0) {
+      break;
+    }
+  }
+  current_executor_ = nullptr;
+}
+
+}  // namespace internal_work_stealing_executor
+}  // namespace base
+}  // namespace principia
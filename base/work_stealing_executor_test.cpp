@@ -0,0 +1,116 @@
+﻿
+#include "base/work_stealing_executor.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace principia {
+namespace base {
+
+class WorkStealingExecutorTest : public ::testing::Test {
+ protected:
+  WorkStealingExecutorTest() : executor_(/*number_of_workers=*/4) {}
+
+  WorkStealingExecutor executor_;
+};
+
+TEST_F(WorkStealingExecutorTest, FanOutFanIn) {
+  constexpr int number_of_tasks = 100'000;
+  std::vector<std::int64_t> results(number_of_tasks);
+  Completion completion;
+  for (std::int64_t i = 0; i < number_of_tasks; ++i) {
+    executor_.Add([i, &results]() { results[i] = i * i; }, &completion);
+  }
+  completion.Wait();
+  EXPECT_TRUE(completion.done());
+  for (std::int64_t i = 0; i < number_of_tasks; ++i) {
+    EXPECT_EQ(i * i, results[i]);
+  }
+}
+
+// Tasks that add tasks, which go to the deque of the worker that adds them and
+// may be stolen by the other workers.
+TEST_F(WorkStealingExecutorTest, NestedTasks) {
+  constexpr int number_of_parents = 100;
+  constexpr int children_per_parent = 1000;
+  std::atomic<std::int64_t> sum = 0;
+  Completion completion;
+  for (int i = 0; i < number_of_parents; ++i) {
+    executor_.Add(
+        [this, &completion, &sum]() {
+          for (int j = 0; j < children_per_parent; ++j) {
+            executor_.Add([j, &sum]() { sum += j; }, &completion);
+          }
+        },
+        &completion);
+  }
+  completion.Wait();
+  EXPECT_EQ(number_of_parents * children_per_parent *
+                (children_per_parent - 1) / 2,
+            sum);
+}
+
+// A callable too large to be stored inline, and move-only.
+TEST_F(WorkStealingExecutorTest, LargeCallable) {
+  std::array<std::int64_t, 100> values;
+  for (int i = 0; i < values.size(); ++i) {
+    values[i] = i;
+  }
+  auto factor = std::make_unique<std::int64_t>(2);
+  std::int64_t result = 0;
+  Completion completion;
+  executor_.Add(
+      [values, factor = std::move(factor), &result]() {
+        for (auto const value : values) {
+          result += *factor * value;
+        }
+      },
+      &completion);
+  completion.Wait();
+  EXPECT_EQ(9900, result);
+}
+
+// A completion destroyed as soon as |Wait| or |done| returns must not be
+// touched by the task that completed it.  Best run with a sanitizer.
+TEST_F(WorkStealingExecutorTest, DestroyCompletionAfterWait) {
+  constexpr int number_of_iterations = 10'000;
+  std::int64_t sum = 0;
+  for (int i = 0; i < number_of_iterations; ++i) {
+    auto completion = std::make_unique<Completion>();
+    executor_.Add([i, &sum]() { sum += i; }, completion.get());
+    if (i % 2 == 0) {
+      completion->Wait();
+    } else {
+      while (!completion->done()) {
+        std::this_thread::yield();
+      }
+    }
+    completion.reset();
+  }
+  EXPECT_EQ(static_cast<std::int64_t>(number_of_iterations) *
+                (number_of_iterations - 1) / 2,
+            sum);
+}
+
+TEST_F(WorkStealingExecutorTest, ExecutesPendingTasksOnDestruction) {
+  constexpr int number_of_tasks = 10'000;
+  std::atomic<std::int64_t> executed = 0;
+  {
+    WorkStealingExecutor executor(/*number_of_workers=*/2);
+    for (int i = 0; i < number_of_tasks; ++i) {
+      executor.Add([&executed]() { ++executed; });
+    }
+  }
+  EXPECT_EQ(number_of_tasks, executed);
+}
+
+}  // namespace base
+}  // namespace principia
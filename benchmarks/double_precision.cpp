@@ -0,0 +1,62 @@
+﻿// .\Release\x64\benchmarks.exe --benchmark_repetitions=10 --benchmark_min_time=2 --benchmark_filter=TwoProduct  // NOLINT(whitespace/line_length)
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "numerics/double_precision.hpp"
+
+namespace principia {
+namespace numerics {
+
+namespace {
+
+constexpr int number_of_values = 1000;
+
+std::vector<double> RandomValues(std::mt19937_64& random) {
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  std::vector<double> values;
+  values.reserve(number_of_values);
+  for (int i = 0; i < number_of_values; ++i) {
+    values.push_back(distribution(random));
+  }
+  return values;
+}
+
+}  // namespace
+
+void BM_TwoProduct(benchmark::State& state) {
+  std::mt19937_64 random(42);
+  std::vector<double> const a = RandomValues(random);
+  std::vector<double> const b = RandomValues(random);
+  for (auto _ : state) {
+    double error = 0;
+    for (int i = 0; i < number_of_values; ++i) {
+      error += TwoProduct(a[i], b[i]).error;
+    }
+    benchmark::DoNotOptimize(error);
+  }
+}
+
+// A compensated dot product.
+void BM_TwoProductAdd(benchmark::State& state) {
+  std::mt19937_64 random(42);
+  std::vector<double> const a = RandomValues(random);
+  std::vector<double> const b = RandomValues(random);
+  for (auto _ : state) {
+    DoublePrecision<double> dot_product;
+    for (int i = 0; i < number_of_values; ++i) {
+      DoublePrecision<double> const term =
+          TwoProductAdd(a[i], b[i], dot_product.value);
+      dot_product.value = term.value;
+      dot_product.error += term.error;
+    }
+    benchmark::DoNotOptimize(dot_product);
+  }
+}
+
+BENCHMARK(BM_TwoProduct);
+BENCHMARK(BM_TwoProductAdd);
+
+}  // namespace numerics
+}  // namespace principia
@@ -4,6 +4,7 @@
 #include <random>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "benchmark/benchmark.h"
 #include "numerics/elliptic_functions.hpp"
 #include "quantities/numbers.hpp"
@@ -68,8 +69,80 @@ void BM_JacobiSNCNDN(benchmark::State& state) {
   }
 }
 
+// Computes the functions for many arguments sharing the same parameter, either
+// one at a time or using the batch functions.
+template<bool batch>
+void BM_JacobiAmplitudeMultipleArguments(benchmark::State& state) {
+  constexpr int size = 100;
+
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution_u(-10.0, 10.0);
+  std::uniform_real_distribution<> distribution_mc(0.0, 1.0);
+  std::vector<Angle> us;
+  std::vector<double> mcs;
+  for (int i = 0; i < size; ++i) {
+    us.push_back(distribution_u(random) * Radian);
+    mcs.push_back(distribution_mc(random));
+  }
+
+  std::vector<Angle> as(size);
+  while (state.KeepRunningBatch(size * size)) {
+    for (double const mc : mcs) {
+      if constexpr (batch) {
+        JacobiAmplitude(us, mc, absl::MakeSpan(as));
+      } else {
+        for (int i = 0; i < size; ++i) {
+          as[i] = JacobiAmplitude(us[i], mc);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(as);
+  }
+}
+
+template<bool batch>
+void BM_JacobiSNCNDNMultipleArguments(benchmark::State& state) {
+  constexpr int size = 100;
+
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution_u(-10.0, 10.0);
+  std::uniform_real_distribution<> distribution_mc(0.0, 1.0);
+  std::vector<Angle> us;
+  std::vector<double> mcs;
+  for (int i = 0; i < size; ++i) {
+    us.push_back(distribution_u(random) * Radian);
+    mcs.push_back(distribution_mc(random));
+  }
+
+  std::vector<double> ss(size);
+  std::vector<double> cs(size);
+  std::vector<double> ds(size);
+  while (state.KeepRunningBatch(size * size)) {
+    for (double const mc : mcs) {
+      if constexpr (batch) {
+        JacobiSNCNDN(us,
+                     mc,
+                     absl::MakeSpan(ss),
+                     absl::MakeSpan(cs),
+                     absl::MakeSpan(ds));
+      } else {
+        for (int i = 0; i < size; ++i) {
+          JacobiSNCNDN(us[i], mc, ss[i], cs[i], ds[i]);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(ss);
+    benchmark::DoNotOptimize(cs);
+    benchmark::DoNotOptimize(ds);
+  }
+}
+
 BENCHMARK(BM_JacobiAmplitude);
 BENCHMARK(BM_JacobiSNCNDN);
+BENCHMARK_TEMPLATE(BM_JacobiAmplitudeMultipleArguments, /*batch=*/false);
+BENCHMARK_TEMPLATE(BM_JacobiAmplitudeMultipleArguments, /*batch=*/true);
+BENCHMARK_TEMPLATE(BM_JacobiSNCNDNMultipleArguments, /*batch=*/false);
+BENCHMARK_TEMPLATE(BM_JacobiSNCNDNMultipleArguments, /*batch=*/true);
 
 }  // namespace numerics
 }  // namespace principia
@@ -4,6 +4,7 @@
 #include <random>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "base/tags.hpp"
 #include "benchmark/benchmark.h"
 #include "numerics/elliptic_integrals.hpp"
@@ -108,9 +109,87 @@ void BM_FukushimaEllipticBDJ(benchmark::State& state) {
   }
 }
 
+// Computes the integrals for many amplitudes sharing the same characteristic
+// and parameter, either one at a time or using the batch functions.
+template<bool batch>
+void BM_EllipticFMultipleAmplitudes(benchmark::State& state) {
+  constexpr int size = 20;
+
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution_φ(-10.0, 10.0);
+  std::uniform_real_distribution<> distribution_mc(0.0, 1.0);
+  std::vector<Angle> φs;
+  std::vector<double> mcs;
+  for (int i = 0; i < size; ++i) {
+    φs.push_back(distribution_φ(random) * Radian);
+    mcs.push_back(distribution_mc(random));
+  }
+
+  std::vector<Angle> fs(size);
+  while (state.KeepRunningBatch(size * size)) {
+    for (double const mc : mcs) {
+      if constexpr (batch) {
+        EllipticF(φs, mc, absl::MakeSpan(fs));
+      } else {
+        for (int i = 0; i < size; ++i) {
+          fs[i] = EllipticF(φs[i], mc);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(fs);
+  }
+}
+
+template<bool batch>
+void BM_FukushimaEllipticBDJMultipleAmplitudes(benchmark::State& state) {
+  constexpr int size = 20;
+
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution_φ(-10.0, 10.0);
+  std::uniform_real_distribution<> distribution_n(0.0, 1.0);
+  std::uniform_real_distribution<> distribution_mc(0.0, 1.0);
+  std::vector<Angle> φs;
+  std::vector<double> ns;
+  std::vector<double> mcs;
+  for (int i = 0; i < size; ++i) {
+    φs.push_back(distribution_φ(random) * Radian);
+    ns.push_back(distribution_n(random));
+    mcs.push_back(distribution_mc(random));
+  }
+
+  std::vector<Angle> bs(size);
+  std::vector<Angle> ds(size);
+  std::vector<Angle> js(size);
+  while (state.KeepRunningBatch(size * size * size)) {
+    for (double const n : ns) {
+      for (double const mc : mcs) {
+        if constexpr (batch) {
+          FukushimaEllipticBDJ(φs,
+                               n,
+                               mc,
+                               absl::MakeSpan(bs),
+                               absl::MakeSpan(ds),
+                               absl::MakeSpan(js));
+        } else {
+          for (int i = 0; i < size; ++i) {
+            FukushimaEllipticBDJ(φs[i], n, mc, bs[i], ds[i], js[i]);
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(bs);
+    benchmark::DoNotOptimize(ds);
+    benchmark::DoNotOptimize(js);
+  }
+}
+
 BENCHMARK(BM_EllipticF);
 BENCHMARK(BM_EllipticFEΠ);
 BENCHMARK(BM_FukushimaEllipticBDJ);
+BENCHMARK_TEMPLATE(BM_EllipticFMultipleAmplitudes, /*batch=*/false);
+BENCHMARK_TEMPLATE(BM_EllipticFMultipleAmplitudes, /*batch=*/true);
+BENCHMARK_TEMPLATE(BM_FukushimaEllipticBDJMultipleAmplitudes, /*batch=*/false);
+BENCHMARK_TEMPLATE(BM_FukushimaEllipticBDJMultipleAmplitudes, /*batch=*/true);
 
 }  // namespace numerics
 }  // namespace principia
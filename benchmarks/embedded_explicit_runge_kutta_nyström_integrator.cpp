@@ -1,10 +1,13 @@
 ﻿
 // .\Release\x64\benchmarks.exe --benchmark_repetitions=5 --benchmark_min_time=5 --benchmark_filter=EmbeddedExplicitRungeKuttaNyströmIntegratorSolveHarmonicOscillator                                                                                                                 // NOLINT(whitespace/line_length)
+// .\Release\x64\benchmarks.exe --benchmark_repetitions=5 --benchmark_min_time=5 --benchmark_filter=EmbeddedExplicitRungeKuttaNyströmIntegratorSolveEccentricKepler                                                                                                                     // NOLINT(whitespace/line_length)
 
 #define GLOG_NO_ABBREVIATED_SEVERITIES
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
@@ -15,10 +18,12 @@
 #include "geometry/named_quantities.hpp"
 #include "integrators/methods.hpp"
 #include "integrators/ordinary_differential_equations.hpp"
+#include "integrators/step_size_controller.hpp"
 #include "integrators/symplectic_runge_kutta_nyström_integrator.hpp"
 #include "glog/logging.h"
 #include "quantities/elementary_functions.hpp"
 #include "quantities/named_quantities.hpp"
+#include "quantities/numbers.hpp"
 #include "quantities/si.hpp"
 #include "serialization/physics.pb.h"
 #include "testing_utilities/integration.hpp"
@@ -38,11 +43,14 @@ using quantities::Abs;
 using quantities::Acceleration;
 using quantities::AngularFrequency;
 using quantities::Cos;
+using quantities::GravitationalParameter;
 using quantities::Length;
 using quantities::Mass;
+using quantities::Pow;
 using quantities::Sin;
 using quantities::SIUnit;
 using quantities::Speed;
+using quantities::Sqrt;
 using quantities::Stiffness;
 using quantities::Time;
 using quantities::si::Metre;
@@ -50,6 +58,7 @@ using quantities::si::Radian;
 using quantities::si::Second;
 using testing_utilities::ComputeHarmonicOscillatorAcceleration1D;
 using testing_utilities::ComputeHarmonicOscillatorAcceleration3D;
+using testing_utilities::ComputeKeplerAcceleration;
 using ::std::placeholders::_1;
 using ::std::placeholders::_2;
 using ::std::placeholders::_3;
@@ -80,6 +89,23 @@ double HarmonicOscillatorToleranceRatio3D(
                   v_tolerance / (error.velocity_error[0]).Norm());
 }
 
+template<typename ODE>
+double KeplerToleranceRatio(Time const& h,
+                            typename ODE::SystemStateError const& error,
+                            Length const& q_tolerance,
+                            Speed const& v_tolerance,
+                            int* const rejections) {
+  double const r = std::min(
+      q_tolerance / Sqrt(Pow<2>(error.position_error[0]) +
+                         Pow<2>(error.position_error[1])),
+      v_tolerance / Sqrt(Pow<2>(error.velocity_error[0]) +
+                         Pow<2>(error.velocity_error[1])));
+  if (r < 1.0) {
+    ++*rejections;
+  }
+  return r;
+}
+
 }  // namespace
 
 template<typename Integrator>
@@ -232,6 +258,73 @@ void BM_EmbeddedExplicitRungeKuttaNyströmIntegratorSolveHarmonicOscillator3D(
   state.SetLabel(ss.str());
 }
 
+// Integrates 10 revolutions of a Kepler orbit of eccentricity
+// |state.range(0)| / 100, starting at periapsis, with the step size controller
+// of kind |state.range(1)|.  The label reports the number of right-hand side
+// evaluations, the number of rejected steps, and the position error after the
+// last revolution.
+template<typename Method>
+void BM_EmbeddedExplicitRungeKuttaNyströmIntegratorSolveEccentricKepler(
+    benchmark::State& state) {
+  using ODE = SpecialSecondOrderDifferentialEquation<Length>;
+  auto const& integrator =
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<Method, Length>();
+
+  double const e = state.range(0) / 100.0;
+  auto const controller = StepSizeController::Make(
+      static_cast<StepSizeController::Kind>(state.range(1)));
+  // Unit gravitational parameter and semimajor axis, so that the period is
+  // 2π s.
+  GravitationalParameter const μ = SIUnit<GravitationalParameter>();
+  Length const a = 1 * Metre;
+  Length const periapsis = a * (1 - e);
+  Speed const periapsis_speed = Sqrt(μ * (1 + e) / periapsis);
+  Instant const t_initial;
+  Instant const t_final = t_initial + 10 * 2 * π * Second;
+  Length const length_tolerance = 1e-9 * Metre;
+  Speed const speed_tolerance = 1e-9 * Metre / Second;
+
+  int evaluations;
+  int rejections;
+  Length q_error;
+  while (state.KeepRunning()) {
+    evaluations = 0;
+    rejections = 0;
+    ODE::SystemState final_state;
+    ODE kepler;
+    kepler.compute_acceleration =
+        std::bind(ComputeKeplerAcceleration, _1, _2, _3, &evaluations);
+    IntegrationProblem<ODE> problem;
+    problem.equation = kepler;
+    problem.initial_state = {{periapsis, 0 * Metre},
+                             {0 * Metre / Second, periapsis_speed},
+                             t_initial};
+    auto const append_state = [&final_state](ODE::SystemState const& state) {
+      final_state = state;
+    };
+    typename AdaptiveStepSizeIntegrator<ODE>::Parameters const parameters(
+        /*first_time_step=*/t_final - t_initial,
+        /*safety_factor=*/0.9,
+        /*max_steps=*/std::numeric_limits<std::int64_t>::max(),
+        /*last_step_is_exact=*/true,
+        controller);
+    auto const tolerance_to_error_ratio =
+        std::bind(KeplerToleranceRatio<ODE>,
+                  _1, _2, length_tolerance, speed_tolerance, &rejections);
+    auto const instance = integrator.NewInstance(problem,
+                                                 append_state,
+                                                 tolerance_to_error_ratio,
+                                                 parameters);
+    instance->Solve(t_final);
+    q_error = Sqrt(Pow<2>(final_state.positions[0].value - periapsis) +
+                   Pow<2>(final_state.positions[1].value));
+  }
+  std::stringstream ss;
+  ss << evaluations << " evaluations, " << rejections << " rejections, "
+     << q_error;
+  state.SetLabel(ss.str());
+}
+
 // Keep each argument on a single line below, lest it breaks benchmark parsing.
 
 BENCHMARK_TEMPLATE2(
@@ -242,5 +335,18 @@ BENCHMARK_TEMPLATE2(
     BM_EmbeddedExplicitRungeKuttaNyströmIntegratorSolveHarmonicOscillator3D,
     methods::DormandالمكاوىPrince1986RKN434FM, Position<World>);
 
+BENCHMARK_TEMPLATE1(
+    BM_EmbeddedExplicitRungeKuttaNyströmIntegratorSolveEccentricKepler,
+    methods::DormandالمكاوىPrince1986RKN434FM)
+    ->Args({50, serialization::StepSizeController::ELEMENTARY})
+    ->Args({50, serialization::StepSizeController::GUSTAFSSON_PI})
+    ->Args({50, serialization::StepSizeController::SODERLIND_PID})
+    ->Args({90, serialization::StepSizeController::ELEMENTARY})
+    ->Args({90, serialization::StepSizeController::GUSTAFSSON_PI})
+    ->Args({90, serialization::StepSizeController::SODERLIND_PID})
+    ->Args({99, serialization::StepSizeController::ELEMENTARY})
+    ->Args({99, serialization::StepSizeController::GUSTAFSSON_PI})
+    ->Args({99, serialization::StepSizeController::SODERLIND_PID});
+
 }  // namespace integrators
 }  // namespace principia
@@ -18,6 +18,7 @@
 #include "geometry/quaternion.hpp"
 #include "geometry/rotation.hpp"
 #include "integrators/integrators.hpp"
+#include "integrators/embedded_explicit_generalized_runge_kutta_nyström_integrator.hpp"
 #include "integrators/embedded_explicit_runge_kutta_nyström_integrator.hpp"
 #include "integrators/methods.hpp"
 #include "integrators/symmetric_linear_multistep_integrator.hpp"
@@ -26,6 +27,7 @@
 #include "physics/degrees_of_freedom.hpp"
 #include "physics/discrete_trajectory.hpp"
 #include "physics/ephemeris.hpp"
+#include "physics/kepler_orbit.hpp"
 #include "physics/massless_body.hpp"
 #include "quantities/astronomy.hpp"
 #include "quantities/bipm.hpp"
@@ -52,18 +54,22 @@ using geometry::Quaternion;
 using geometry::Rotation;
 using geometry::Velocity;
 using integrators::Integrator;
+using integrators::EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator;
 using integrators::EmbeddedExplicitRungeKuttaNyströmIntegrator;
 using integrators::SymmetricLinearMultistepIntegrator;
 using integrators::SymplecticRungeKuttaNyströmIntegrator;
 using integrators::methods::BlanesMoan2002SRKN14A;
 using integrators::methods::DormandالمكاوىPrince1986RKN434FM;
+using integrators::methods::Fine1987RKNG34;
 using integrators::methods::McLachlanAtela1992Order5Optimal;
 using integrators::methods::Quinlan1999Order8A;
 using integrators::methods::QuinlanTremaine1990Order12;
 using ksp_plugin::Barycentric;
 using quantities::DebugString;
 using quantities::Frequency;
+using quantities::GravitationalParameter;
 using quantities::Length;
+using quantities::Pow;
 using quantities::Speed;
 using quantities::Sqrt;
 using quantities::Time;
@@ -74,6 +80,7 @@ using quantities::si::ArcMinute;
 using quantities::si::ArcSecond;
 using quantities::si::Degree;
 using quantities::si::Hertz;
+using quantities::si::Hour;
 using quantities::si::Kilo;
 using quantities::si::Metre;
 using quantities::si::Milli;
@@ -113,7 +120,10 @@ not_null<std::unique_ptr<SolarSystem<Barycentric>>> SolarSystemAtСпутник1
   return at_спутник_1_launch;
 }
 
+// The second argument is 1 to use the specialization of the equations of
+// motion for a fixed number of bodies, 0 to use the generic code.
 void BM_EphemerisKSPSystem(benchmark::State& state) {
+  bool const fixed_size_specialization = state.range(1) != 0;
   Length error;
   while (state.KeepRunning()) {
     state.PauseTiming();
@@ -131,19 +141,19 @@ void BM_EphemerisKSPSystem(benchmark::State& state) {
             SymplecticRungeKuttaNyströmIntegrator<BlanesMoan2002SRKN14A,
                                                   Position<Barycentric>>(),
             /*step=*/35 * Minute));
+    if (!fixed_size_specialization) {
+      ephemeris->DisableFixedSizeSpecialization();
+    }
+    CHECK_EQ(fixed_size_specialization,
+             ephemeris->has_fixed_size_specialization());
 
     state.ResumeTiming();
     ephemeris->Prolong(final_time);
     state.PauseTiming();
-    error = (at_origin->trajectory(
-                 *ephemeris,
-                 SolarSystemFactory::name(SolarSystemFactory::Sun)).
-                     EvaluatePosition(final_time) -
-             at_origin->trajectory(
-                 *ephemeris,
-                 SolarSystemFactory::name(SolarSystemFactory::Earth)).
-                     EvaluatePosition(final_time)).
-                 Norm();
+    error = (at_origin->trajectory(*ephemeris, "Sun").
+                 EvaluatePosition(final_time) -
+             at_origin->trajectory(*ephemeris, "Kerbin").
+                 EvaluatePosition(final_time)).Norm();
     state.ResumeTiming();
   }
   state.SetLabel(quantities::DebugString(error / AstronomicalUnit) + " ua");
@@ -536,6 +546,78 @@ void BM_EphemerisStartup(benchmark::State& state) {
                                   state);
 }
 
+// A probe making close approaches.  The argument is 0 for an aerobraking orbit
+// whose periapsis is 100 km above the surface of the Earth, 1 for a flyby of
+// the Moon at an altitude of 100 km.  Comparing the flows with and without
+// regularization gives the savings in steps.
+template<Flow* flow>
+void BM_EphemerisCloseApproach(benchmark::State& state) {
+  constexpr auto accuracy = SolarSystemFactory::Accuracy::MajorBodiesOnly;
+  bool const aerobraking = state.range(0) == 0;
+  auto const at_спутник_1_launch = SolarSystemAtСпутник1Launch(accuracy);
+  Instant const& epoch = at_спутник_1_launch->epoch();
+  auto const ephemeris =
+      at_спутник_1_launch->MakeEphemeris(
+          SolarSystemFactory::MakeAccuracyParameters<Barycentric>(
+              FittingTolerance(-3),
+              accuracy),
+          EphemerisParameters());
+
+  std::string const& name = SolarSystemFactory::name(
+      aerobraking ? SolarSystemFactory::Earth : SolarSystemFactory::Moon);
+  MassiveBody const& body =
+      *at_спутник_1_launch->massive_body(*ephemeris, name);
+  GravitationalParameter const& μ = body.gravitational_parameter();
+  Length const periapsis_distance = body.mean_radius() + 100 * Kilo(Metre);
+  Speed periapsis_speed;
+  Instant periapsis_time;
+  Instant final_time;
+  if (aerobraking) {
+    // Two and a half revolutions starting at periapsis, with an apoapsis of
+    // 100 000 km.
+    Length const semimajor_axis =
+        (periapsis_distance + 100'000 * Kilo(Metre)) / 2;
+    periapsis_speed = Sqrt(μ * (2 / periapsis_distance - 1 / semimajor_axis));
+    periapsis_time = epoch;
+    final_time = epoch + 2.5 * 2 * π * Sqrt(Pow<3>(semimajor_axis) / μ);
+  } else {
+    // A hyperbolic excess speed of 1 km/s, and 6 hours on either side of the
+    // periapsis.
+    Speed const hyperbolic_excess_speed = 1 * Kilo(Metre) / Second;
+    periapsis_speed = Sqrt(hyperbolic_excess_speed * hyperbolic_excess_speed +
+                           2 * μ / periapsis_distance);
+    periapsis_time = epoch + 6 * Hour;
+    final_time = epoch + 12 * Hour;
+  }
+  KeplerOrbit<Barycentric> const orbit(
+      body,
+      MasslessBody(),
+      RelativeDegreesOfFreedom<Barycentric>(
+          Displacement<Barycentric>(
+              {periapsis_distance, 0 * Metre, 0 * Metre}),
+          Velocity<Barycentric>(
+              {0 * Metre / Second, periapsis_speed, 0 * Metre / Second})),
+      periapsis_time);
+  DegreesOfFreedom<Barycentric> const probe_degrees_of_freedom =
+      at_спутник_1_launch->degrees_of_freedom(name) +
+      orbit.StateVectors(epoch);
+
+  ephemeris->Prolong(final_time);
+
+  int steps;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    DiscreteTrajectory<Barycentric> trajectory;
+    trajectory.Append(epoch, probe_degrees_of_freedom);
+    state.ResumeTiming();
+    flow(&trajectory, final_time, *ephemeris);
+    state.PauseTiming();
+    steps = trajectory.Size();
+    state.ResumeTiming();
+  }
+  state.SetLabel(std::to_string(steps) + " steps");
+}
+
 void FlowEphemerisWithAdaptiveStep(
     not_null<DiscreteTrajectory<Barycentric>*> const trajectory,
     Instant const& t,
@@ -554,6 +636,47 @@ void FlowEphemerisWithAdaptiveStep(
       Ephemeris<Barycentric>::unlimited_max_ephemeris_steps));
 }
 
+void FlowEphemerisWithAdaptiveStepAndRegularization(
+    not_null<DiscreteTrajectory<Barycentric>*> const trajectory,
+    Instant const& t,
+    Ephemeris<Barycentric>& ephemeris) {
+  CHECK_OK(ephemeris.FlowWithAdaptiveStep(
+      trajectory,
+      Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+      t,
+      Ephemeris<Barycentric>::AdaptiveStepParameters(
+          EmbeddedExplicitRungeKuttaNyströmIntegrator<
+              DormandالمكاوىPrince1986RKN434FM,
+              Position<Barycentric>>(),
+          /*max_steps=*/std::numeric_limits<std::int64_t>::max(),
+          /*length_integration_tolerance=*/1 * Metre,
+          /*speed_integration_tolerance=*/1 * Metre / Second),
+      Ephemeris<Barycentric>::RegularizationParameters(
+          EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator<
+              Fine1987RKNG34,
+              Position<Barycentric>>(),
+          /*radius_factor=*/5),
+      Ephemeris<Barycentric>::unlimited_max_ephemeris_steps));
+}
+
+void FlowEphemerisWithAdaptiveStepUsingEnckeMethod(
+    not_null<DiscreteTrajectory<Barycentric>*> const trajectory,
+    Instant const& t,
+    Ephemeris<Barycentric>& ephemeris) {
+  CHECK_OK(ephemeris.FlowWithAdaptiveStepUsingEnckeMethod(
+      trajectory,
+      Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+      t,
+      Ephemeris<Barycentric>::AdaptiveStepParameters(
+          EmbeddedExplicitRungeKuttaNyströmIntegrator<
+              DormandالمكاوىPrince1986RKN434FM,
+              Position<Barycentric>>(),
+          /*max_steps=*/std::numeric_limits<std::int64_t>::max(),
+          /*length_integration_tolerance=*/1 * Metre,
+          /*speed_integration_tolerance=*/1 * Metre / Second),
+      Ephemeris<Barycentric>::unlimited_max_ephemeris_steps));
+}
+
 void FlowEphemerisWithFixedStepSLMS(
     not_null<DiscreteTrajectory<Barycentric>*> const trajectory,
     Instant const& t,
@@ -588,7 +711,7 @@ BENCHMARK(BM_EphemerisMultithreadingBenchmark)
     ->ArgPair(3, 3)
     ->ArgPair(3, 4)
     ->ArgPair(3, 5);
-BENCHMARK(BM_EphemerisKSPSystem)->Arg(-3);
+BENCHMARK(BM_EphemerisKSPSystem)->ArgPair(-3, 0)->ArgPair(-3, 1);
 BENCHMARK_TEMPLATE(BM_EphemerisSolarSystem,
                    SolarSystemFactory::Accuracy::MajorBodiesOnly)
     ->Arg(-3);
@@ -614,6 +737,10 @@ BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
                    SolarSystemFactory::Accuracy::MajorBodiesOnly,
                    &FlowEphemerisWithAdaptiveStep)
     ->Arg(-3);
+BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
+                   SolarSystemFactory::Accuracy::MajorBodiesOnly,
+                   &FlowEphemerisWithAdaptiveStepUsingEnckeMethod)
+    ->Arg(-3);
 BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
                    SolarSystemFactory::Accuracy::MajorBodiesOnly,
                    &FlowEphemerisWithFixedStepSLMS)
@@ -626,6 +753,10 @@ BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
                    SolarSystemFactory::Accuracy::MinorAndMajorBodies,
                    &FlowEphemerisWithAdaptiveStep)
     ->Arg(-3);
+BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
+                   SolarSystemFactory::Accuracy::MinorAndMajorBodies,
+                   &FlowEphemerisWithAdaptiveStepUsingEnckeMethod)
+    ->Arg(-3);
 BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
                    SolarSystemFactory::Accuracy::MinorAndMajorBodies,
                    &FlowEphemerisWithFixedStepSLMS)
@@ -638,6 +769,10 @@ BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
                    SolarSystemFactory::Accuracy::AllBodiesAndDampedOblateness,
                    &FlowEphemerisWithAdaptiveStep)
     ->Arg(-3);
+BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
+                   SolarSystemFactory::Accuracy::AllBodiesAndDampedOblateness,
+                   &FlowEphemerisWithAdaptiveStepUsingEnckeMethod)
+    ->Arg(-3);
 BENCHMARK_TEMPLATE(BM_EphemerisLEOProbe,
                    SolarSystemFactory::Accuracy::AllBodiesAndDampedOblateness,
                    &FlowEphemerisWithFixedStepSLMS)
@@ -679,5 +814,13 @@ BENCHMARK_TEMPLATE(BM_EphemerisStartup, &FlowEphemerisWithFixedStepSLMS)
 BENCHMARK_TEMPLATE(BM_EphemerisStartup, &FlowEphemerisWithFixedStepSRKN)
     ->Arg(3);
 
+BENCHMARK_TEMPLATE(BM_EphemerisCloseApproach, &FlowEphemerisWithAdaptiveStep)
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_TEMPLATE(BM_EphemerisCloseApproach,
+                   &FlowEphemerisWithAdaptiveStepAndRegularization)
+    ->Arg(0)
+    ->Arg(1);
+
 }  // namespace physics
 }  // namespace principia
@@ -7,6 +7,7 @@
 #include <random>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "benchmark/benchmark.h"
 #include "quantities/numbers.hpp"
 
@@ -83,9 +84,27 @@ void BM_FastSinCos2πThroughput(benchmark::State& state) {
   }
 }
 
+void BM_FastSinCos2πBatchThroughput(benchmark::State& state) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  std::vector<double> input;
+  for (int i = 0; i < 1e3; ++i) {
+    input.push_back(distribution(random));
+  }
+  std::vector<double> sin(input.size());
+  std::vector<double> cos(input.size());
+
+  while (state.KeepRunning()) {
+    FastSinCos2π(input, absl::MakeSpan(sin), absl::MakeSpan(cos));
+    benchmark::DoNotOptimize(sin.data());
+    benchmark::DoNotOptimize(cos.data());
+  }
+}
+
 BENCHMARK(BM_FastSinCos2πPoorlyPredictedLatency);
 BENCHMARK(BM_FastSinCos2πWellPredictedLatency);
 BENCHMARK(BM_FastSinCos2πThroughput);
+BENCHMARK(BM_FastSinCos2πBatchThroughput);
 
 }  // namespace numerics
 }  // namespace principia
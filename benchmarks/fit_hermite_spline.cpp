@@ -0,0 +1,76 @@
+﻿
+// .\Release\x64\benchmarks.exe --benchmark_repetitions=10 --benchmark_min_time=2 --benchmark_filter=FitHermiteSpline  // NOLINT(whitespace/line_length)
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "geometry/named_quantities.hpp"
+#include "numerics/double_precision.hpp"
+#include "numerics/fit_hermite_spline.hpp"
+#include "quantities/elementary_functions.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/si.hpp"
+
+namespace principia {
+
+using geometry::Instant;
+using quantities::AngularFrequency;
+using quantities::Cos;
+using quantities::Length;
+using quantities::Sin;
+using quantities::Speed;
+using quantities::si::Metre;
+using quantities::si::Milli;
+using quantities::si::Radian;
+using quantities::si::Second;
+
+namespace numerics {
+
+namespace {
+
+struct Sample {
+  Instant t;
+  Length x;
+  Speed v;
+};
+
+// A dense timeline of 100'000 samples of a sinusoid.
+std::vector<Sample> const& Samples() {
+  static std::vector<Sample> const samples = []() {
+    AngularFrequency const ω = 1 * Radian / Second;
+    Instant const t0;
+    std::vector<Sample> samples;
+    auto t = DoublePrecision<Instant>(t0);
+    for (int i = 0; i < 100'000; ++i, t.Increment(10 * Milli(Second))) {
+      samples.push_back({t.value,
+                         Cos(ω * (t.value - t0)) * Metre,
+                         -ω * Sin(ω * (t.value - t0)) * Metre / Radian});
+    }
+    return samples;
+  }();
+  return samples;
+}
+
+}  // namespace
+
+void BM_FitHermiteSpline(benchmark::State& state) {
+  auto const& samples = Samples();
+  std::vector<std::vector<Sample>::const_iterator> tail;
+  for (auto _ : state) {
+    FitHermiteSpline<Instant, Length>(
+        samples,
+        [](auto&& sample) -> auto&& { return sample.t; },
+        [](auto&& sample) -> auto&& { return sample.x; },
+        [](auto&& sample) -> auto&& { return sample.v; },
+        /*tolerance=*/1 * Milli(Metre),
+        tail);
+    benchmark::DoNotOptimize(tail);
+  }
+  state.SetLabel(std::to_string(tail.size()) + " polynomials");
+}
+
+BENCHMARK(BM_FitHermiteSpline);
+
+}  // namespace numerics
+}  // namespace principia
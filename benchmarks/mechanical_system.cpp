@@ -0,0 +1,155 @@
+﻿
+// .\Release\x64\benchmarks.exe --benchmark_repetitions=10 --benchmark_min_time=2 --benchmark_filter=(Barycentre|Moments)  // NOLINT(whitespace/line_length)
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "geometry/barycentre_calculator.hpp"
+#include "geometry/frame.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/named_quantities.hpp"
+#include "geometry/orthogonal_map.hpp"
+#include "geometry/symmetric_bilinear_form.hpp"
+#include "physics/degrees_of_freedom.hpp"
+#include "physics/mechanical_system.hpp"
+#include "physics/rigid_motion.hpp"
+#include "quantities/si.hpp"
+
+namespace principia {
+namespace physics {
+
+using geometry::AngularVelocity;
+using geometry::BarycentreCalculator;
+using geometry::Bivector;
+using geometry::Displacement;
+using geometry::Frame;
+using geometry::Inertial;
+using geometry::NonRotating;
+using geometry::OrthogonalMap;
+using geometry::Position;
+using geometry::R3x3Matrix;
+using geometry::RigidTransformation;
+using geometry::SymmetricBilinearForm;
+using geometry::Velocity;
+using quantities::Mass;
+using quantities::MomentOfInertia;
+using quantities::si::Kilogram;
+using quantities::si::Metre;
+using quantities::si::Radian;
+using quantities::si::Second;
+
+namespace {
+
+using World = Frame<enum class WorldTag, Inertial>;
+using System = Frame<enum class SystemTag, NonRotating>;
+using Part = Frame<enum class PartTag>;
+
+// The parts of a vessel in low orbit.
+std::vector<DegreesOfFreedom<World>> RandomDegreesOfFreedom(int const count) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution(-10, 10);
+  Position<World> const vessel =
+      World::origin +
+      Displacement<World>({7e6 * Metre, -3e6 * Metre, 1e6 * Metre});
+  Velocity<World> const vessel_velocity(
+      {1e3 * Metre / Second, 7e3 * Metre / Second, -2e3 * Metre / Second});
+  std::vector<DegreesOfFreedom<World>> degrees_of_freedom;
+  degrees_of_freedom.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    degrees_of_freedom.emplace_back(
+        vessel + Displacement<World>({distribution(random) * Metre,
+                                      distribution(random) * Metre,
+                                      distribution(random) * Metre}),
+        vessel_velocity +
+            Velocity<World>({distribution(random) * Metre / Second,
+                             distribution(random) * Metre / Second,
+                             distribution(random) * Metre / Second}));
+  }
+  return degrees_of_freedom;
+}
+
+std::vector<Mass> RandomMasses(int const count) {
+  std::mt19937_64 random(43);
+  std::uniform_real_distribution<> distribution(10, 1000);
+  std::vector<Mass> masses;
+  masses.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    masses.push_back(distribution(random) * Kilogram);
+  }
+  return masses;
+}
+
+MechanicalSystem<World, System> RandomMechanicalSystem(int const count) {
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(count);
+  auto const masses = RandomMasses(count);
+  SymmetricBilinearForm<MomentOfInertia, Part, Bivector> const inertia(
+      R3x3Matrix<MomentOfInertia>::Diagonal(
+          {1 * Kilogram * Metre * Metre,
+           2 * Kilogram * Metre * Metre,
+           3 * Kilogram * Metre * Metre}));
+  MechanicalSystem<World, System> system;
+  for (int i = 0; i < count; ++i) {
+    system.AddRigidBody(
+        RigidMotion<Part, World>(
+            RigidTransformation<Part, World>(
+                Part::origin,
+                degrees_of_freedom[i].position(),
+                OrthogonalMap<Part, World>::Identity()),
+            AngularVelocity<World>({0.1 * Radian / Second,
+                                    -0.2 * Radian / Second,
+                                    0.3 * Radian / Second}),
+            degrees_of_freedom[i].velocity()),
+        masses[i],
+        inertia);
+  }
+  return system;
+}
+
+}  // namespace
+
+void BM_BarycentreCalculatorAddEach(benchmark::State& state) {
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  auto const masses = RandomMasses(state.range(0));
+  for (auto _ : state) {
+    BarycentreCalculator<DegreesOfFreedom<World>, Mass> calculator;
+    for (int i = 0; i < degrees_of_freedom.size(); ++i) {
+      calculator.Add(degrees_of_freedom[i], masses[i]);
+    }
+    benchmark::DoNotOptimize(calculator.Get());
+  }
+}
+
+void BM_BarycentreCalculatorAddSpan(benchmark::State& state) {
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  auto const masses = RandomMasses(state.range(0));
+  for (auto _ : state) {
+    BarycentreCalculator<DegreesOfFreedom<World>, Mass> calculator;
+    calculator.Add(degrees_of_freedom, masses);
+    benchmark::DoNotOptimize(calculator.Get());
+  }
+}
+
+void BM_MechanicalSystemSeparateMoments(benchmark::State& state) {
+  auto const system = RandomMechanicalSystem(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(system.centre_of_mass());
+    benchmark::DoNotOptimize(system.AngularMomentum());
+    benchmark::DoNotOptimize(system.InertiaTensor());
+  }
+}
+
+void BM_MechanicalSystemComputeMoments(benchmark::State& state) {
+  auto const system = RandomMechanicalSystem(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(system.ComputeMoments());
+  }
+}
+
+BENCHMARK(BM_BarycentreCalculatorAddEach)->Arg(100)->Arg(1000);
+BENCHMARK(BM_BarycentreCalculatorAddSpan)->Arg(100)->Arg(1000);
+BENCHMARK(BM_MechanicalSystemSeparateMoments)->Arg(100)->Arg(1000);
+BENCHMARK(BM_MechanicalSystemComputeMoments)->Arg(100)->Arg(1000);
+
+}  // namespace physics
+}  // namespace principia
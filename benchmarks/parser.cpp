@@ -0,0 +1,62 @@
+﻿
+// .\Release\x64\benchmarks.exe --benchmark_repetitions=10 --benchmark_filter=Parse  // NOLINT(whitespace/line_length)
+
+#include "quantities/parser.hpp"
+
+#include "benchmark/benchmark.h"
+#include "physics/solar_system.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/quantities.hpp"
+
+namespace principia {
+namespace quantities {
+
+using physics::ParseGravityModel;
+
+// Parses all the quantities of the bodies of the gravity model, the way
+// |SolarSystem| does.
+void BM_ParseGravityModelQuantities(benchmark::State& state) {
+  auto const gravity_model = ParseGravityModel(
+      SOLUTION_DIR / "astronomy" / "sol_gravity_model.proto.txt");
+  std::int64_t quantities = 0;
+  while (state.KeepRunning()) {
+    for (auto const& body : gravity_model.body()) {
+      if (body.has_gravitational_parameter()) {
+        benchmark::DoNotOptimize(ParseQuantity<GravitationalParameter>(
+            body.gravitational_parameter()));
+        ++quantities;
+      }
+      if (body.has_mass()) {
+        benchmark::DoNotOptimize(ParseQuantity<Mass>(body.mass()));
+        ++quantities;
+      }
+      for (auto const* const length :
+           {&body.min_radius(), &body.mean_radius(), &body.max_radius(),
+            &body.reference_radius()}) {
+        if (!length->empty()) {
+          benchmark::DoNotOptimize(ParseQuantity<Length>(*length));
+          ++quantities;
+        }
+      }
+      for (auto const* const angle : {&body.axis_right_ascension(),
+                                      &body.axis_declination(),
+                                      &body.reference_angle()}) {
+        if (!angle->empty()) {
+          benchmark::DoNotOptimize(ParseQuantity<Angle>(*angle));
+          ++quantities;
+        }
+      }
+      if (body.has_angular_frequency()) {
+        benchmark::DoNotOptimize(
+            ParseQuantity<AngularFrequency>(body.angular_frequency()));
+        ++quantities;
+      }
+    }
+  }
+  state.SetItemsProcessed(quantities);
+}
+
+BENCHMARK(BM_ParseGravityModelQuantities);
+
+}  // namespace quantities
+}  // namespace principia
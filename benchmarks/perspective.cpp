@@ -134,7 +134,8 @@ void BM_VisibleSegmentsOrbit(benchmark::State& state) {
                                 static_cast<double>(visible_segments_count)));
 }
 
-void BM_VisibleSegmentsOrbitMultipleSpheres(benchmark::State& state) {
+void OrbitMultipleSpheresBenchmark(bool const use_hierarchy,
+                                   benchmark::State& state) {
   // The camera is slightly above the x-y plane and looks towards the positive
   // x-axis.
   Position<World> const camera_origin(
@@ -184,11 +185,22 @@ void BM_VisibleSegmentsOrbitMultipleSpheres(benchmark::State& state) {
   int visible_segments_count = 0;
   int visible_segments_size = 0;
   while (state.KeepRunning()) {
-    for (auto const& segment : segments) {
-      auto const visible_segments =
-          perspective.VisibleSegments(segment, spheres);
-      ++visible_segments_count;
-      visible_segments_size += visible_segments.size();
+    if (use_hierarchy) {
+      // The hierarchy is rebuilt for each plot, like in the plugin.
+      auto const hierarchy = perspective.ComputeSphereHierarchy(spheres);
+      for (auto const& segment : segments) {
+        auto const visible_segments =
+            perspective.VisibleSegments(segment, hierarchy);
+        ++visible_segments_count;
+        visible_segments_size += visible_segments.size();
+      }
+    } else {
+      for (auto const& segment : segments) {
+        auto const visible_segments =
+            perspective.VisibleSegments(segment, spheres);
+        ++visible_segments_count;
+        visible_segments_size += visible_segments.size();
+      }
     }
   }
 
@@ -197,6 +209,14 @@ void BM_VisibleSegmentsOrbitMultipleSpheres(benchmark::State& state) {
                                 static_cast<double>(visible_segments_count)));
 }
 
+void BM_VisibleSegmentsOrbitMultipleSpheres(benchmark::State& state) {
+  OrbitMultipleSpheresBenchmark(/*use_hierarchy=*/false, state);
+}
+
+void BM_VisibleSegmentsOrbitSphereHierarchy(benchmark::State& state) {
+  OrbitMultipleSpheresBenchmark(/*use_hierarchy=*/true, state);
+}
+
 void BM_VisibleSegmentsRandomEverywhere(benchmark::State& state) {
   // Generate random segments in the cube [-10, 10[³.
   std::uniform_real_distribution<> distribution(-10.0, 10.0);
@@ -217,7 +237,14 @@ void BM_VisibleSegmentsRandomNoIntersection(benchmark::State& state) {
 BENCHMARK(BM_VisibleSegmentsOrbit)->Arg(10)->Arg(100)->Arg(1000);
 BENCHMARK(BM_VisibleSegmentsRandomEverywhere)->Arg(1000);
 BENCHMARK(BM_VisibleSegmentsRandomNoIntersection)->Arg(1000);
-BENCHMARK(BM_VisibleSegmentsOrbitMultipleSpheres)->Args({1000, 20});
+BENCHMARK(BM_VisibleSegmentsOrbitMultipleSpheres)
+    ->Args({1000, 20})
+    ->Args({1000, 100})
+    ->Args({1000, 1000});
+BENCHMARK(BM_VisibleSegmentsOrbitSphereHierarchy)
+    ->Args({1000, 20})
+    ->Args({1000, 100})
+    ->Args({1000, 1000});
 
 }  // namespace geometry
 }  // namespace principia
@@ -1,12 +1,21 @@
 ﻿
+#include <algorithm>
+#include <memory>
+#include <numeric>
 #include <random>
+#include <sstream>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
 #include "astronomy/frames.hpp"
 #include "benchmark/benchmark.h"
 #include "geometry/grassmann.hpp"
 #include "geometry/named_quantities.hpp"
 #include "geometry/r3_element.hpp"
+#include "numerics/inline_polynomial.hpp"
 #include "numerics/polynomial.hpp"
 #include "numerics/polynomial_evaluators.hpp"
 #include "quantities/quantities.hpp"
@@ -15,9 +24,12 @@
 namespace principia {
 
 using astronomy::ICRS;
+using base::make_not_null_unique;
+using base::not_null;
 using geometry::Displacement;
 using geometry::Multivector;
 using geometry::R3Element;
+using quantities::Derivative;
 using quantities::Length;
 using quantities::Quantity;
 using quantities::SIUnit;
@@ -76,8 +88,20 @@ struct RandomTupleGenerator<Tuple, size, size> {
   static void Fill(Tuple& t, std::mt19937_64& random) {}
 };
 
+// What to compute in the benchmarks.
+enum class Evaluation {
+  Value,
+  // The value and the derivative, using two calls.
+  ValueAndDerivative,
+  // The value and the derivative, using |EvaluateWithDerivative|.
+  ValueWithDerivative,
+  // The value, using the overload of |Evaluate| that takes spans.
+  Batch,
+};
+
 template<typename Value, typename Argument, int degree,
-         template<typename, typename, int> class Evaluator>
+         template<typename, typename, int> class Evaluator,
+         Evaluation evaluation>
 void EvaluatePolynomialInMonomialBasis(benchmark::State& state) {
   using P = PolynomialInMonomialBasis<Value, Argument, degree, Evaluator>;
   std::mt19937_64 random(42);
@@ -90,157 +114,204 @@ void EvaluatePolynomialInMonomialBasis(benchmark::State& state) {
   auto argument = min;
   auto const Δargument = (max - min) * 1e-9;
   auto result = Value{};
+  auto derivative_result = Derivative<Value, Argument>{};
 
-  while (state.KeepRunning()) {
+  if constexpr (evaluation == Evaluation::Batch) {
+    std::vector<Argument> arguments;
     for (int i = 0; i < evaluations_per_iteration; ++i) {
-      result += p.Evaluate(argument);
+      arguments.push_back(argument);
       argument += Δargument;
     }
+    std::vector<Value> values(evaluations_per_iteration);
+    while (state.KeepRunning()) {
+      p.Evaluate(arguments, absl::MakeSpan(values));
+      result += values.back();
+    }
+  } else {
+    while (state.KeepRunning()) {
+      for (int i = 0; i < evaluations_per_iteration; ++i) {
+        if constexpr (evaluation == Evaluation::Value) {
+          result += p.Evaluate(argument);
+        } else if constexpr (evaluation == Evaluation::ValueAndDerivative) {
+          result += p.Evaluate(argument);
+          derivative_result += p.EvaluateDerivative(argument);
+        } else {
+          Value value;
+          Derivative<Value, Argument> derivative;
+          p.EvaluateWithDerivative(argument, value, derivative);
+          result += value;
+          derivative_result += derivative;
+        }
+        argument += Δargument;
+      }
+    }
   }
 
   // This weird call to |SetLabel| has no effect except that it uses |result|
   // and therefore prevents the loop from being optimized away.
   std::stringstream ss;
-  ss << result;
+  ss << result << derivative_result;
   state.SetLabel(ss.str().substr(0, 0));
 }
 
-template<template<typename, typename, int> class Evaluator>
-void BM_EvaluatePolynomialInMonomialBasisDouble(benchmark::State& state) {
+// Runs |EvaluatePolynomialInMonomialBasis| for the degree given by the argument
+// of the benchmark, which must be one of |degrees|.
+template<typename Value, typename Argument,
+         template<typename, typename, int> class Evaluator,
+         Evaluation evaluation,
+         int... degrees>
+void EvaluatePolynomialInMonomialBasisOfDegree(
+    benchmark::State& state,
+    std::integer_sequence<int, degrees...>) {
   int const degree = state.range_x();
-  switch (degree) {
-    case 4:
-      EvaluatePolynomialInMonomialBasis<double, Time, 4, Evaluator>(state);
-      break;
-    case 8:
-      EvaluatePolynomialInMonomialBasis<double, Time, 8, Evaluator>(state);
-      break;
-    case 12:
-      EvaluatePolynomialInMonomialBasis<double, Time, 12, Evaluator>(state);
-      break;
-    case 16:
-      EvaluatePolynomialInMonomialBasis<double, Time, 16, Evaluator>(state);
-      break;
-    default:
-      LOG(FATAL) << "Degree " << degree
-                 << " in BM_EvaluatePolynomialInMonomialBasisDouble";
-  }
+  bool const found =
+      ((degree == degrees &&
+        (EvaluatePolynomialInMonomialBasis<Value, Argument, degrees,
+                                           Evaluator, evaluation>(state),
+         true)) || ...);
+  CHECK(found) << "Degree " << degree;
 }
 
-template<template<typename, typename, int> class Evaluator>
-void BM_EvaluatePolynomialInMonomialBasisQuantity(benchmark::State& state) {
-  int const degree = state.range_x();
-  switch (degree) {
-    case 4:
-      EvaluatePolynomialInMonomialBasis<Length, Time, 4, Evaluator>(state);
-      break;
-    case 8:
-      EvaluatePolynomialInMonomialBasis<Length, Time, 8, Evaluator>(state);
-      break;
-    case 12:
-      EvaluatePolynomialInMonomialBasis<Length, Time, 12, Evaluator>(state);
-      break;
-    case 16:
-      EvaluatePolynomialInMonomialBasis<Length, Time, 16, Evaluator>(state);
-      break;
-    default:
-      LOG(FATAL) << "Degree " << degree
-                 << " in BM_EvaluatePolynomialInMonomialBasisQuantity";
-  }
+// The degrees of the polynomials in the benchmarks are between
+// |min_degree| and |min_degree + number_of_degrees - 1|.
+constexpr int min_degree = 3;
+constexpr int number_of_degrees = 15;
+using Degrees = decltype(
+    std::make_integer_sequence<int, min_degree + number_of_degrees>());
+
+template<typename Value,
+         template<typename, typename, int> class Evaluator,
+         Evaluation evaluation = Evaluation::Value>
+void BM_EvaluatePolynomialInMonomialBasis(benchmark::State& state) {
+  EvaluatePolynomialInMonomialBasisOfDegree<Value, Time, Evaluator, evaluation>(
+      state, Degrees());
 }
 
-template<template<typename, typename, int> class Evaluator>
-void BM_EvaluatePolynomialInMonomialBasisVectorDouble(benchmark::State& state) {
-  int const degree = state.range_x();
-  switch (degree) {
-    case 4:
-      EvaluatePolynomialInMonomialBasis<Multivector<double, ICRS, 1>,
-                                        Time,
-                                        4,
-                                        Evaluator>(state);
-      break;
-    case 8:
-      EvaluatePolynomialInMonomialBasis<Multivector<double, ICRS, 1>,
-                                        Time,
-                                        8,
-                                        Evaluator>(state);
-      break;
-    case 12:
-      EvaluatePolynomialInMonomialBasis<Multivector<double, ICRS, 1>,
-                                        Time,
-                                        12,
-                                        Evaluator>(state);
-      break;
-    case 16:
-      EvaluatePolynomialInMonomialBasis<Multivector<double, ICRS, 1>,
-                                        Time,
-                                        16,
-                                        Evaluator>(state);
-      break;
-    default:
-      LOG(FATAL) << "Degree " << degree
-                 << " in BM_EvaluatePolynomialInMonomialBasisVectorDouble";
-  }
+#define PRINCIPIA_POLYNOMIAL_BENCHMARK(...)                        \
+  BENCHMARK_TEMPLATE(BM_EvaluatePolynomialInMonomialBasis, __VA_ARGS__) \
+      ->DenseRange(min_degree, min_degree + number_of_degrees - 1)
+
+PRINCIPIA_POLYNOMIAL_BENCHMARK(double, EstrinEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Length, EstrinEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Multivector<double, ICRS, 1>, EstrinEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>, EstrinEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>,
+                               EstrinEvaluator,
+                               Evaluation::ValueAndDerivative);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>,
+                               EstrinEvaluator,
+                               Evaluation::ValueWithDerivative);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(double, HornerEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Length, HornerEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Multivector<double, ICRS, 1>, HornerEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>, HornerEvaluator);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>,
+                               HornerEvaluator,
+                               Evaluation::ValueAndDerivative);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>,
+                               HornerEvaluator,
+                               Evaluation::ValueWithDerivative);
+
+PRINCIPIA_POLYNOMIAL_BENCHMARK(double, EstrinEvaluator, Evaluation::Batch);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Length, EstrinEvaluator, Evaluation::Batch);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>,
+                               EstrinEvaluator,
+                               Evaluation::Batch);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(double, HornerEvaluator, Evaluation::Batch);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Length, HornerEvaluator, Evaluation::Batch);
+PRINCIPIA_POLYNOMIAL_BENCHMARK(Displacement<ICRS>,
+                               HornerEvaluator,
+                               Evaluation::Batch);
+
+#undef PRINCIPIA_POLYNOMIAL_BENCHMARK
+
+// Appends to |polynomials| a random polynomial of the given |degree|, which
+// must be |min_degree + indices| for one of the |indices|.
+template<typename Value, bool inline_polynomials,
+         typename Polynomials, int... indices>
+void AppendRandomPolynomial(int const degree,
+                            std::mt19937_64& random,
+                            std::integer_sequence<int, indices...>,
+                            Polynomials& polynomials) {
+  bool const found =
+      ((degree == min_degree + indices &&
+        ([&random, &polynomials]() {
+           using P = PolynomialInMonomialBasis<Value,
+                                               Time,
+                                               min_degree + indices,
+                                               EstrinEvaluator>;
+           typename P::Coefficients coefficients;
+           RandomTupleGenerator<typename P::Coefficients, 0>::Fill(
+               coefficients, random);
+           if constexpr (inline_polynomials) {
+             polynomials.push_back(P(coefficients));
+           } else {
+             polynomials.push_back(make_not_null_unique<P>(coefficients));
+           }
+         }(),
+         true)) || ...);
+  CHECK(found) << "Degree " << degree;
 }
 
-template<template<typename, typename, int> class Evaluator>
-void BM_EvaluatePolynomialInMonomialBasisDisplacement(benchmark::State& state) {
-  int const degree = state.range_x();
-  switch (degree) {
-    case 4:
-      EvaluatePolynomialInMonomialBasis<Displacement<ICRS>,
-                                        Time,
-                                        4,
-                                        Evaluator>(state);
-      break;
-    case 8:
-      EvaluatePolynomialInMonomialBasis<Displacement<ICRS>,
-                                        Time,
-                                        8,
-                                        Evaluator>(state);
-      break;
-    case 12:
-      EvaluatePolynomialInMonomialBasis<Displacement<ICRS>,
-                                        Time,
-                                        12,
-                                        Evaluator>(state);
-      break;
-    case 16:
-      EvaluatePolynomialInMonomialBasis<Displacement<ICRS>,
-                                        Time,
-                                        16,
-                                        Evaluator>(state);
-      break;
-    default:
-      LOG(FATAL) << "Degree " << degree
-                 << " in BM_EvaluatePolynomialInMonomialBasisDisplacement";
+// Evaluates polynomials stored in a vector in random order, as is done when
+// evaluating the |ContinuousTrajectory|s of many bodies, either through
+// pointers to |Polynomial| (and thus through virtual calls) or through
+// |InlinePolynomial|.  The first argument of the benchmark is the number of
+// polynomials, the second their degree, or 0 for random degrees.
+template<typename Value, bool inline_polynomials>
+void BM_EvaluatePolynomials(benchmark::State& state) {
+  using Polynomials = std::vector<std::conditional_t<
+      inline_polynomials,
+      InlinePolynomial<Value,
+                       Time,
+                       min_degree + number_of_degrees - 1,
+                       EstrinEvaluator>,
+      not_null<std::unique_ptr<Polynomial<Value, Time>>>>>;
+  int const number_of_polynomials = state.range_x();
+  int const degree = state.range_y();
+  std::mt19937_64 random(42);
+  std::uniform_int_distribution<> degree_distribution(
+      min_degree, min_degree + number_of_degrees - 1);
+  Polynomials polynomials;
+  for (int i = 0; i < number_of_polynomials; ++i) {
+    AppendRandomPolynomial<Value, inline_polynomials>(
+        degree == 0 ? degree_distribution(random) : degree,
+        random,
+        std::make_integer_sequence<int, number_of_degrees>(),
+        polynomials);
+  }
+  std::vector<int> order(number_of_polynomials);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), random);
+
+  Time const argument = ValueGenerator<Time>::Get(random);
+  auto result = Value{};
+  for (auto _ : state) {
+    for (int const i : order) {
+      if constexpr (inline_polynomials) {
+        result += polynomials[i].Evaluate(argument);
+      } else {
+        result += polynomials[i]->Evaluate(argument);
+      }
+    }
   }
+  benchmark::DoNotOptimize(result);
 }
 
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisDouble,
-                    EstrinEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisQuantity,
-                    EstrinEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisVectorDouble,
-                    EstrinEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisDisplacement,
-                    EstrinEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisDouble,
-                    HornerEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisQuantity,
-                    HornerEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisVectorDouble,
-                    HornerEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
-BENCHMARK_TEMPLATE1(BM_EvaluatePolynomialInMonomialBasisDisplacement,
-                    HornerEvaluator)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16);
+BENCHMARK_TEMPLATE(BM_EvaluatePolynomials,
+                   Displacement<ICRS>,
+                   /*inline_polynomials=*/false)
+    ->ArgPair(1'000, 10)
+    ->ArgPair(100'000, 10)
+    ->ArgPair(1'000, 0)
+    ->ArgPair(100'000, 0);
+BENCHMARK_TEMPLATE(BM_EvaluatePolynomials,
+                   Displacement<ICRS>,
+                   /*inline_polynomials=*/true)
+    ->ArgPair(1'000, 10)
+    ->ArgPair(100'000, 10)
+    ->ArgPair(1'000, 0)
+    ->ArgPair(100'000, 0);
 
 }  // namespace numerics
 }  // namespace principia
@@ -0,0 +1,182 @@
+﻿// .\Release\x64\benchmarks.exe --benchmark_repetitions=10 --benchmark_min_time=2 --benchmark_filter=Apply  // NOLINT(whitespace/line_length)
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "geometry/frame.hpp"
+#include "geometry/fused_orthogonal_map.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/named_quantities.hpp"
+#include "geometry/orthogonal_map.hpp"
+#include "geometry/rotation.hpp"
+#include "physics/degrees_of_freedom.hpp"
+#include "physics/rigid_motion.hpp"
+#include "quantities/si.hpp"
+
+namespace principia {
+namespace physics {
+
+using geometry::AngularVelocity;
+using geometry::Bivector;
+using geometry::Displacement;
+using geometry::Frame;
+using geometry::Fuse;
+using geometry::Inertial;
+using geometry::NonRotating;
+using geometry::OrthogonalMap;
+using geometry::Position;
+using geometry::RigidTransformation;
+using geometry::Rotation;
+using geometry::Velocity;
+using quantities::Length;
+using quantities::Speed;
+using quantities::si::Metre;
+using quantities::si::Radian;
+using quantities::si::Second;
+
+namespace {
+
+using From = Frame<enum class FromTag, Inertial>;
+using To = Frame<enum class ToTag, NonRotating>;
+
+RigidMotion<From, To> MakeRigidMotion() {
+  Rotation<From, To> const rotation(
+      1.2 * Radian,
+      Bivector<double, From>({1, -2, 3}),
+      geometry::DefinesFrame<To>{});
+  return RigidMotion<From, To>(
+      RigidTransformation<From, To>(
+          From::origin + Displacement<From>({1 * Metre, 2 * Metre, 3 * Metre}),
+          To::origin,
+          rotation.Forget<OrthogonalMap>()),
+      AngularVelocity<From>({0.1 * Radian / Second,
+                             -0.2 * Radian / Second,
+                             0.3 * Radian / Second}),
+      Velocity<From>({4 * Metre / Second,
+                      5 * Metre / Second,
+                      6 * Metre / Second}));
+}
+
+std::vector<DegreesOfFreedom<From>> RandomDegreesOfFreedom(int const count) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution(-1e6, 1e6);
+  std::vector<DegreesOfFreedom<From>> degrees_of_freedom;
+  degrees_of_freedom.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    degrees_of_freedom.emplace_back(
+        From::origin + Displacement<From>({distribution(random) * Metre,
+                                           distribution(random) * Metre,
+                                           distribution(random) * Metre}),
+        Velocity<From>({distribution(random) * Metre / Second,
+                        distribution(random) * Metre / Second,
+                        distribution(random) * Metre / Second}));
+  }
+  return degrees_of_freedom;
+}
+
+}  // namespace
+
+void BM_ApplyRotationToEachVector(benchmark::State& state) {
+  auto const rotation = MakeRigidMotion().orthogonal_map();
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  std::vector<Velocity<From>> velocities;
+  for (auto const& dof : degrees_of_freedom) {
+    velocities.push_back(dof.velocity());
+  }
+  for (auto _ : state) {
+    std::vector<Velocity<To>> images;
+    images.reserve(velocities.size());
+    for (auto const& velocity : velocities) {
+      images.push_back(rotation(velocity));
+    }
+    benchmark::DoNotOptimize(images);
+  }
+}
+
+void BM_ApplyRotationToVectors(benchmark::State& state) {
+  auto const rotation = MakeRigidMotion().orthogonal_map();
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  std::vector<Velocity<From>> velocities;
+  for (auto const& dof : degrees_of_freedom) {
+    velocities.push_back(dof.velocity());
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rotation(absl::MakeConstSpan(velocities)));
+  }
+}
+
+void BM_ApplyRigidMotionToEachDegreesOfFreedom(benchmark::State& state) {
+  auto const rigid_motion = MakeRigidMotion();
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  for (auto _ : state) {
+    std::vector<DegreesOfFreedom<To>> images;
+    images.reserve(degrees_of_freedom.size());
+    for (auto const& dof : degrees_of_freedom) {
+      images.push_back(rigid_motion(dof));
+    }
+    benchmark::DoNotOptimize(images);
+  }
+}
+
+void BM_ApplyRigidMotionToDegreesOfFreedom(benchmark::State& state) {
+  auto const rigid_motion = MakeRigidMotion();
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        rigid_motion(absl::MakeConstSpan(degrees_of_freedom)));
+  }
+}
+
+void BM_ApplyRigidTransformationToEachPosition(benchmark::State& state) {
+  auto const rigid_transformation = MakeRigidMotion().rigid_transformation();
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  for (auto _ : state) {
+    std::vector<Position<To>> images;
+    images.reserve(degrees_of_freedom.size());
+    for (auto const& dof : degrees_of_freedom) {
+      images.push_back(rigid_transformation(dof.position()));
+    }
+    benchmark::DoNotOptimize(images);
+  }
+}
+
+void BM_ApplyFusedRigidTransformationToEachPosition(benchmark::State& state) {
+  auto const rigid_transformation =
+      Fuse(MakeRigidMotion().rigid_transformation());
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  for (auto _ : state) {
+    std::vector<Position<To>> images;
+    images.reserve(degrees_of_freedom.size());
+    for (auto const& dof : degrees_of_freedom) {
+      images.push_back(rigid_transformation(dof.position()));
+    }
+    benchmark::DoNotOptimize(images);
+  }
+}
+
+void BM_ApplyRigidTransformationToPositions(benchmark::State& state) {
+  auto const rigid_transformation = MakeRigidMotion().rigid_transformation();
+  auto const degrees_of_freedom = RandomDegreesOfFreedom(state.range(0));
+  std::vector<Position<From>> positions;
+  for (auto const& dof : degrees_of_freedom) {
+    positions.push_back(dof.position());
+  }
+  std::vector<Position<To>> images(positions.size());
+  for (auto _ : state) {
+    rigid_transformation(absl::MakeConstSpan(positions),
+                         absl::MakeSpan(images));
+    benchmark::DoNotOptimize(images);
+  }
+}
+
+BENCHMARK(BM_ApplyRotationToEachVector)->Arg(1000);
+BENCHMARK(BM_ApplyRotationToVectors)->Arg(1000);
+BENCHMARK(BM_ApplyRigidMotionToEachDegreesOfFreedom)->Arg(1000);
+BENCHMARK(BM_ApplyRigidMotionToDegreesOfFreedom)->Arg(1000);
+BENCHMARK(BM_ApplyRigidTransformationToEachPosition)->Arg(1000);
+BENCHMARK(BM_ApplyFusedRigidTransformationToEachPosition)->Arg(1000);
+BENCHMARK(BM_ApplyRigidTransformationToPositions)->Arg(1000);
+
+}  // namespace physics
+}  // namespace principia
@@ -0,0 +1,71 @@
+﻿
+// .\Release\x64\benchmarks.exe --benchmark_repetitions=3 --benchmark_filter=KeplerEquation  // NOLINT(whitespace/line_length)
+
+#include "numerics/root_finders.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "quantities/numbers.hpp"
+
+namespace principia {
+namespace numerics {
+
+namespace {
+
+// The equation E - e sin E = M, which counts its evaluations.
+struct KeplerEquation {
+  double operator()(double const eccentric_anomaly) const {
+    ++*evaluations;
+    return eccentric_anomaly - eccentricity * std::sin(eccentric_anomaly) -
+           mean_anomaly;
+  }
+
+  double eccentricity;
+  double mean_anomaly;
+  int* evaluations;
+};
+
+using RootFinder = double (*)(KeplerEquation f,
+                              double const& lower_bound,
+                              double const& upper_bound);
+
+}  // namespace
+
+template<RootFinder find_root>
+void BM_KeplerEquation(benchmark::State& state) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> eccentricity_distribution(0, 0.99);
+  std::uniform_real_distribution<> mean_anomaly_distribution(0, π);
+  std::vector<std::pair<double, double>> eccentricities_and_mean_anomalies;
+  for (int i = 0; i < 1000; ++i) {
+    eccentricities_and_mean_anomalies.emplace_back(
+        eccentricity_distribution(random), mean_anomaly_distribution(random));
+  }
+
+  int evaluations = 0;
+  std::int64_t roots = 0;
+  while (state.KeepRunning()) {
+    for (auto const& [eccentricity, mean_anomaly] :
+         eccentricities_and_mean_anomalies) {
+      benchmark::DoNotOptimize(
+          find_root(KeplerEquation{eccentricity, mean_anomaly, &evaluations},
+                    0,
+                    π));
+      ++roots;
+    }
+  }
+  state.SetLabel(std::to_string(static_cast<double>(evaluations) / roots) +
+                 " evaluations per root");
+}
+
+BENCHMARK_TEMPLATE(BM_KeplerEquation, &Bisect<double, KeplerEquation>);
+BENCHMARK_TEMPLATE(BM_KeplerEquation, &Brent<double, KeplerEquation>);
+BENCHMARK_TEMPLATE(BM_KeplerEquation, &Chandrupatla<double, KeplerEquation>);
+
+}  // namespace numerics
+}  // namespace principia
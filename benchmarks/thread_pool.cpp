@@ -7,6 +7,7 @@
 
 #include "absl/synchronization/mutex.h"
 #include "base/thread_pool.hpp"
+#include "base/work_stealing_executor.hpp"
 #include "benchmark/benchmark.h"
 
 namespace principia {
@@ -46,6 +47,19 @@ double ComsumeCpuExclusiveLock(std::int64_t const n) {
   return result;
 }
 
+// The number of small tasks in the fan-out/fan-in benchmarks, and the amount
+// of computation in each of them.
+constexpr int small_tasks = 10'000;
+constexpr std::int64_t small_task_size = 1000;
+
+double ConsumeCpu(std::int64_t const n) {
+  double result = 0;
+  for (int i = 0; i < n; ++i) {
+    result += std::sqrt(i);
+  }
+  return result;
+}
+
 void BM_ThreadPoolNoLock(benchmark::State& state) {
   ThreadPool<void> pool(/*pool_size=*/state.range_x());
   std::vector<std::int64_t> results;
@@ -97,6 +111,66 @@ void BM_ThreadPoolExclusiveLock(benchmark::State& state) {
   }
 }
 
+// Fan-out/fan-in: 10 000 small tasks are added from the benchmark thread and
+// waited for.
+void BM_ThreadPoolFanOutFanIn(benchmark::State& state) {
+  ThreadPool<void> pool(/*pool_size=*/state.range(0));
+  for (auto _ : state) {
+    std::vector<std::future<void>> futures;
+    futures.reserve(small_tasks);
+    for (int i = 0; i < small_tasks; ++i) {
+      futures.push_back(pool.Add([]() {
+        double const result = ConsumeCpu(small_task_size);
+        benchmark::DoNotOptimize(result);
+      }));
+    }
+    for (auto const& future : futures) {
+      future.wait();
+    }
+  }
+}
+
+void BM_WorkStealingExecutorFanOutFanIn(benchmark::State& state) {
+  WorkStealingExecutor executor(/*number_of_workers=*/state.range(0));
+  for (auto _ : state) {
+    Completion completion;
+    for (int i = 0; i < small_tasks; ++i) {
+      executor.Add(
+          []() {
+            double const result = ConsumeCpu(small_task_size);
+            benchmark::DoNotOptimize(result);
+          },
+          &completion);
+    }
+    completion.Wait();
+  }
+}
+
+// Same as above, but the tasks are added by 100 tasks running on the executor,
+// so they start on the deques of the workers that run these tasks.
+void BM_WorkStealingExecutorNestedFanOutFanIn(benchmark::State& state) {
+  constexpr int parent_tasks = 100;
+  WorkStealingExecutor executor(/*number_of_workers=*/state.range(0));
+  for (auto _ : state) {
+    Completion completion;
+    for (int i = 0; i < parent_tasks; ++i) {
+      executor.Add(
+          [&executor, &completion]() {
+            for (int j = 0; j < small_tasks / parent_tasks; ++j) {
+              executor.Add(
+                  []() {
+                    double const result = ConsumeCpu(small_task_size);
+                    benchmark::DoNotOptimize(result);
+                  },
+                  &completion);
+            }
+          },
+          &completion);
+    }
+    completion.Wait();
+  }
+}
+
 BENCHMARK(BM_ThreadPoolNoLock)
     ->Arg(1)
     ->Arg(2)
@@ -125,5 +199,13 @@ BENCHMARK(BM_ThreadPoolExclusiveLock)
     ->Arg(7)
     ->Arg(8);
 
+BENCHMARK(BM_ThreadPoolFanOutFanIn)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+BENCHMARK(BM_WorkStealingExecutorFanOutFanIn)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+BENCHMARK(BM_WorkStealingExecutorNestedFanOutFanIn)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
+
 }  // namespace base
 }  // namespace principia
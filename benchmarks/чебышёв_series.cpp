@@ -22,6 +22,7 @@
 #include <random>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "astronomy/frames.hpp"
 #include "benchmark/benchmark.h"
 #include "geometry/named_quantities.hpp"
@@ -205,6 +206,75 @@ void BM_EvaluateDisplacement(benchmark::State& state) {
   state.SetLabel(ss.str().substr(0, 0));
 }
 
+void BM_EvaluateDoubleBatch(benchmark::State& state) {
+  int const degree = state.range_x();
+  std::mt19937_64 random(42);
+  std::vector<double> coefficients;
+  for (int i = 0; i <= degree; ++i) {
+    coefficients.push_back(static_cast<double>(random()));
+  }
+  Instant const t0;
+  Instant const t_min = t0 + static_cast<double>(random()) * Second;
+  Instant const t_max = t_min + static_cast<double>(random()) * Second;
+  ЧебышёвSeries<double> const series(coefficients, t_min, t_max);
+
+  Instant t = t_min;
+  Time const Δt = (t_max - t_min) * 1e-9;
+  std::vector<Instant> times;
+  for (int i = 0; i < evaluations_per_iteration; ++i) {
+    times.push_back(t);
+    t += Δt;
+  }
+  std::vector<double> values(evaluations_per_iteration);
+  double result = 0.0;
+
+  while (state.KeepRunning()) {
+    series.Evaluate(times, absl::MakeSpan(values));
+    result += values.back();
+  }
+
+  // This weird call to |SetLabel| has no effect except that it uses |result|
+  // and therefore prevents the loop from being optimized away.
+  state.SetLabel(std::to_string(result).substr(0, 0));
+}
+
+void BM_EvaluateDisplacementBatch(benchmark::State& state) {
+  int const degree = state.range_x();
+  std::mt19937_64 random(42);
+  std::vector<Displacement<ICRS>> coefficients;
+  for (int i = 0; i <= degree; ++i) {
+    coefficients.push_back(
+        Displacement<ICRS>({static_cast<double>(random()) * Metre,
+                            static_cast<double>(random()) * Metre,
+                            static_cast<double>(random()) * Metre}));
+  }
+  Instant const t0;
+  Instant const t_min = t0 + static_cast<double>(random()) * Second;
+  Instant const t_max = t_min + static_cast<double>(random()) * Second;
+  ЧебышёвSeries<Displacement<ICRS>> const series(coefficients, t_min, t_max);
+
+  Instant t = t_min;
+  Time const Δt = (t_max - t_min) * 1e-9;
+  std::vector<Instant> times;
+  for (int i = 0; i < evaluations_per_iteration; ++i) {
+    times.push_back(t);
+    t += Δt;
+  }
+  std::vector<Displacement<ICRS>> values(evaluations_per_iteration);
+  Displacement<ICRS> result{};
+
+  while (state.KeepRunning()) {
+    series.Evaluate(times, absl::MakeSpan(values));
+    result += values.back();
+  }
+
+  // This weird call to |SetLabel| has no effect except that it uses |result|
+  // and therefore prevents the loop from being optimized away.
+  std::stringstream ss;
+  ss << result;
+  state.SetLabel(ss.str().substr(0, 0));
+}
+
 BENCHMARK(BM_EvaluateDouble)->
     Arg(4)->Arg(8)->Arg(15)->Arg(16)->Arg(17)->Arg(18)->Arg(19);
 BENCHMARK(BM_EvaluateQuantity)->
@@ -215,6 +285,10 @@ BENCHMARK(BM_EvaluateVectorDouble)->
     Arg(4)->Arg(8)->Arg(15)->Arg(16)->Arg(17)->Arg(18)->Arg(19);
 BENCHMARK(BM_EvaluateDisplacement)->
     Arg(4)->Arg(8)->Arg(15)->Arg(16)->Arg(17)->Arg(18)->Arg(19);
+BENCHMARK(BM_EvaluateDoubleBatch)->
+    Arg(4)->Arg(8)->Arg(15)->Arg(16)->Arg(17)->Arg(18)->Arg(19);
+BENCHMARK(BM_EvaluateDisplacementBatch)->
+    Arg(4)->Arg(8)->Arg(15)->Arg(16)->Arg(17)->Arg(18)->Arg(19);
 
 }  // namespace numerics
 }  // namespace principia
@@ -1,6 +1,10 @@
 ﻿
 #pragma once
 
+#include <vector>
+
+#include "absl/types/span.h"
+#include "base/macros.hpp"
 #include "base/traits.hpp"
 #include "geometry/point.hpp"
 #include "geometry/grassmann.hpp"
@@ -8,6 +12,11 @@
 
 namespace principia {
 namespace geometry {
+
+FORWARD_DECLARE_FROM(fused_orthogonal_map,
+                     TEMPLATE(typename FromFrame, typename ToFrame) class,
+                     FusedOrthogonalMap);
+
 namespace internal_affine_map {
 
 using base::not_null;
@@ -26,6 +35,19 @@ class AffineMap final {
   AffineMap<ToFrame, FromFrame, Scalar, LinearMap> Inverse() const;
   Point<ToVector> operator()(Point<FromVector> const& point) const;
 
+  // Applies this map to all the elements of |points| and stores the results in
+  // the corresponding elements of |images|, which must have the same size.
+  // Only available if |LinearMap| is orthogonal: it is fused into a matrix
+  // once, and each point goes through a single matrix-vector product, see
+  // |MultiplyEach|.  The results may differ in the last bits from those of
+  // the preceding function.
+  void operator()(absl::Span<Point<FromVector> const> points,
+                  absl::Span<Point<ToVector>> images) const;
+
+  // Same as above, but returns the images.
+  std::vector<Point<ToVector>> operator()(
+      absl::Span<Point<FromVector> const> points) const;
+
   template<typename F = FromFrame,
            typename T = ToFrame,
            typename = std::enable_if_t<F::handedness == T::handedness>>
@@ -1,8 +1,13 @@
 ﻿
 #pragma once
 
+#include <vector>
+
 #include "geometry/point.hpp"
+#include "geometry/fused_orthogonal_map.hpp"
 #include "geometry/grassmann.hpp"
+#include "geometry/r3_element.hpp"
+#include "geometry/r3x3_matrix.hpp"
 #include "affine_map.hpp"
 
 namespace principia {
@@ -42,6 +47,36 @@ AffineMap<FromFrame, ToFrame, Scalar, LinearMap>::operator()(
           linear_map_(point - from_origin_) + to_origin_);
 }
 
+template<typename FromFrame, typename ToFrame, typename Scalar,
+         template<typename, typename> class LinearMap>
+void AffineMap<FromFrame, ToFrame, Scalar, LinearMap>::operator()(
+    absl::Span<Point<FromVector> const> const points,
+    absl::Span<Point<ToVector>> const images) const {
+  // The origins are applied within the kernel, so that the points are only
+  // traversed once and the images are written directly to |images|.
+  MultiplyEach<Scalar>(
+      FusedOrthogonalMap<FromFrame, ToFrame>(linear_map_).matrix(),
+      points,
+      [this](Point<FromVector> const& point) {
+        return (point - from_origin_).coordinates();
+      },
+      [this](R3Element<Scalar> const& product) {
+        return ToVector(product) + to_origin_;
+      },
+      images);
+}
+
+template<typename FromFrame, typename ToFrame, typename Scalar,
+         template<typename, typename> class LinearMap>
+std::vector<
+    Point<typename AffineMap<FromFrame, ToFrame, Scalar, LinearMap>::ToVector>>
+AffineMap<FromFrame, ToFrame, Scalar, LinearMap>::operator()(
+    absl::Span<Point<FromVector> const> const points) const {
+  std::vector<Point<ToVector>> images(points.size());
+  (*this)(points, absl::MakeSpan(images));
+  return images;
+}
+
 template<typename FromFrame, typename ToFrame, typename Scalar,
          template<typename, typename> class LinearMap>
 template<typename F, typename T, typename>
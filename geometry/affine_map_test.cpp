@@ -112,6 +112,24 @@ TEST_F(AffineMapTest, Cube) {
   }
 }
 
+TEST_F(AffineMapTest, AppliedToPoints) {
+  Rot const rotate_left(π / 2 * Radian,
+                        Bivector<Length, World>(upward_.coordinates()));
+  RigidTransformation const map = RigidTransformation(back_right_bottom_,
+                                                      front_right_bottom_,
+                                                      rotate_left);
+  std::vector<Position<World>> const images =
+      map(absl::MakeConstSpan(vertices_));
+  ASSERT_EQ(vertices_.size(), images.size());
+  for (std::size_t i = 0; i < vertices_.size(); ++i) {
+    EXPECT_THAT(images[i] - origin_,
+                AlmostEquals(map(vertices_[i]) - origin_, 0, 2));
+  }
+  std::vector<Position<World>> written_images(vertices_.size());
+  map(absl::MakeConstSpan(vertices_), absl::MakeSpan(written_images));
+  EXPECT_EQ(images, written_images);
+}
+
 TEST_F(AffineMapTest, Serialization) {
   serialization::AffineMap message;
   Rot const rotate_left(π / 2 * Radian,
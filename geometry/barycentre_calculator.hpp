@@ -1,9 +1,12 @@
 ﻿
 #pragma once
 
+#include <cstdint>
+#include <tuple>
 #include <vector>
 #include <utility>
 
+#include "absl/types/span.h"
 #include "quantities/named_quantities.hpp"
 
 namespace principia {
@@ -19,6 +22,9 @@ class BarycentreCalculator final {
   BarycentreCalculator() = default;
 
   void Add(Vector const& vector, Scalar const& weight);
+  // Equivalent to calling |Add(vectors[i], weights[i])| for all i, but the
+  // sums are computed by |PairwiseSum|, which is faster and more accurate.
+  void Add(absl::Span<Vector const> vectors, absl::Span<Scalar const> weights);
   Vector Get() const;
 
   // The sum of the weights added so far.
@@ -30,6 +36,17 @@ class BarycentreCalculator final {
   Scalar weight_;
 };
 
+// Returns the tuple of the sums of the elements of |terms(i)| for
+// 0 ≤ i < |size|, where |terms(i)| returns a tuple whose elements are
+// convertible to |Sums...|.  The sums are computed pairwise: short runs of
+// consecutive terms are added naively, and the partial sums are then added in
+// a balanced tree.  The rounding error grows as O(ε log n) instead of O(ε n)
+// for naive summation, and the independent partial sums expose instruction-
+// level parallelism.  All the sums are accumulated in a single traversal of
+// the terms.
+template<typename... Sums, typename Terms>
+std::tuple<Sums...> PairwiseSum(std::int64_t size, Terms const& terms);
+
 // |T| is anything for which a specialization of BarycentreCalculator exists.
 template<typename T, typename Scalar>
 T Barycentre(std::pair<T, T> const& ts,
@@ -41,6 +58,7 @@ T Barycentre(Container<T> const& ts, Container<Scalar> const& weights);
 
 using internal_barycentre_calculator::Barycentre;
 using internal_barycentre_calculator::BarycentreCalculator;
+using internal_barycentre_calculator::PairwiseSum;
 
 }  // namespace geometry
 }  // namespace principia
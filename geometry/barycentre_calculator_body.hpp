@@ -12,6 +12,36 @@ namespace principia {
 namespace geometry {
 namespace internal_barycentre_calculator {
 
+// The number of consecutive terms added naively by |PairwiseSum|.  Large
+// enough to amortize the recursion, small enough to keep the error low.
+constexpr std::int64_t pairwise_summation_block_size = 16;
+
+template<typename... Sums, typename Terms, std::size_t... indices>
+void AddTo(std::tuple<Sums...>& sums,
+           Terms const& terms,
+           std::index_sequence<indices...>) {
+  ((std::get<indices>(sums) += std::get<indices>(terms)), ...);
+}
+
+template<typename... Sums, typename Terms>
+std::tuple<Sums...> PairwiseSum(std::int64_t const begin,
+                                std::int64_t const end,
+                                Terms const& terms) {
+  std::tuple<Sums...> sums;
+  if (end - begin <= pairwise_summation_block_size) {
+    for (std::int64_t i = begin; i < end; ++i) {
+      AddTo(sums, terms(i), std::index_sequence_for<Sums...>());
+    }
+  } else {
+    std::int64_t const middle = begin + (end - begin) / 2;
+    sums = PairwiseSum<Sums...>(begin, middle, terms);
+    AddTo(sums,
+          PairwiseSum<Sums...>(middle, end, terms),
+          std::index_sequence_for<Sums...>());
+  }
+  return sums;
+}
+
 template<typename Vector, typename Scalar>
 void BarycentreCalculator<Vector, Scalar>::Add(Vector const& vector,
                                                Scalar const& weight) {
@@ -25,6 +55,30 @@ void BarycentreCalculator<Vector, Scalar>::Add(Vector const& vector,
   }
 }
 
+template<typename Vector, typename Scalar>
+void BarycentreCalculator<Vector, Scalar>::Add(
+    absl::Span<Vector const> const vectors,
+    absl::Span<Scalar const> const weights) {
+  CHECK_EQ(vectors.size(), weights.size());
+  if (vectors.empty()) {
+    return;
+  }
+  auto const [weighted_sum, weight] =
+      PairwiseSum<Product<Vector, Scalar>, Scalar>(
+          vectors.size(),
+          [&vectors, &weights](std::int64_t const i) {
+            return std::tuple(vectors[i] * weights[i], weights[i]);
+          });
+  if (empty_) {
+    weighted_sum_ = weighted_sum;
+    weight_ = weight;
+    empty_ = false;
+  } else {
+    weighted_sum_ += weighted_sum;
+    weight_ += weight;
+  }
+}
+
 template<typename Vector, typename Scalar>
 Vector BarycentreCalculator<Vector, Scalar>::Get() const {
   CHECK(!empty_) << "Empty BarycentreCalculator";
@@ -36,6 +90,11 @@ Scalar const& BarycentreCalculator<Vector, Scalar>::weight() const {
   return weight_;
 }
 
+template<typename... Sums, typename Terms>
+std::tuple<Sums...> PairwiseSum(std::int64_t const size, Terms const& terms) {
+  return PairwiseSum<Sums...>(0, size, terms);
+}
+
 template<typename T, typename Scalar>
 T Barycentre(std::pair<T, T> const & ts,
              std::pair<Scalar, Scalar> const & weights) {
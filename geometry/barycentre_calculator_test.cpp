@@ -63,6 +63,31 @@ TEST_F(BarycentreCalculatorTest, Bivector) {
                   0));
 }
 
+TEST_F(BarycentreCalculatorTest, Span) {
+  // Enough elements for the pairwise summation to recurse a few times.
+  std::vector<Bivector<Entropy, World>> bivectors;
+  std::vector<KinematicViscosity> weights;
+  BarycentreCalculator<Bivector<Entropy, World>, KinematicViscosity>
+      one_at_a_time;
+  for (int i = 0; i < 100; ++i) {
+    bivectors.push_back(i % 3 == 0 ? b1_ : b2_);
+    weights.push_back(i % 2 == 0 ? k1_ : k2_);
+    one_at_a_time.Add(bivectors.back(), weights.back());
+  }
+
+  BarycentreCalculator<Bivector<Entropy, World>, KinematicViscosity> bulk;
+  bulk.Add(absl::Span<Bivector<Entropy, World> const>(),
+           absl::Span<KinematicViscosity const>());
+  bulk.Add(bivectors, weights);
+  EXPECT_THAT(bulk.weight(), AlmostEquals(one_at_a_time.weight(), 0));
+  EXPECT_THAT(bulk.Get(), AlmostEquals(one_at_a_time.Get(), 0, 2));
+
+  // Adding in bulk after adding one at a time.
+  one_at_a_time.Add(bivectors, weights);
+  EXPECT_THAT(one_at_a_time.weight(), AlmostEquals(2 * bulk.weight(), 0));
+  EXPECT_THAT(one_at_a_time.Get(), AlmostEquals(bulk.Get(), 0, 2));
+}
+
 TEST_F(BarycentreCalculatorTest, Scalar) {
   BarycentreCalculator<KinematicViscosity, double> barycentre_calculator;
   barycentre_calculator.Add(k1_, -3);
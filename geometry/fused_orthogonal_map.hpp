@@ -0,0 +1,114 @@
+﻿
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "base/mappable.hpp"
+#include "geometry/affine_map.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/linear_map.hpp"
+#include "geometry/r3x3_matrix.hpp"
+#include "geometry/sign.hpp"
+
+namespace principia {
+namespace geometry {
+namespace internal_fused_orthogonal_map {
+
+// An orthogonal map represented by its matrix.  It is obtained by fusing one
+// or more orthogonal maps (|OrthogonalMap|, |Rotation|, |Permutation|,
+// |Identity|, |Signature|) with |Fuse|.  Composing fused maps multiplies their
+// matrices, and applying a fused map costs a single matrix-vector product, so
+// this is faster than the original maps when a chain of maps is applied to
+// many vectors.  It is not serializable.
+template<typename FromFrame, typename ToFrame>
+class FusedOrthogonalMap : public LinearMap<FromFrame, ToFrame> {
+ public:
+  // The |linear_map| must be orthogonal.
+  template<template<typename, typename> typename LinearMap>
+  explicit FusedOrthogonalMap(LinearMap<FromFrame, ToFrame> const& linear_map);
+
+  Sign Determinant() const override;
+
+  FusedOrthogonalMap<ToFrame, FromFrame> Inverse() const;
+
+  template<typename Scalar>
+  Vector<Scalar, ToFrame> operator()(
+      Vector<Scalar, FromFrame> const& vector) const;
+
+  template<typename Scalar>
+  Bivector<Scalar, ToFrame> operator()(
+      Bivector<Scalar, FromFrame> const& bivector) const;
+
+  template<typename Scalar>
+  Trivector<Scalar, ToFrame> operator()(
+      Trivector<Scalar, FromFrame> const& trivector) const;
+
+  template<typename T>
+  typename base::Mappable<FusedOrthogonalMap, T>::type operator()(
+      T const& t) const;
+
+  // Applies this map to all the elements of |vectors|, see |Rotation|.
+  template<typename Scalar>
+  std::vector<Vector<Scalar, ToFrame>> operator()(
+      absl::Span<Vector<Scalar, FromFrame> const> vectors) const;
+
+  template<typename F = FromFrame,
+           typename T = ToFrame,
+           typename = std::enable_if_t<F::handedness == T::handedness>>
+  static FusedOrthogonalMap Identity();
+
+  // The matrix of this map, which maps the coordinates in |FromFrame| to those
+  // in |ToFrame|.
+  R3x3Matrix<double> const& matrix() const;
+
+ private:
+  explicit FusedOrthogonalMap(R3x3Matrix<double> const& matrix);
+
+  R3x3Matrix<double> matrix_;
+
+  static constexpr Sign determinant_ =
+      FromFrame::handedness == ToFrame::handedness ? Sign::Positive()
+                                                   : Sign::Negative();
+
+  template<typename From, typename To>
+  friend class FusedOrthogonalMap;
+
+  template<typename From, typename Through, typename To>
+  friend FusedOrthogonalMap<From, To> operator*(
+      FusedOrthogonalMap<Through, To> const& left,
+      FusedOrthogonalMap<From, Through> const& right);
+};
+
+template<typename FromFrame, typename ThroughFrame, typename ToFrame>
+FusedOrthogonalMap<FromFrame, ToFrame> operator*(
+    FusedOrthogonalMap<ThroughFrame, ToFrame> const& left,
+    FusedOrthogonalMap<FromFrame, ThroughFrame> const& right);
+
+template<typename FromFrame, typename ToFrame>
+std::ostream& operator<<(
+    std::ostream& out,
+    FusedOrthogonalMap<FromFrame, ToFrame> const& fused_orthogonal_map);
+
+// Returns the fused form of |linear_map|, which must be orthogonal.
+template<typename FromFrame, typename ToFrame,
+         template<typename, typename> typename LinearMap>
+FusedOrthogonalMap<FromFrame, ToFrame> Fuse(
+    LinearMap<FromFrame, ToFrame> const& linear_map);
+
+// Returns an affine map equal to |affine_map| whose linear part is fused.
+template<typename FromFrame, typename ToFrame, typename Scalar,
+         template<typename, typename> typename LinearMap>
+AffineMap<FromFrame, ToFrame, Scalar, FusedOrthogonalMap> Fuse(
+    AffineMap<FromFrame, ToFrame, Scalar, LinearMap> const& affine_map);
+
+}  // namespace internal_fused_orthogonal_map
+
+using internal_fused_orthogonal_map::Fuse;
+using internal_fused_orthogonal_map::FusedOrthogonalMap;
+
+}  // namespace geometry
+}  // namespace principia
+
+#include "geometry/fused_orthogonal_map_body.hpp"
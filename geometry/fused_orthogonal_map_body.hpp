@@ -0,0 +1,140 @@
+﻿
+#pragma once
+
+#include "geometry/fused_orthogonal_map.hpp"
+
+#include <vector>
+
+namespace principia {
+namespace geometry {
+namespace internal_fused_orthogonal_map {
+
+template<typename FromFrame, typename ToFrame>
+template<template<typename, typename> typename LinearMap>
+FusedOrthogonalMap<FromFrame, ToFrame>::FusedOrthogonalMap(
+    LinearMap<FromFrame, ToFrame> const& linear_map) {
+  // The columns of the matrix are the images of the basis vectors.
+  R3Element<double> const x =
+      linear_map(Vector<double, FromFrame>({1, 0, 0})).coordinates();
+  R3Element<double> const y =
+      linear_map(Vector<double, FromFrame>({0, 1, 0})).coordinates();
+  R3Element<double> const z =
+      linear_map(Vector<double, FromFrame>({0, 0, 1})).coordinates();
+  matrix_ = R3x3Matrix<double>({x.x, y.x, z.x},
+                               {x.y, y.y, z.y},
+                               {x.z, y.z, z.z});
+}
+
+template<typename FromFrame, typename ToFrame>
+Sign FusedOrthogonalMap<FromFrame, ToFrame>::Determinant() const {
+  return determinant_;
+}
+
+template<typename FromFrame, typename ToFrame>
+FusedOrthogonalMap<ToFrame, FromFrame>
+FusedOrthogonalMap<FromFrame, ToFrame>::Inverse() const {
+  return FusedOrthogonalMap<ToFrame, FromFrame>(matrix_.Transpose());
+}
+
+template<typename FromFrame, typename ToFrame>
+template<typename Scalar>
+Vector<Scalar, ToFrame> FusedOrthogonalMap<FromFrame, ToFrame>::operator()(
+    Vector<Scalar, FromFrame> const& vector) const {
+  return Vector<Scalar, ToFrame>(matrix_ * vector.coordinates());
+}
+
+template<typename FromFrame, typename ToFrame>
+template<typename Scalar>
+Bivector<Scalar, ToFrame> FusedOrthogonalMap<FromFrame, ToFrame>::operator()(
+    Bivector<Scalar, FromFrame> const& bivector) const {
+  return Bivector<Scalar, ToFrame>(determinant_ *
+                                   (matrix_ * bivector.coordinates()));
+}
+
+template<typename FromFrame, typename ToFrame>
+template<typename Scalar>
+Trivector<Scalar, ToFrame> FusedOrthogonalMap<FromFrame, ToFrame>::operator()(
+    Trivector<Scalar, FromFrame> const& trivector) const {
+  return Trivector<Scalar, ToFrame>(determinant_ * trivector.coordinates());
+}
+
+template<typename FromFrame, typename ToFrame>
+template<typename T>
+typename base::Mappable<FusedOrthogonalMap<FromFrame, ToFrame>, T>::type
+FusedOrthogonalMap<FromFrame, ToFrame>::operator()(T const& t) const {
+  return base::Mappable<FusedOrthogonalMap, T>::Do(*this, t);
+}
+
+template<typename FromFrame, typename ToFrame>
+template<typename Scalar>
+std::vector<Vector<Scalar, ToFrame>>
+FusedOrthogonalMap<FromFrame, ToFrame>::operator()(
+    absl::Span<Vector<Scalar, FromFrame> const> const vectors) const {
+  std::vector<Vector<Scalar, ToFrame>> images(vectors.size());
+  MultiplyEach<Scalar>(
+      matrix_,
+      vectors,
+      [](Vector<Scalar, FromFrame> const& vector) -> auto const& {
+        return vector.coordinates();
+      },
+      [](R3Element<Scalar> const& product) {
+        return Vector<Scalar, ToFrame>(product);
+      },
+      absl::MakeSpan(images));
+  return images;
+}
+
+template<typename FromFrame, typename ToFrame>
+template<typename, typename, typename>
+FusedOrthogonalMap<FromFrame, ToFrame>
+FusedOrthogonalMap<FromFrame, ToFrame>::Identity() {
+  return FusedOrthogonalMap(R3x3Matrix<double>::Identity());
+}
+
+template<typename FromFrame, typename ToFrame>
+R3x3Matrix<double> const&
+FusedOrthogonalMap<FromFrame, ToFrame>::matrix() const {
+  return matrix_;
+}
+
+template<typename FromFrame, typename ToFrame>
+FusedOrthogonalMap<FromFrame, ToFrame>::FusedOrthogonalMap(
+    R3x3Matrix<double> const& matrix)
+    : matrix_(matrix) {}
+
+template<typename FromFrame, typename ThroughFrame, typename ToFrame>
+FusedOrthogonalMap<FromFrame, ToFrame> operator*(
+    FusedOrthogonalMap<ThroughFrame, ToFrame> const& left,
+    FusedOrthogonalMap<FromFrame, ThroughFrame> const& right) {
+  return FusedOrthogonalMap<FromFrame, ToFrame>(left.matrix_ * right.matrix_);
+}
+
+template<typename FromFrame, typename ToFrame>
+std::ostream& operator<<(
+    std::ostream& out,
+    FusedOrthogonalMap<FromFrame, ToFrame> const& fused_orthogonal_map) {
+  return out << "{determinant: " << fused_orthogonal_map.Determinant()
+             << ", matrix: " << fused_orthogonal_map.matrix() << "}";
+}
+
+template<typename FromFrame, typename ToFrame,
+         template<typename, typename> typename LinearMap>
+FusedOrthogonalMap<FromFrame, ToFrame> Fuse(
+    LinearMap<FromFrame, ToFrame> const& linear_map) {
+  return FusedOrthogonalMap<FromFrame, ToFrame>(linear_map);
+}
+
+template<typename FromFrame, typename ToFrame, typename Scalar,
+         template<typename, typename> typename LinearMap>
+AffineMap<FromFrame, ToFrame, Scalar, FusedOrthogonalMap> Fuse(
+    AffineMap<FromFrame, ToFrame, Scalar, LinearMap> const& affine_map) {
+  Point<Vector<Scalar, FromFrame>> const from_origin;
+  return AffineMap<FromFrame, ToFrame, Scalar, FusedOrthogonalMap>(
+      from_origin,
+      affine_map(from_origin),
+      Fuse(affine_map.linear_map()));
+}
+
+}  // namespace internal_fused_orthogonal_map
+}  // namespace geometry
+}  // namespace principia
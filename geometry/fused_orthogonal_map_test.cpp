@@ -0,0 +1,124 @@
+﻿
+#include "geometry/fused_orthogonal_map.hpp"
+
+#include <vector>
+
+#include "geometry/frame.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/identity.hpp"
+#include "geometry/named_quantities.hpp"
+#include "geometry/orthogonal_map.hpp"
+#include "geometry/permutation.hpp"
+#include "geometry/rotation.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "quantities/si.hpp"
+#include "testing_utilities/numerics.hpp"
+
+namespace principia {
+namespace geometry {
+namespace internal_fused_orthogonal_map {
+
+using quantities::Length;
+using quantities::si::Degree;
+using quantities::si::Metre;
+using testing_utilities::AbsoluteError;
+using ::testing::Lt;
+
+class FusedOrthogonalMapTest : public testing::Test {
+ protected:
+  using World = Frame<enum class WorldTag>;
+  using Rotated = Frame<enum class RotatedTag>;
+  using Mirror = Frame<enum class MirrorTag,
+                       Inertial,
+                       Handedness::Left>;
+
+  FusedOrthogonalMapTest()
+      : rotation_(120 * Degree,
+                  Bivector<double, World>({1, 1, 1}),
+                  DefinesFrame<Rotated>()),
+        permutation_(OddPermutation::XZY),
+        orthogonal_map_(
+            Rotation<Mirror, Mirror>(30 * Degree,
+                                     Bivector<double, Mirror>({1, 2, 0}))
+                .Forget<OrthogonalMap>()),
+        chain_(orthogonal_map_ *
+               permutation_.Forget<OrthogonalMap>() *
+               rotation_.Forget<OrthogonalMap>()),
+        fused_chain_(Fuse(orthogonal_map_) *
+                     Fuse(permutation_) *
+                     Fuse(rotation_)) {}
+
+  Rotation<World, Rotated> const rotation_;
+  Permutation<Rotated, Mirror> const permutation_;
+  OrthogonalMap<Mirror, Mirror> const orthogonal_map_;
+  OrthogonalMap<World, Mirror> const chain_;
+  FusedOrthogonalMap<World, Mirror> const fused_chain_;
+};
+
+TEST_F(FusedOrthogonalMapTest, Identity) {
+  Vector<Length, World> const vector({1 * Metre, 2 * Metre, 3 * Metre});
+  auto const identity = FusedOrthogonalMap<World, World>::Identity();
+  EXPECT_EQ(vector, identity(vector));
+  EXPECT_EQ(vector, Fuse(Identity<World, World>())(vector));
+}
+
+TEST_F(FusedOrthogonalMapTest, AppliedToMultivectors) {
+  Vector<Length, World> const vector({1 * Metre, 2 * Metre, 3 * Metre});
+  Bivector<Length, World> const bivector({-1 * Metre, 4 * Metre, 2 * Metre});
+  Trivector<Length, World> const trivector(5 * Metre);
+  EXPECT_EQ(Sign::Negative(), fused_chain_.Determinant());
+  EXPECT_THAT(AbsoluteError(chain_(vector), fused_chain_(vector)),
+              Lt(1e-14 * Metre));
+  EXPECT_THAT(AbsoluteError(chain_(bivector), fused_chain_(bivector)),
+              Lt(1e-14 * Metre));
+  EXPECT_EQ(chain_(trivector), fused_chain_(trivector));
+}
+
+TEST_F(FusedOrthogonalMapTest, AppliedToVectors) {
+  std::vector<Vector<Length, World>> vectors;
+  for (int i = 0; i < 10; ++i) {
+    vectors.push_back(Vector<Length, World>({i * Metre,
+                                             (2 - i) * Metre,
+                                             i * i * Metre}));
+  }
+  auto const images = fused_chain_(absl::MakeConstSpan(vectors));
+  ASSERT_EQ(vectors.size(), images.size());
+  for (int i = 0; i < vectors.size(); ++i) {
+    EXPECT_THAT(AbsoluteError(fused_chain_(vectors[i]), images[i]),
+                Lt(1e-13 * Metre));
+  }
+}
+
+TEST_F(FusedOrthogonalMapTest, Inverse) {
+  Vector<Length, Mirror> const vector({1 * Metre, 2 * Metre, 3 * Metre});
+  EXPECT_THAT(
+      AbsoluteError(chain_.Inverse()(vector), fused_chain_.Inverse()(vector)),
+      Lt(1e-14 * Metre));
+  EXPECT_THAT(
+      AbsoluteError(vector, fused_chain_(fused_chain_.Inverse()(vector))),
+      Lt(1e-14 * Metre));
+}
+
+TEST_F(FusedOrthogonalMapTest, AffineMap) {
+  RigidTransformation<World, Mirror> const rigid_transformation(
+      World::origin +
+          Displacement<World>({1 * Metre, -2 * Metre, 3 * Metre}),
+      Mirror::origin +
+          Displacement<Mirror>({7 * Metre, 5 * Metre, -1 * Metre}),
+      chain_);
+  auto const fused_rigid_transformation = Fuse(rigid_transformation);
+  Position<World> const point =
+      World::origin + Displacement<World>({4 * Metre, 8 * Metre, 2 * Metre});
+  EXPECT_THAT(AbsoluteError(rigid_transformation(point),
+                            fused_rigid_transformation(point)),
+              Lt(1e-13 * Metre));
+  EXPECT_THAT(AbsoluteError(point,
+                            fused_rigid_transformation.Inverse()(
+                                fused_rigid_transformation(point))),
+              Lt(1e-13 * Metre));
+}
+
+}  // namespace internal_fused_orthogonal_map
+}  // namespace geometry
+}  // namespace principia
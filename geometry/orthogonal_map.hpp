@@ -1,6 +1,9 @@
 ﻿
 #pragma once
 
+#include <vector>
+
+#include "absl/types/span.h"
 #include "base/mappable.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
@@ -78,6 +81,11 @@ class OrthogonalMap : public LinearMap<FromFrame, ToFrame> {
   template<typename T>
   typename base::Mappable<OrthogonalMap, T>::type operator()(T const& t) const;
 
+  // Applies this map to all the elements of |vectors|, see |Rotation|.
+  template<typename Scalar>
+  std::vector<Vector<Scalar, ToFrame>> operator()(
+      absl::Span<Vector<Scalar, FromFrame> const> vectors) const;
+
   template<typename F = FromFrame,
            typename T = ToFrame,
            typename = std::enable_if_t<F::handedness == T::handedness>>
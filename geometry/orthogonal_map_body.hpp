@@ -3,7 +3,10 @@
 
 #include "geometry/orthogonal_map.hpp"
 
+#include <vector>
+
 #include "geometry/frame.hpp"
+#include "geometry/fused_orthogonal_map.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/linear_map.hpp"
 #include "geometry/r3_element.hpp"
@@ -68,6 +71,14 @@ OrthogonalMap<FromFrame, ToFrame>::operator()(T const& t) const {
   return base::Mappable<OrthogonalMap, T>::Do(*this, t);
 }
 
+template<typename FromFrame, typename ToFrame>
+template<typename Scalar>
+std::vector<Vector<Scalar, ToFrame>>
+OrthogonalMap<FromFrame, ToFrame>::operator()(
+    absl::Span<Vector<Scalar, FromFrame> const> const vectors) const {
+  return Fuse(*this)(vectors);
+}
+
 // NOTE(phl): VS2019 wants us to name the types F and T below, even though it is
 // happy with ReadFromMessage below.  You can't explain that.
 template<typename FromFrame, typename ToFrame>
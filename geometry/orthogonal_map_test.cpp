@@ -1,6 +1,8 @@
 ﻿
 #include "geometry/orthogonal_map.hpp"
 
+#include <vector>
+
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/identity.hpp"
@@ -97,6 +99,27 @@ TEST_F(OrthogonalMapTest, AppliedToVector) {
                                                 2.0 * Metre)), 1, 2));
 }
 
+TEST_F(OrthogonalMapTest, AppliedToVectors) {
+  std::vector<Vector<quantities::Length, MirrorWorld>> const mirror_vectors =
+      {mirror_vector_, -3 * mirror_vector_};
+  std::vector<Vector<quantities::Length, DirectWorld>> const direct_vectors =
+      {direct_vector_, -3 * direct_vector_};
+  for (MirrorOrth const& orthogonal_map : {orthogonal_a_, orthogonal_c_}) {
+    auto const images = orthogonal_map(absl::MakeConstSpan(mirror_vectors));
+    ASSERT_EQ(mirror_vectors.size(), images.size());
+    for (int i = 0; i < mirror_vectors.size(); ++i) {
+      EXPECT_THAT(images[i],
+                  AlmostEquals(orthogonal_map(mirror_vectors[i]), 0, 4));
+    }
+  }
+  auto const images = orthogonal_b_(absl::MakeConstSpan(direct_vectors));
+  ASSERT_EQ(direct_vectors.size(), images.size());
+  for (int i = 0; i < direct_vectors.size(); ++i) {
+    EXPECT_THAT(images[i],
+                AlmostEquals(orthogonal_b_(direct_vectors[i]), 0, 4));
+  }
+}
+
 TEST_F(OrthogonalMapTest, AppliedToBivector) {
   EXPECT_THAT(orthogonal_a_(mirror_bivector_),
               AlmostEquals(Bivector<quantities::Length, DirectWorld>(
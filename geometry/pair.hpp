@@ -230,6 +230,11 @@ class BarycentreCalculator<Pair<T1, T2>, Weight> final {
   BarycentreCalculator() = default;
 
   void Add(Pair<T1, T2> const& pair, Weight const& weight);
+  // Equivalent to calling |Add(pairs[i], weights[i])| for all i, but the sums
+  // are computed by |PairwiseSum|.  |P| is |Pair<T1, T2>| or a class derived
+  // from it, e.g., |DegreesOfFreedom|.
+  template<typename P>
+  void Add(absl::Span<P const> pairs, absl::Span<Weight const> weights);
   Pair<T1, T2> Get() const;
 
   Weight const& weight() const;
@@ -161,6 +161,39 @@ void BarycentreCalculator<Pair<T1, T2>, Weight>::Add(Pair<T1, T2> const& pair,
   }
 }
 
+template<typename T1, typename T2, typename Weight>
+template<typename P>
+void BarycentreCalculator<Pair<T1, T2>, Weight>::Add(
+    absl::Span<P const> const pairs,
+    absl::Span<Weight const> const weights) {
+  static_assert(std::is_base_of_v<Pair<T1, T2>, P>);
+  CHECK_EQ(pairs.size(), weights.size());
+  if (pairs.empty()) {
+    return;
+  }
+  auto const [t1_weighted_sum, t2_weighted_sum, weight] =
+      PairwiseSum<Product<typename vector_of<T1>::type, Weight>,
+                  Product<typename vector_of<T2>::type, Weight>,
+                  Weight>(
+          pairs.size(),
+          [&pairs, &weights](std::int64_t const i) {
+            Pair<T1, T2> const& pair = pairs[i];
+            return std::tuple((pair.t1_ - reference_t1_) * weights[i],
+                              (pair.t2_ - reference_t2_) * weights[i],
+                              weights[i]);
+          });
+  if (empty_) {
+    t1_weighted_sum_ = t1_weighted_sum;
+    t2_weighted_sum_ = t2_weighted_sum;
+    weight_ = weight;
+    empty_ = false;
+  } else {
+    t1_weighted_sum_ += t1_weighted_sum;
+    t2_weighted_sum_ += t2_weighted_sum;
+    weight_ += weight;
+  }
+}
+
 template<typename T1, typename T2, typename Weight>
 Pair<T1, T2> BarycentreCalculator<Pair<T1, T2>, Weight>::Get() const {
   CHECK(!empty_) << "Empty BarycentreCalculator";
@@ -1,6 +1,7 @@
 ﻿
 #pragma once
 
+#include <array>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -19,6 +20,7 @@ namespace geometry {
 namespace internal_perspective {
 
 using base::BoundedArray;
+using quantities::Angle;
 using quantities::Length;
 
 template<typename Frame>
@@ -27,6 +29,70 @@ using Segment = std::pair<Position<Frame>, Position<Frame>>;
 template<typename Frame>
 using Segments = std::vector<Segment<Frame>>;
 
+template<typename FromFrame, typename ToFrame>
+class Perspective;
+
+// A bounding volume hierarchy of the cones under which a set of spheres are
+// seen from the camera of a perspective.  It is used to only consider the
+// spheres that may hide a segment, instead of all of them.  It must be rebuilt
+// when the camera or the spheres move.
+template<typename Frame>
+class SphereHierarchy final {
+ public:
+  std::vector<Sphere<Frame>> const& spheres() const;
+
+ private:
+  // A cone whose apex is the camera.  A cone with a half angle of π is the
+  // entire space, and its axis is meaningless.
+  struct Cone {
+    Vector<double, Frame> axis;
+    Angle half_angle;
+    double cos_half_angle;
+    double sin_half_angle;
+  };
+
+  struct Node {
+    Cone cone;
+    // A lower bound of the distance from the camera to the points of the
+    // spheres of this node.
+    Length min_distance;
+    // The index of the sphere in |spheres_| for a leaf, -1 otherwise.
+    int sphere = -1;
+    // The indices of the children in |nodes_| for an internal node.
+    std::array<int, 2> children = {{-1, -1}};
+  };
+
+  SphereHierarchy(Position<Frame> const& camera,
+                  std::vector<Sphere<Frame>> spheres);
+
+  // Builds the subtree for the leaves whose indices are in [begin, end[ and
+  // returns the index of its root in |nodes_|.
+  int Build(std::vector<int>::iterator begin,
+            std::vector<int>::iterator end);
+
+  // Appends to |indices| the indices of the spheres that may hide part of
+  // |segment|, in no particular order.
+  void SpheresThatMayHide(Segment<Frame> const& segment,
+                          std::vector<int>& indices) const;
+
+  static Cone FullCone();
+  static Cone MakeCone(Vector<double, Frame> const& axis,
+                       Angle const& half_angle);
+
+  // Returns a cone that contains both |left| and |right|.
+  static Cone Merge(Cone const& left, Cone const& right);
+
+  Position<Frame> const camera_;
+  std::vector<Sphere<Frame>> const spheres_;
+  // The first |spheres_.size()| nodes are the leaves, in the order of
+  // |spheres_|.
+  std::vector<Node> nodes_;
+  int root_ = -1;
+
+  template<typename From, typename To>
+  friend class Perspective;
+};
+
 // A perspective using the pinhole camera model.  It project a point of
 // |FromFrame| to an element of ℝP².  |ToFrame| is the frame of the camera.  In
 // that frame the camera is located at the origin and looking at the positive
@@ -78,6 +144,18 @@ class Perspective final {
       Segment<FromFrame> const& segment,
       std::vector<Sphere<FromFrame>> const& spheres) const;
 
+  // Returns a hierarchy that may be passed to the following function to hide
+  // many segments with the same |spheres|.
+  SphereHierarchy<FromFrame> ComputeSphereHierarchy(
+      std::vector<Sphere<FromFrame>> spheres) const;
+
+  // Same as above, but only considers the spheres of |hierarchy| that may
+  // intersect the cone subtended by |segment|.  The result is the same as that
+  // of the previous function for |hierarchy.spheres()|.
+  Segments<FromFrame> VisibleSegments(
+      Segment<FromFrame> const& segment,
+      SphereHierarchy<FromFrame> const& hierarchy) const;
+
  private:
   RigidTransformation<ToFrame, FromFrame> const from_camera_;
   RigidTransformation<FromFrame, ToFrame> const to_camera_;
@@ -99,6 +177,7 @@ std::ostream& operator<<(
 using internal_perspective::Perspective;
 using internal_perspective::Segment;
 using internal_perspective::Segments;
+using internal_perspective::SphereHierarchy;
 
 }  // namespace geometry
 }  // namespace principia
@@ -10,7 +10,9 @@
 
 #include "geometry/barycentre_calculator.hpp"
 #include "numerics/root_finders.hpp"
+#include "quantities/elementary_functions.hpp"
 #include "quantities/named_quantities.hpp"
+#include "quantities/si.hpp"
 
 namespace principia {
 namespace geometry {
@@ -18,9 +20,199 @@ namespace internal_perspective {
 
 using geometry::InnerProduct;
 using numerics::SolveQuadraticEquation;
+using quantities::ArcSin;
+using quantities::ArcTan;
+using quantities::Cos;
 using quantities::Pow;
 using quantities::Product;
+using quantities::Sin;
+using quantities::Sqrt;
 using quantities::Square;
+using quantities::si::Radian;
+
+// A tolerance on the cosines of angles when deciding if a sphere of a
+// |SphereHierarchy| may hide a segment.  It makes the culling conservative in
+// the face of rounding errors.
+constexpr double cone_cosine_tolerance = 1e-12;
+
+template<typename Frame>
+std::vector<Sphere<Frame>> const& SphereHierarchy<Frame>::spheres() const {
+  return spheres_;
+}
+
+template<typename Frame>
+SphereHierarchy<Frame>::SphereHierarchy(Position<Frame> const& camera,
+                                        std::vector<Sphere<Frame>> spheres)
+    : camera_(camera),
+      spheres_(std::move(spheres)) {
+  int const size = spheres_.size();
+  if (size == 0) {
+    return;
+  }
+  nodes_.reserve(2 * size - 1);
+  std::vector<int> leaves;
+  leaves.reserve(size);
+  for (int i = 0; i < size; ++i) {
+    auto const& sphere = spheres_[i];
+    Displacement<Frame> const camera_to_centre = sphere.centre() - camera_;
+    Square<Length> const camera_to_centre² = camera_to_centre.Norm²();
+    Node leaf;
+    leaf.sphere = i;
+    if (camera_to_centre² <= sphere.radius²()) {
+      // The camera is inside the sphere, everything is hidden.
+      leaf.cone = FullCone();
+      leaf.min_distance = Length();
+    } else {
+      Length const camera_to_centre_norm = Sqrt(camera_to_centre²);
+      leaf.cone = MakeCone(camera_to_centre / camera_to_centre_norm,
+                           ArcSin(sphere.radius() / camera_to_centre_norm));
+      leaf.min_distance = camera_to_centre_norm - sphere.radius();
+    }
+    nodes_.push_back(leaf);
+    leaves.push_back(i);
+  }
+  root_ = Build(leaves.begin(), leaves.end());
+}
+
+template<typename Frame>
+int SphereHierarchy<Frame>::Build(std::vector<int>::iterator const begin,
+                                  std::vector<int>::iterator const end) {
+  if (end - begin == 1) {
+    return *begin;
+  }
+
+  // Split along the coordinate of the axes that has the largest spread.
+  R3Element<double> min{+std::numeric_limits<double>::infinity(),
+                        +std::numeric_limits<double>::infinity(),
+                        +std::numeric_limits<double>::infinity()};
+  R3Element<double> max = -min;
+  for (auto it = begin; it != end; ++it) {
+    auto const& axis = nodes_[*it].cone.axis.coordinates();
+    for (int j = 0; j < 3; ++j) {
+      min[j] = std::min(min[j], axis[j]);
+      max[j] = std::max(max[j], axis[j]);
+    }
+  }
+  R3Element<double> const spread = max - min;
+  int const dimension = spread.x >= spread.y
+                            ? (spread.x >= spread.z ? 0 : 2)
+                            : (spread.y >= spread.z ? 1 : 2);
+  auto const mid = begin + (end - begin) / 2;
+  std::nth_element(begin, mid, end, [this, dimension](int const left,
+                                                      int const right) {
+    return nodes_[left].cone.axis.coordinates()[dimension] <
+           nodes_[right].cone.axis.coordinates()[dimension];
+  });
+
+  int const left = Build(begin, mid);
+  int const right = Build(mid, end);
+  Node node;
+  node.cone = Merge(nodes_[left].cone, nodes_[right].cone);
+  node.min_distance =
+      std::min(nodes_[left].min_distance, nodes_[right].min_distance);
+  node.children = {{left, right}};
+  nodes_.push_back(node);
+  return nodes_.size() - 1;
+}
+
+template<typename Frame>
+void SphereHierarchy<Frame>::SpheresThatMayHide(
+    Segment<Frame> const& segment,
+    std::vector<int>& indices) const {
+  if (root_ < 0) {
+    return;
+  }
+
+  // Compute a cone that contains the segment.
+  Displacement<Frame> const camera_to_first = segment.first - camera_;
+  Displacement<Frame> const camera_to_second = segment.second - camera_;
+  Length const camera_to_first_norm = camera_to_first.Norm();
+  Length const camera_to_second_norm = camera_to_second.Norm();
+  Length const max_distance =
+      std::max(camera_to_first_norm, camera_to_second_norm);
+  Cone segment_cone = FullCone();
+  if (camera_to_first_norm > Length() && camera_to_second_norm > Length()) {
+    Vector<double, Frame> const first = camera_to_first / camera_to_first_norm;
+    Vector<double, Frame> const second =
+        camera_to_second / camera_to_second_norm;
+    Vector<double, Frame> const sum = first + second;
+    double const sum_norm = sum.Norm();
+    // If the directions are opposite the segment goes through the camera.
+    if (sum_norm > 0) {
+      double const difference_norm = (first - second).Norm();
+      segment_cone.axis = sum / sum_norm;
+      segment_cone.half_angle = ArcTan(difference_norm, sum_norm);
+      segment_cone.cos_half_angle = 0.5 * sum_norm;
+      segment_cone.sin_half_angle = 0.5 * difference_norm;
+    }
+  }
+
+  std::vector<int> stack = {root_};
+  while (!stack.empty()) {
+    Node const& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (max_distance <= node.min_distance) {
+      continue;
+    }
+    auto const& cone = node.cone;
+    // The cones intersect iff the angle between their axes is at most the sum
+    // of their half angles.
+    if (segment_cone.half_angle + cone.half_angle < π * Radian &&
+        InnerProduct(segment_cone.axis, cone.axis) <
+            segment_cone.cos_half_angle * cone.cos_half_angle -
+                segment_cone.sin_half_angle * cone.sin_half_angle -
+                cone_cosine_tolerance) {
+      continue;
+    }
+    if (node.sphere >= 0) {
+      indices.push_back(node.sphere);
+    } else {
+      stack.push_back(node.children[0]);
+      stack.push_back(node.children[1]);
+    }
+  }
+}
+
+template<typename Frame>
+typename SphereHierarchy<Frame>::Cone SphereHierarchy<Frame>::FullCone() {
+  return MakeCone(Vector<double, Frame>({1, 0, 0}), π * Radian);
+}
+
+template<typename Frame>
+typename SphereHierarchy<Frame>::Cone SphereHierarchy<Frame>::MakeCone(
+    Vector<double, Frame> const& axis,
+    Angle const& half_angle) {
+  return {axis, half_angle, Cos(half_angle), Sin(half_angle)};
+}
+
+template<typename Frame>
+typename SphereHierarchy<Frame>::Cone SphereHierarchy<Frame>::Merge(
+    Cone const& left,
+    Cone const& right) {
+  if (left.half_angle >= π * Radian) {
+    return left;
+  } else if (right.half_angle >= π * Radian) {
+    return right;
+  }
+  double const cos_φ = InnerProduct(left.axis, right.axis);
+  Vector<double, Frame> const orthogonal = right.axis - cos_φ * left.axis;
+  double const sin_φ = orthogonal.Norm();
+  Angle const φ = ArcTan(sin_φ, cos_φ);
+  if (φ + right.half_angle <= left.half_angle) {
+    return left;
+  } else if (φ + left.half_angle <= right.half_angle) {
+    return right;
+  }
+  Angle const half_angle = 0.5 * (φ + left.half_angle + right.half_angle);
+  if (half_angle >= π * Radian || sin_φ == 0) {
+    return FullCone();
+  }
+  // Rotate the axis of |left| towards that of |right| in their common plane.
+  Angle const rotation = half_angle - left.half_angle;
+  return MakeCone(
+      Cos(rotation) * left.axis + Sin(rotation) / sin_φ * orthogonal,
+      half_angle);
+}
 
 template<typename FromFrame, typename ToFrame>
 Perspective<FromFrame, ToFrame>::Perspective(
@@ -413,6 +605,33 @@ Segments<FromFrame> Perspective<FromFrame, ToFrame>::VisibleSegments(
   return segments;
 }
 
+template<typename FromFrame, typename ToFrame>
+SphereHierarchy<FromFrame>
+Perspective<FromFrame, ToFrame>::ComputeSphereHierarchy(
+    std::vector<Sphere<FromFrame>> spheres) const {
+  return SphereHierarchy<FromFrame>(camera_, std::move(spheres));
+}
+
+template<typename FromFrame, typename ToFrame>
+Segments<FromFrame> Perspective<FromFrame, ToFrame>::VisibleSegments(
+    Segment<FromFrame> const& segment,
+    SphereHierarchy<FromFrame> const& hierarchy) const {
+  std::vector<int> indices;
+  hierarchy.SpheresThatMayHide(segment, indices);
+  if (indices.empty()) {
+    return {segment};
+  }
+  // Hide in the order of the spheres, so that the result is bit-for-bit the
+  // same as without culling.
+  std::sort(indices.begin(), indices.end());
+  std::vector<Sphere<FromFrame>> spheres;
+  spheres.reserve(indices.size());
+  for (int const index : indices) {
+    spheres.push_back(hierarchy.spheres_[index]);
+  }
+  return VisibleSegments(segment, spheres);
+}
+
 template<typename FromFrame, typename ToFrame>
 std::ostream& operator<<(std::ostream& out,
                          Perspective<FromFrame, ToFrame> const& perspective) {
@@ -1,5 +1,7 @@
 ﻿
 #include <limits>
+#include <random>
+#include <vector>
 
 #include "geometry/affine_map.hpp"
 #include "geometry/frame.hpp"
@@ -618,6 +620,47 @@ TEST_F(VisibleSegmentsTest, MultipleSpheres) {
               SizeIs(3));
 }
 
+// Checks that culling with a hierarchy doesn't change the result.
+TEST_F(VisibleSegmentsTest, SphereHierarchy) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> coordinate_distribution(-100.0, 100.0);
+  std::uniform_real_distribution<> radius_distribution(0.1, 5.0);
+  auto random_position = [&coordinate_distribution, &random]() {
+    return World::origin +
+           Displacement<World>({coordinate_distribution(random) * Metre,
+                                coordinate_distribution(random) * Metre,
+                                coordinate_distribution(random) * Metre});
+  };
+
+  std::vector<Sphere<World>> spheres;
+  for (int i = 0; i < 200; ++i) {
+    spheres.emplace_back(random_position(),
+                         radius_distribution(random) * Metre);
+  }
+  auto const hierarchy = perspective_.ComputeSphereHierarchy(spheres);
+
+  // The camera is inside the last sphere, which hides everything.
+  std::vector<Sphere<World>> spheres_with_camera = spheres;
+  spheres_with_camera.emplace_back(camera_origin_, /*radius=*/1 * Metre);
+  auto const hierarchy_with_camera =
+      perspective_.ComputeSphereHierarchy(spheres_with_camera);
+  EXPECT_EQ(spheres.size(), hierarchy.spheres().size());
+
+  int hidden = 0;
+  for (int i = 0; i < 1000; ++i) {
+    Segment<World> const segment{random_position(), random_position()};
+    auto const expected = perspective_.VisibleSegments(segment, spheres);
+    EXPECT_EQ(expected, perspective_.VisibleSegments(segment, hierarchy));
+    EXPECT_THAT(perspective_.VisibleSegments(segment, hierarchy_with_camera),
+                IsEmpty());
+    if (expected != Segments<World>{segment}) {
+      ++hidden;
+    }
+  }
+  // Check that the test exercises the hiding.
+  EXPECT_LT(100, hidden);
+}
+
 }  // namespace internal_perspective
 }  // namespace geometry
 }  // namespace principia
@@ -124,6 +124,10 @@ class BarycentreCalculator<Point<Vector>, Weight> final {
   BarycentreCalculator() = default;
 
   void Add(Point<Vector> const& point, Weight const& weight);
+  // Equivalent to calling |Add(points[i], weights[i])| for all i, but the sums
+  // are computed by |PairwiseSum|.
+  void Add(absl::Span<Point<Vector> const> points,
+           absl::Span<Weight const> weights);
   Point<Vector> Get() const;
 
   Weight const& weight() const;
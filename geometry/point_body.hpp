@@ -182,6 +182,30 @@ void BarycentreCalculator<Point<Vector>, Weight>::Add(
   }
 }
 
+template<typename Vector, typename Weight>
+void BarycentreCalculator<Point<Vector>, Weight>::Add(
+    absl::Span<Point<Vector> const> const points,
+    absl::Span<Weight const> const weights) {
+  CHECK_EQ(points.size(), weights.size());
+  if (points.empty()) {
+    return;
+  }
+  auto const [weighted_sum, weight] =
+      PairwiseSum<Product<Vector, Weight>, Weight>(
+          points.size(),
+          [&points, &weights](std::int64_t const i) {
+            return std::tuple(points[i].coordinates_ * weights[i], weights[i]);
+          });
+  if (empty_) {
+    weighted_sum_ = weighted_sum;
+    weight_ = weight;
+    empty_ = false;
+  } else {
+    weighted_sum_ += weighted_sum;
+    weight_ += weight;
+  }
+}
+
 template<typename Vector, typename Weight>
 Point<Vector> BarycentreCalculator<Point<Vector>, Weight>::Get() const {
   CHECK(!empty_) << "Empty BarycentreCalculator";
@@ -182,6 +182,21 @@ TEST_F(PointTest, InstantBarycentreCalculator) {
   EXPECT_THAT(calculator.Get(), Eq(mjd0 - 1.7 * Day));
 }
 
+TEST_F(PointTest, BulkInstantBarycentreCalculator) {
+  BarycentreCalculator<Instant, double> calculator;
+  std::vector<Instant> const instants = {mjd0 + 2 * Day,
+                                         mjd0 - 3 * Day,
+                                         mjd0 + 5 * Day,
+                                         mjd0 - 7 * Day};
+  std::vector<double> const weights = {1, 2, 3, 4};
+  calculator.Add(absl::MakeConstSpan(instants).first(2),
+                 absl::MakeConstSpan(weights).first(2));
+  EXPECT_THAT(calculator.Get(), Eq(mjd0 - 4 * Day / 3));
+  calculator.Add(absl::MakeConstSpan(instants).subspan(2),
+                 absl::MakeConstSpan(weights).subspan(2));
+  EXPECT_THAT(calculator.Get(), Eq(mjd0 - 1.7 * Day));
+}
+
 TEST_F(PointTest, DoubleBarycentreCalculator) {
   BarycentreCalculator<Point<double>, double> calculator;
   Point<double> zero;
@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "absl/types/span.h"
 #include "base/macros.hpp"
 #include "base/tags.hpp"
 #include "geometry/r3_element.hpp"
@@ -170,6 +171,21 @@ R3x3Matrix<Product<LScalar, RScalar>> KroneckerProduct(
     R3Element<LScalar> const& left,
     R3Element<RScalar> const& right);
 
+// For each element |input| of |inputs|, computes the product of |matrix| by the
+// |R3Element<Scalar>| |coordinates(input)| and stores |make_image(product)| in
+// the corresponding element of |images|, which must have the same size as
+// |inputs|.  The matrix is loaded in SIMD registers once, so this is faster
+// than multiplying each element separately, but the results may differ in the
+// last bits.
+template<typename Scalar,
+         typename Input, typename Image,
+         typename Coordinates, typename MakeImage>
+void MultiplyEach(R3x3Matrix<double> const& matrix,
+                  absl::Span<Input const> inputs,
+                  Coordinates const& coordinates,
+                  MakeImage const& make_image,
+                  absl::Span<Image> images);
+
 template<typename Scalar>
 bool operator==(R3x3Matrix<Scalar> const& left,
                 R3x3Matrix<Scalar> const& right);
@@ -187,6 +203,7 @@ std::ostream& operator<<(std::ostream& out,
 }  // namespace internal_r3x3_matrix
 
 using internal_r3x3_matrix::KroneckerProduct;
+using internal_r3x3_matrix::MultiplyEach;
 using internal_r3x3_matrix::R3x3Matrix;
 
 }  // namespace geometry
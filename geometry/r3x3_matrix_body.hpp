@@ -3,6 +3,8 @@
 
 #include "geometry/r3x3_matrix.hpp"
 
+#include <immintrin.h>
+
 #include <algorithm>
 #include <string>
 #include <utility>
@@ -362,6 +364,49 @@ R3x3Matrix<Product<LScalar, RScalar>> KroneckerProduct(
                                                left.z * right);
 }
 
+template<typename Scalar,
+         typename Input, typename Image,
+         typename Coordinates, typename MakeImage>
+void MultiplyEach(R3x3Matrix<double> const& matrix,
+                  absl::Span<Input const> const inputs,
+                  Coordinates const& coordinates,
+                  MakeImage const& make_image,
+                  absl::Span<Image> const images) {
+  CHECK_EQ(inputs.size(), images.size());
+#if PRINCIPIA_USE_AVX_INTRINSICS
+  // The columns of the matrix, with a zero in the last lane so that the
+  // padding of the products is zero.
+  __m256d const column_x =
+      _mm256_setr_pd(matrix(0, 0), matrix(1, 0), matrix(2, 0), 0);
+  __m256d const column_y =
+      _mm256_setr_pd(matrix(0, 1), matrix(1, 1), matrix(2, 1), 0);
+  __m256d const column_z =
+      _mm256_setr_pd(matrix(0, 2), matrix(1, 2), matrix(2, 2), 0);
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    R3Element<Scalar> const& r3_element = coordinates(inputs[i]);
+    __m256d const x = _mm256_set1_pd(r3_element.x / SIUnit<Scalar>());
+    __m256d const y = _mm256_set1_pd(r3_element.y / SIUnit<Scalar>());
+    __m256d const z = _mm256_set1_pd(r3_element.z / SIUnit<Scalar>());
+#if PRINCIPIA_USE_FMA_INTRINSICS
+    __m256d const product = _mm256_fmadd_pd(
+        column_z, z,
+        _mm256_fmadd_pd(column_y, y, _mm256_mul_pd(column_x, x)));
+#else
+    __m256d const product = _mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(column_x, x), _mm256_mul_pd(column_y, y)),
+        _mm256_mul_pd(column_z, z));
+#endif
+    images[i] = make_image(
+        R3Element<Scalar>(_mm256_castpd256_pd128(product),
+                          _mm256_extractf128_pd(product, 1)));
+  }
+#else
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    images[i] = make_image(matrix * coordinates(inputs[i]));
+  }
+#endif
+}
+
 template<typename Scalar>
 bool operator==(R3x3Matrix<Scalar> const& left,
                 R3x3Matrix<Scalar> const& right) {
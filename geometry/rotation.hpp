@@ -1,6 +1,9 @@
 ﻿
 #pragma once
 
+#include <vector>
+
+#include "absl/types/span.h"
 #include "base/macros.hpp"
 #include "base/mappable.hpp"
 #include "geometry/grassmann.hpp"
@@ -227,6 +230,13 @@ class Rotation : public LinearMap<FromFrame, ToFrame> {
   template<typename T>
   typename base::Mappable<Rotation, T>::type operator()(T const& t) const;
 
+  // Applies this rotation to all the elements of |vectors|.  The rotation is
+  // converted to a matrix once, so this is much faster than applying it to
+  // each vector, but the results may differ in the last bits.
+  template<typename Scalar>
+  std::vector<Vector<Scalar, ToFrame>> operator()(
+      absl::Span<Vector<Scalar, FromFrame> const> vectors) const;
+
   template<template<typename, typename> typename LinearMap>
   LinearMap<FromFrame, ToFrame> Forget() const;
 
@@ -252,6 +262,10 @@ class Rotation : public LinearMap<FromFrame, ToFrame> {
   template<typename Scalar>
   R3Element<Scalar> operator()(R3Element<Scalar> const& r3_element) const;
 
+  // The matrix of this rotation, which maps the coordinates in |FromFrame| to
+  // those in |ToFrame|.
+  R3x3Matrix<double> ToMatrix() const;
+
   Quaternion quaternion_;
 
   // For constructing a rotation using a quaternion.
@@ -4,6 +4,7 @@
 #include "geometry/rotation.hpp"
 
 #include <algorithm>
+#include <vector>
 
 #include "base/traits.hpp"
 #include "geometry/grassmann.hpp"
@@ -267,6 +268,24 @@ Rotation<FromFrame, ToFrame>::operator()(T const& t) const {
   return base::Mappable<Rotation, T>::Do(*this, t);
 }
 
+template<typename FromFrame, typename ToFrame>
+template<typename Scalar>
+std::vector<Vector<Scalar, ToFrame>> Rotation<FromFrame, ToFrame>::operator()(
+    absl::Span<Vector<Scalar, FromFrame> const> const vectors) const {
+  std::vector<Vector<Scalar, ToFrame>> images(vectors.size());
+  MultiplyEach<Scalar>(
+      ToMatrix(),
+      vectors,
+      [](Vector<Scalar, FromFrame> const& vector) -> auto const& {
+        return vector.coordinates();
+      },
+      [](R3Element<Scalar> const& product) {
+        return Vector<Scalar, ToFrame>(product);
+      },
+      absl::MakeSpan(images));
+  return images;
+}
+
 template<typename FromFrame, typename ToFrame>
 template<template<typename, typename> typename LinearMap>
 LinearMap<FromFrame, ToFrame> Rotation<FromFrame, ToFrame>::Forget() const {
@@ -326,6 +345,24 @@ R3Element<Scalar> Rotation<FromFrame, ToFrame>::operator()(
                                       real_part * r3_element);
 }
 
+template<typename FromFrame, typename ToFrame>
+R3x3Matrix<double> Rotation<FromFrame, ToFrame>::ToMatrix() const {
+  double const w = quaternion_.real_part();
+  R3Element<double> const& v = quaternion_.imaginary_part();
+  double const xx = v.x * v.x;
+  double const yy = v.y * v.y;
+  double const zz = v.z * v.z;
+  double const xy = v.x * v.y;
+  double const xz = v.x * v.z;
+  double const yz = v.y * v.z;
+  double const wx = w * v.x;
+  double const wy = w * v.y;
+  double const wz = w * v.z;
+  return R3x3Matrix<double>({1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy)},
+                            {2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx)},
+                            {2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy)});
+}
+
 template<typename FromFrame, typename ThroughFrame, typename ToFrame>
 Rotation<FromFrame, ToFrame> operator*(
     Rotation<ThroughFrame, ToFrame> const& left,
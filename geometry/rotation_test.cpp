@@ -1,6 +1,8 @@
 ﻿
 #include "geometry/rotation.hpp"
 
+#include <vector>
+
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/identity.hpp"
@@ -108,6 +110,19 @@ TEST_F(RotationTest, AppliedToVector) {
                                     3.0 * Metre)), 0));
 }
 
+TEST_F(RotationTest, AppliedToVectors) {
+  std::vector<Vector<Length, World>> const vectors = {
+      vector_, e1_ * Metre, e2_ * Metre, e3_ * Metre, -2 * vector_};
+  for (Rot const& rotation : {rotation_a_, rotation_b_, rotation_c_}) {
+    std::vector<Vector<Length, World>> const images =
+        rotation(absl::MakeConstSpan(vectors));
+    ASSERT_EQ(vectors.size(), images.size());
+    for (int i = 0; i < vectors.size(); ++i) {
+      EXPECT_THAT(images[i], AlmostEquals(rotation(vectors[i]), 0, 4));
+    }
+  }
+}
+
 TEST_F(RotationTest, AppliedToBivector) {
   EXPECT_THAT(rotation_a_(bivector_),
               AlmostEquals(Bivector<Length, World>(
@@ -113,6 +113,7 @@ class EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator
         Parameters const& parameters,
         Time const& time_step,
         bool first_use,
+        StepSizeController const& step_size_controller,
         EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator const&
             integrator);
 
@@ -123,6 +124,7 @@ class EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator
              Parameters const& parameters,
              Time const& time_step,
              bool first_use,
+             StepSizeController const& step_size_controller,
              EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator const&
                  integrator);
 
@@ -61,6 +61,7 @@ Status EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator<
   auto& current_state = this->current_state_;
   auto& first_use = this->first_use_;
   auto& parameters = this->parameters_;
+  auto& step_size_controller = this->step_size_controller_;
   auto const& equation = this->equation_;
 
   // |current_state| gets updated as the integration progresses to allow
@@ -145,10 +146,9 @@ Status EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator<
       step_status = Status::OK;
 
       // Adapt step size.
-      // TODO(egg): find out whether there's a smarter way to compute that root,
-      // especially since we make the order compile-time.
       h *= parameters.safety_factor *
-               std::pow(tolerance_to_error_ratio, 1.0 / (lower_order + 1));
+           step_size_controller.StepSizeFactor(tolerance_to_error_ratio,
+                                               /*order=*/lower_order + 1);
       // TODO(egg): should we check whether it vanishes in double precision
       // instead?
       if (t.value + (t.error + h) == t.value) {
@@ -247,6 +247,12 @@ Status EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator<
     append_state(current_state);
     ++step_count;
     if (step_count == parameters.max_steps && !at_end) {
+      // Choose the size of the next step now, so that a restart, or a new
+      // instance started from |time_step()| and |step_size_controller()|,
+      // takes the step that this invocation would have taken.
+      h *= parameters.safety_factor *
+           step_size_controller.StepSizeFactor(tolerance_to_error_ratio,
+                                               /*order=*/lower_order + 1);
       return Status(termination_condition::ReachedMaximalStepCount,
                     "Reached maximum step count " +
                         std::to_string(parameters.max_steps) +
@@ -306,6 +312,7 @@ Instance::ReadFromMessage(
     Parameters const& parameters,
     Time const& time_step,
     bool const first_use,
+    StepSizeController const& step_size_controller,
     EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator const&
         integrator) {
   // Cannot use |make_not_null_unique| because the constructor of |Instance| is
@@ -316,6 +323,7 @@ Instance::ReadFromMessage(
                                                 parameters,
                                                 time_step,
                                                 first_use,
+                                                step_size_controller,
                                                 integrator));
 }
 
@@ -328,13 +336,15 @@ Instance::Instance(
     Parameters const& parameters,
     Time const& time_step,
     bool const first_use,
+    StepSizeController const& step_size_controller,
     EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator const& integrator)
     : AdaptiveStepSizeIntegrator<ODE>::Instance(problem,
                                                 append_state,
                                                 tolerance_to_error_ratio,
                                                 parameters,
                                                 time_step,
-                                                first_use),
+                                                first_use,
+                                                step_size_controller),
       integrator_(integrator) {}
 
 template<typename Method, typename Position>
@@ -354,6 +364,7 @@ NewInstance(IntegrationProblem<ODE> const& problem,
                    parameters,
                    /*time_step=*/parameters.first_time_step,
                    /*first_use=*/true,
+                   parameters.step_size_controller,
                    *this));
 }
 
@@ -143,8 +143,8 @@ TEST_F(EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegratorTest, Legendre) {
     max_error = std::max(max_error, error);
     max_derivative_error = std::max(max_derivative_error, derivative_error);
   }
-  EXPECT_THAT(max_error, IsNear(172e-6_⑴));
-  EXPECT_THAT(max_derivative_error, IsNear(4.54e-3_⑴ / Second));
+  EXPECT_THAT(max_error, IsNear(104e-9_⑴));
+  EXPECT_THAT(max_derivative_error, IsNear(6.71e-6_⑴ / Second));
 }
 
 }  // namespace internal_embedded_explicit_generalized_runge_kutta_nyström_integrator  // NOLINT
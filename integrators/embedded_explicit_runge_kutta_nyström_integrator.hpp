@@ -111,6 +111,7 @@ class EmbeddedExplicitRungeKuttaNyströmIntegrator
         Parameters const& parameters,
         Time const& time_step,
         bool first_use,
+        StepSizeController const& step_size_controller,
         EmbeddedExplicitRungeKuttaNyströmIntegrator const& integrator);
 
    private:
@@ -120,6 +121,7 @@ class EmbeddedExplicitRungeKuttaNyströmIntegrator
              Parameters const& parameters,
              Time const& time_step,
              bool first_use,
+             StepSizeController const& step_size_controller,
              EmbeddedExplicitRungeKuttaNyströmIntegrator const& integrator);
 
     EmbeddedExplicitRungeKuttaNyströmIntegrator const& integrator_;
@@ -265,6 +265,104 @@ TEST_F(EmbeddedExplicitRungeKuttaNyströmIntegratorTest, MaxSteps) {
   }
 }
 
+// An integration split in chunks of |max_steps| steps, each chunk being
+// started from the state, step size and controller of the previous one, takes
+// the same steps as an integration in a single chunk.  The results are not
+// bitwise identical because the first-same-as-last stage is recomputed at the
+// beginning of each chunk.
+TEST_F(EmbeddedExplicitRungeKuttaNyströmIntegratorTest, MaxStepsContinuation) {
+  using Instance = AdaptiveStepSizeIntegrator<ODE>::Instance;
+  AdaptiveStepSizeIntegrator<ODE> const& integrator =
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<
+          methods::DormandالمكاوىPrince1986RKN434FM,
+          Length>();
+  Instant const t_initial;
+  Instant const t_final = t_initial + 10 * 2 * π * Second;
+  Length const length_tolerance = 1 * Milli(Metre);
+  Speed const speed_tolerance = 1 * Milli(Metre) / Second;
+  std::int64_t const max_steps = 16;
+
+  ODE harmonic_oscillator;
+  harmonic_oscillator.compute_acceleration =
+      std::bind(ComputeHarmonicOscillatorAcceleration1D,
+                _1, _2, _3, /*evaluations=*/nullptr);
+  auto const tolerance_to_error_ratio =
+      std::bind(HarmonicOscillatorToleranceRatio,
+                _1, _2,
+                length_tolerance,
+                speed_tolerance,
+                [](bool tolerable) {});
+
+  IntegrationProblem<ODE> problem;
+  problem.equation = harmonic_oscillator;
+  problem.initial_state = {{1 * Metre}, {0 * Metre / Second}, t_initial};
+
+  std::vector<ODE::SystemState> single_chunk;
+  auto const single_chunk_instance = integrator.NewInstance(
+      problem,
+      [&single_chunk](ODE::SystemState const& state) {
+        single_chunk.push_back(state);
+      },
+      tolerance_to_error_ratio,
+      AdaptiveStepSizeIntegrator<ODE>::Parameters(
+          /*first_time_step=*/t_final - t_initial,
+          /*safety_factor=*/0.9,
+          /*max_steps=*/std::numeric_limits<std::int64_t>::max(),
+          /*last_step_is_exact=*/true,
+          StepSizeController::GustafssonPI()));
+  EXPECT_OK(single_chunk_instance->Solve(t_final));
+
+  std::vector<ODE::SystemState> chunks;
+  Time time_step = t_final - t_initial;
+  StepSizeController step_size_controller = StepSizeController::GustafssonPI();
+  int number_of_chunks = 0;
+  for (;;) {
+    ++number_of_chunks;
+    auto const instance = integrator.NewInstance(
+        problem,
+        [&chunks](ODE::SystemState const& state) { chunks.push_back(state); },
+        tolerance_to_error_ratio,
+        AdaptiveStepSizeIntegrator<ODE>::Parameters(
+            time_step,
+            /*safety_factor=*/0.9,
+            max_steps,
+            /*last_step_is_exact=*/true,
+            step_size_controller));
+    Status const status = instance->Solve(t_final);
+    if (status.error() != termination_condition::ReachedMaximalStepCount) {
+      EXPECT_OK(status);
+      break;
+    }
+    auto const& adaptive_instance = dynamic_cast<Instance const&>(*instance);
+    problem.initial_state = instance->state();
+    time_step = adaptive_instance.time_step();
+    step_size_controller = adaptive_instance.step_size_controller();
+  }
+
+  EXPECT_EQ((single_chunk.size() + max_steps - 1) / max_steps,
+            number_of_chunks);
+  ASSERT_EQ(single_chunk.size(), chunks.size());
+  Time max_time_error;
+  Length max_position_error;
+  Speed max_velocity_error;
+  for (int i = 0; i < chunks.size(); ++i) {
+    max_time_error = std::max(
+        max_time_error,
+        AbsoluteError(single_chunk[i].time.value, chunks[i].time.value));
+    max_position_error =
+        std::max(max_position_error,
+                 AbsoluteError(single_chunk[i].positions[0].value,
+                               chunks[i].positions[0].value));
+    max_velocity_error =
+        std::max(max_velocity_error,
+                 AbsoluteError(single_chunk[i].velocities[0].value,
+                               chunks[i].velocities[0].value));
+  }
+  EXPECT_THAT(max_time_error, IsNear(1.4e-13_⑴ * Second));
+  EXPECT_THAT(max_position_error, IsNear(1.3e-13_⑴ * Metre));
+  EXPECT_THAT(max_velocity_error, IsNear(1.2e-13_⑴ * Metre / Second));
+}
+
 TEST_F(EmbeddedExplicitRungeKuttaNyströmIntegratorTest, Singularity) {
   // Integrating the position of an ideal rocket,
   //   x"(t) = m' I_sp / m(t),
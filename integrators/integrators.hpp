@@ -8,6 +8,7 @@
 #include "base/status.hpp"
 #include "geometry/named_quantities.hpp"
 #include "integrators/ordinary_differential_equations.hpp"
+#include "integrators/step_size_controller.hpp"
 #include "numerics/double_precision.hpp"
 #include "quantities/quantities.hpp"
 #include "serialization/integrators.pb.h"
@@ -142,12 +143,20 @@ class AdaptiveStepSizeIntegrator : public Integrator<ODE_> {
                            typename ODE::SystemStateError const& error)>;
 
   struct Parameters final {
+    Parameters(Time first_time_step,
+               double safety_factor,
+               std::int64_t max_steps,
+               bool last_step_is_exact,
+               StepSizeController const& step_size_controller);
+
+    // The step size controller is elementary.
     Parameters(Time first_time_step,
                double safety_factor,
                std::int64_t max_steps,
                bool last_step_is_exact);
 
-    // |max_steps| is infinite and the last step is exact.
+    // |max_steps| is infinite, the last step is exact, and the step size
+    // controller is elementary.
     Parameters(Time first_time_step,
                double safety_factor);
 
@@ -171,6 +180,10 @@ class AdaptiveStepSizeIntegrator : public Integrator<ODE_> {
     // |state.time.value == t_final| (unless |max_steps| is reached).  Otherwise
     // it may have |state.time.value < t_final|.
     bool const last_step_is_exact;
+    // The controller used to choose the next step size from the tolerance to
+    // error ratios.  Each instance starts from a copy of this object, including
+    // its history, if any.
+    StepSizeController const step_size_controller;
   };
 
   // The last call to |append_state| will have |state.time.value == t_final|.
@@ -179,6 +192,13 @@ class AdaptiveStepSizeIntegrator : public Integrator<ODE_> {
     // The integrator corresponding to this instance.
     virtual AdaptiveStepSizeIntegrator const& integrator() const = 0;
 
+    // The size of the next step, and the controller with the history of the
+    // accepted steps.  An instance whose |Parameters| have these as
+    // |first_time_step| and |step_size_controller| continues the integration
+    // where |Solve| stopped because of |max_steps|.
+    Time const& time_step() const;
+    StepSizeController const& step_size_controller() const;
+
     void WriteToMessage(
         not_null<serialization::IntegratorInstance*> message) const override;
     template<typename S = typename ODE::SystemState,
@@ -195,12 +215,15 @@ class AdaptiveStepSizeIntegrator : public Integrator<ODE_> {
              ToleranceToErrorRatio const& tolerance_to_error_ratio,
              Parameters const& parameters,
              Time const& time_step,
-             bool first_use);
+             bool first_use,
+             StepSizeController const& step_size_controller);
 
     ToleranceToErrorRatio const tolerance_to_error_ratio_;
     Parameters const parameters_;
     Time time_step_;
     bool first_use_;
+    // Updated as the integration progresses to allow restartability.
+    StepSizeController step_size_controller_;
   };
 
   // The factory function for |Instance|, above.  It ensures that the instance
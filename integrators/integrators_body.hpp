@@ -206,6 +206,7 @@ ReadEegrknInstanceFromMessage(
     typename Integrator::Parameters const& parameters,
     Time const& time_step,
     bool const first_use,
+    StepSizeController const& step_size_controller,
     Integrator const& integrator) {
   CHECK(message.HasExtension(
       serialization::
@@ -223,6 +224,7 @@ ReadEegrknInstanceFromMessage(
                                                parameters,
                                                time_step,
                                                first_use,
+                                               step_size_controller,
                                                integrator);
 }
 
@@ -236,6 +238,7 @@ ReadEerknInstanceFromMessage(
     typename Integrator::Parameters const& parameters,
     Time const& time_step,
     bool const first_use,
+    StepSizeController const& step_size_controller,
     Integrator const& integrator) {
   CHECK(message.HasExtension(
       serialization::EmbeddedExplicitRungeKuttaNystromIntegratorInstance::
@@ -251,6 +254,7 @@ ReadEerknInstanceFromMessage(
                                                parameters,
                                                time_step,
                                                first_use,
+                                               step_size_controller,
                                                integrator);
 }
 
@@ -532,11 +536,25 @@ AdaptiveStepSizeIntegrator<ODE_>::Parameters::Parameters(
     Time const first_time_step,
     double const safety_factor,
     std::int64_t const max_steps,
-    bool const last_step_is_exact)
+    bool const last_step_is_exact,
+    StepSizeController const& step_size_controller)
     : first_time_step(first_time_step),
       safety_factor(safety_factor),
       max_steps(max_steps),
-      last_step_is_exact(last_step_is_exact) {}
+      last_step_is_exact(last_step_is_exact),
+      step_size_controller(step_size_controller) {}
+
+template<typename ODE_>
+AdaptiveStepSizeIntegrator<ODE_>::Parameters::Parameters(
+    Time const first_time_step,
+    double const safety_factor,
+    std::int64_t const max_steps,
+    bool const last_step_is_exact)
+    : Parameters(first_time_step,
+                 safety_factor,
+                 max_steps,
+                 last_step_is_exact,
+                 StepSizeController::Elementary()) {}
 
 template<typename ODE_>
 AdaptiveStepSizeIntegrator<ODE_>::Parameters::Parameters(
@@ -555,6 +573,8 @@ void AdaptiveStepSizeIntegrator<ODE_>::Parameters::WriteToMessage(
   message->set_safety_factor(safety_factor);
   message->set_max_steps(max_steps);
   message->set_last_step_is_exact(last_step_is_exact);
+  step_size_controller.WriteToMessage(
+      message->mutable_step_size_controller());
 }
 
 template<typename ODE_>
@@ -563,13 +583,28 @@ AdaptiveStepSizeIntegrator<ODE_>::Parameters::ReadFromMessage(
     serialization::AdaptiveStepSizeIntegratorInstance::Parameters const&
         message) {
   bool const is_pre_cartan = !message.has_last_step_is_exact();
+  bool const is_pre_frenet = !message.has_step_size_controller();
   Parameters result(Time::ReadFromMessage(message.first_time_step()),
                     message.safety_factor(),
                     message.max_steps(),
-                    is_pre_cartan ? true : message.last_step_is_exact());
+                    is_pre_cartan ? true : message.last_step_is_exact(),
+                    is_pre_frenet ? StepSizeController::Elementary()
+                                  : StepSizeController::ReadFromMessage(
+                                        message.step_size_controller()));
   return result;
 }
 
+template<typename ODE_>
+Time const& AdaptiveStepSizeIntegrator<ODE_>::Instance::time_step() const {
+  return time_step_;
+}
+
+template<typename ODE_>
+StepSizeController const&
+AdaptiveStepSizeIntegrator<ODE_>::Instance::step_size_controller() const {
+  return step_size_controller_;
+}
+
 template<typename ODE_>
 void AdaptiveStepSizeIntegrator<ODE_>::Instance::WriteToMessage(
     not_null<serialization::IntegratorInstance*> message) const {
@@ -579,6 +614,8 @@ void AdaptiveStepSizeIntegrator<ODE_>::Instance::WriteToMessage(
   parameters_.WriteToMessage(extension->mutable_parameters());
   time_step_.WriteToMessage(extension->mutable_time_step());
   extension->set_first_use(first_use_);
+  step_size_controller_.WriteToMessage(
+      extension->mutable_step_size_controller());
   integrator().WriteToMessage(extension->mutable_integrator());
 }
 
@@ -597,6 +634,7 @@ void AdaptiveStepSizeIntegrator<ODE_>::Instance::WriteToMessage(
                                          parameters,                 \
                                          time_step,                  \
                                          first_use,                  \
+                                         step_size_controller,       \
                                          integrator);                \
   }
 #define PRINCIPIA_READ_ASS_INTEGRATOR_INSTANCE_EERKN(method)                   \
@@ -612,6 +650,7 @@ void AdaptiveStepSizeIntegrator<ODE_>::Instance::WriteToMessage(
                                         parameters,                            \
                                         time_step,                             \
                                         first_use,                             \
+                                        step_size_controller,                  \
                                         integrator);                           \
   }
 
@@ -646,6 +685,11 @@ AdaptiveStepSizeIntegrator<ODE_>::Instance::ReadFromMessage(
     time_step = Time::ReadFromMessage(extension.time_step());
     first_use = extension.first_use();
   }
+  bool const is_pre_frenet = !extension.has_step_size_controller();
+  StepSizeController const step_size_controller =
+      is_pre_frenet ? parameters.step_size_controller
+                    : StepSizeController::ReadFromMessage(
+                          extension.step_size_controller());
 
   switch (extension.integrator().kind()) {
     PRINCIPIA_ASS_INTEGRATOR_CASES(
@@ -669,12 +713,14 @@ AdaptiveStepSizeIntegrator<ODE_>::Instance::Instance(
     ToleranceToErrorRatio const& tolerance_to_error_ratio,
     Parameters const& parameters,
     Time const& time_step,
-    bool const first_use)
+    bool const first_use,
+    StepSizeController const& step_size_controller)
     : Integrator<ODE>::Instance(problem, append_state),
       tolerance_to_error_ratio_(tolerance_to_error_ratio),
       parameters_(parameters),
       time_step_(time_step),
-      first_use_(first_use) {
+      first_use_(first_use),
+      step_size_controller_(step_size_controller) {
   CHECK_NE(Time(), time_step_);
   CHECK_GT(parameters.safety_factor, 0);
   CHECK_LT(parameters.safety_factor, 1);
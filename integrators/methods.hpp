@@ -362,7 +362,7 @@ struct Fine1987RKNG34 : EmbeddedExplicitGeneralizedRungeKuttaNyström {
   static constexpr FixedStrictlyLowerTriangularMatrix<double, stages> aʹ{{
       {  2 /     9.0,
          1 /    12.0,    1 /   4.0,
-        69 /   128.0, -234 / 128.0, 135 /    64.0,
+        69 /   128.0, -243 / 128.0, 135 /    64.0,
        -17 /    12.0,   27 /   4.0, -27 /     5.0, 16 /    15.0}}};
   static constexpr FixedVector<double, stages> b̂{{
       { 19 /   180.0,    0        ,  63 /   200.0, 16 /   225.0,   1 / 120.0}}};
@@ -0,0 +1,86 @@
+﻿
+#pragma once
+
+#include <array>
+
+#include "base/not_null.hpp"
+#include "serialization/integrators.pb.h"
+
+namespace principia {
+namespace integrators {
+namespace internal_step_size_controller {
+
+using base::not_null;
+
+// A step size controller computes, from the tolerance-to-error ratios returned
+// by |AdaptiveStepSizeIntegrator::ToleranceToErrorRatio|, the factor by which
+// the step size of an embedded method is multiplied before the next attempt.
+// Following Söderlind (2002), Automatic control and adaptive time-stepping,
+// all the controllers implemented here are digital filters of the form
+//   hₙ₊₁ = hₙ ρₙ^(β₁/k) ρₙ₋₁^(β₂/k) ρₙ₋₂^(β₃/k),
+// where ρᵢ is the tolerance-to-error ratio of the i-th accepted step and k is
+// one more than the order of the error estimator.  The safety factor of the
+// integrator is applied by the caller.
+// After a rejected step, all the controllers use the elementary formula
+//   hₙ₊₁ = hₙ ρₙ^(1/k),
+// and the rejected ratio is not recorded.
+// For the controllers other than the elementary one, we follow the code DOPRI5
+// of Hairer and Wanner and limit the ratios to 10⁴ and the factor to [0.2, 10];
+// a step with a vanishing error would otherwise poison the history.
+// This class has value semantics; it carries the history of the last accepted
+// ratios, and is therefore part of the state of an integrator instance.
+class StepSizeController final {
+ public:
+  using Kind = serialization::StepSizeController::Kind;
+
+  // The elementary (integral) controller, β = (1, 0, 0).  This is the
+  // historical behaviour of our embedded integrators.
+  static StepSizeController Elementary();
+
+  // The proportional-integral controller of Gustafsson (1991),
+  // Control-theoretic techniques for stepsize selection in explicit
+  // Runge-Kutta methods, β = (0.7, -0.4, 0).  See also Hairer, Nørsett and
+  // Wanner (1993), Solving Ordinary Differential Equations I, section II.4.
+  static StepSizeController GustafssonPI();
+
+  // A proportional-integral-derivative controller, β = (0.58, -0.21, 0.1).
+  // These are the coefficients of the PID filter derived from Söderlind (2002)
+  // that ARKode, part of SUNDIALS, uses by default.
+  static StepSizeController SöderlindPID();
+
+  static StepSizeController Make(Kind kind);
+
+  Kind kind() const;
+
+  // Returns the factor by which to multiply the current step size, given the
+  // |tolerance_to_error_ratio| of the last attempt.  If that ratio is at
+  // least 1 the last step was accepted and the ratio is recorded for use by
+  // subsequent calls.  |order| is the order of the error estimator plus one.
+  double StepSizeFactor(double tolerance_to_error_ratio, int order);
+
+  // Forgets the ratios of the previously accepted steps.
+  void Reset();
+
+  void WriteToMessage(
+      not_null<serialization::StepSizeController*> message) const;
+  static StepSizeController ReadFromMessage(
+      serialization::StepSizeController const& message);
+
+ private:
+  StepSizeController(Kind kind, std::array<double, 3> const& β);
+
+  Kind kind_;
+  std::array<double, 3> β_;
+  // The ratios for the last two accepted steps, ρₙ₋₁ and ρₙ₋₂.  A missing
+  // ratio is represented by 1, which makes the corresponding factor neutral.
+  std::array<double, 2> previous_ratios_ = {1, 1};
+};
+
+}  // namespace internal_step_size_controller
+
+using internal_step_size_controller::StepSizeController;
+
+}  // namespace integrators
+}  // namespace principia
+
+#include "integrators/step_size_controller_body.hpp"
@@ -0,0 +1,104 @@
+﻿
+#pragma once
+
+#include "integrators/step_size_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/macros.hpp"
+#include "glog/logging.h"
+
+namespace principia {
+namespace integrators {
+namespace internal_step_size_controller {
+
+constexpr double max_ratio = 1e4;
+constexpr double min_factor = 0.2;
+constexpr double max_factor = 10;
+
+inline StepSizeController StepSizeController::Elementary() {
+  return StepSizeController(serialization::StepSizeController::ELEMENTARY,
+                            {1, 0, 0});
+}
+
+inline StepSizeController StepSizeController::GustafssonPI() {
+  return StepSizeController(serialization::StepSizeController::GUSTAFSSON_PI,
+                            {0.7, -0.4, 0});
+}
+
+inline StepSizeController StepSizeController::SöderlindPID() {
+  return StepSizeController(serialization::StepSizeController::SODERLIND_PID,
+                            {0.58, -0.21, 0.1});
+}
+
+inline StepSizeController StepSizeController::Make(Kind const kind) {
+  switch (kind) {
+    case serialization::StepSizeController::ELEMENTARY:
+      return Elementary();
+    case serialization::StepSizeController::GUSTAFSSON_PI:
+      return GustafssonPI();
+    case serialization::StepSizeController::SODERLIND_PID:
+      return SöderlindPID();
+    default:
+      LOG(FATAL) << "Unexpected step size controller " << kind;
+      base::noreturn();
+  }
+}
+
+inline StepSizeController::Kind StepSizeController::kind() const {
+  return kind_;
+}
+
+inline double StepSizeController::StepSizeFactor(
+    double const tolerance_to_error_ratio,
+    int const order) {
+  double const exponent = 1.0 / order;
+  // Keep the elementary controller bitwise identical to what the integrators
+  // used to compute.
+  if (kind_ == serialization::StepSizeController::ELEMENTARY ||
+      tolerance_to_error_ratio < 1.0) {
+    return std::pow(tolerance_to_error_ratio, exponent);
+  }
+  double const ρₙ = std::min(tolerance_to_error_ratio, max_ratio);
+  auto const [ρₙ₋₁, ρₙ₋₂] = previous_ratios_;
+  double const factor = std::pow(ρₙ, β_[0] * exponent) *
+                        std::pow(ρₙ₋₁, β_[1] * exponent) *
+                        std::pow(ρₙ₋₂, β_[2] * exponent);
+  previous_ratios_ = {ρₙ, ρₙ₋₁};
+  return std::clamp(factor, min_factor, max_factor);
+}
+
+inline void StepSizeController::Reset() {
+  previous_ratios_ = {1, 1};
+}
+
+inline void StepSizeController::WriteToMessage(
+    not_null<serialization::StepSizeController*> const message) const {
+  message->set_kind(kind_);
+  for (double const ratio : previous_ratios_) {
+    message->add_previous_ratio(ratio);
+  }
+}
+
+inline StepSizeController StepSizeController::ReadFromMessage(
+    serialization::StepSizeController const& message) {
+  StepSizeController result = Make(message.kind());
+  if (message.previous_ratio_size() > 0) {
+    CHECK_EQ(result.previous_ratios_.size(), message.previous_ratio_size())
+        << message.DebugString();
+    for (int i = 0; i < message.previous_ratio_size(); ++i) {
+      result.previous_ratios_[i] = message.previous_ratio(i);
+    }
+  }
+  return result;
+}
+
+inline StepSizeController::StepSizeController(Kind const kind,
+                                              std::array<double, 3> const& β)
+    : kind_(kind),
+      β_(β) {}
+
+}  // namespace internal_step_size_controller
+}  // namespace integrators
+}  // namespace principia
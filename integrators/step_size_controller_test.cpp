@@ -0,0 +1,93 @@
+﻿
+#include "integrators/step_size_controller.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "serialization/integrators.pb.h"
+#include "testing_utilities/almost_equals.hpp"
+#include "testing_utilities/matchers.hpp"
+
+namespace principia {
+namespace integrators {
+namespace internal_step_size_controller {
+
+using testing_utilities::AlmostEquals;
+using testing_utilities::EqualsProto;
+
+class StepSizeControllerTest : public ::testing::Test {
+ protected:
+  static constexpr int order = 4;
+};
+
+TEST_F(StepSizeControllerTest, Elementary) {
+  auto controller = StepSizeController::Elementary();
+  EXPECT_EQ(serialization::StepSizeController::ELEMENTARY, controller.kind());
+  for (double const ratio : {0.5, 1.0, 3.0, 1e6}) {
+    EXPECT_EQ(std::pow(ratio, 1.0 / order),
+              controller.StepSizeFactor(ratio, order));
+  }
+}
+
+TEST_F(StepSizeControllerTest, GustafssonPI) {
+  auto controller = StepSizeController::GustafssonPI();
+  // No history: the previous ratio is taken to be 1.
+  EXPECT_THAT(controller.StepSizeFactor(2.0, order),
+              AlmostEquals(std::pow(2.0, 0.7 / order), 0));
+  // A rejected step uses the elementary formula and is not recorded.
+  EXPECT_THAT(controller.StepSizeFactor(0.5, order),
+              AlmostEquals(std::pow(0.5, 1.0 / order), 0));
+  EXPECT_THAT(controller.StepSizeFactor(3.0, order),
+              AlmostEquals(std::pow(3.0, 0.7 / order) *
+                           std::pow(2.0, -0.4 / order), 0));
+  controller.Reset();
+  EXPECT_THAT(controller.StepSizeFactor(3.0, order),
+              AlmostEquals(std::pow(3.0, 0.7 / order), 0));
+}
+
+TEST_F(StepSizeControllerTest, SöderlindPID) {
+  auto controller = StepSizeController::SöderlindPID();
+  controller.StepSizeFactor(2.0, order);
+  controller.StepSizeFactor(3.0, order);
+  EXPECT_THAT(controller.StepSizeFactor(5.0, order),
+              AlmostEquals(std::pow(5.0, 0.58 / order) *
+                           std::pow(3.0, -0.21 / order) *
+                           std::pow(2.0, 0.1 / order), 0, 1));
+}
+
+TEST_F(StepSizeControllerTest, Limits) {
+  auto controller = StepSizeController::GustafssonPI();
+  // A vanishing error doesn't produce an infinite step, and doesn't cause the
+  // next step to collapse.
+  EXPECT_EQ(std::pow(1e4, 0.7 / order),
+            controller.StepSizeFactor(std::numeric_limits<double>::infinity(),
+                                      order));
+  EXPECT_EQ(0.2, controller.StepSizeFactor(1.0, /*order=*/1));
+  EXPECT_EQ(10, controller.StepSizeFactor(1e4, /*order=*/1));
+}
+
+TEST_F(StepSizeControllerTest, Serialization) {
+  auto controller1 = StepSizeController::SöderlindPID();
+  controller1.StepSizeFactor(2.0, order);
+  controller1.StepSizeFactor(3.0, order);
+  serialization::StepSizeController message1;
+  controller1.WriteToMessage(&message1);
+  EXPECT_EQ(serialization::StepSizeController::SODERLIND_PID,
+            message1.kind());
+  EXPECT_EQ(2, message1.previous_ratio_size());
+  EXPECT_EQ(3.0, message1.previous_ratio(0));
+  EXPECT_EQ(2.0, message1.previous_ratio(1));
+
+  auto controller2 = StepSizeController::ReadFromMessage(message1);
+  serialization::StepSizeController message2;
+  controller2.WriteToMessage(&message2);
+  EXPECT_THAT(message2, EqualsProto(message1));
+  EXPECT_EQ(controller1.StepSizeFactor(5.0, order),
+            controller2.StepSizeFactor(5.0, order));
+}
+
+}  // namespace internal_step_size_controller
+}  // namespace integrators
+}  // namespace principia
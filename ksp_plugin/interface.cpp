@@ -91,6 +91,7 @@ using integrators::ParseAdaptiveStepSizeIntegrator;
 using integrators::ParseFixedStepSizeIntegrator;
 using ksp_plugin::AliceSun;
 using ksp_plugin::Barycentric;
+using ksp_plugin::GUID;
 using ksp_plugin::Part;
 using ksp_plugin::PartId;
 using ksp_plugin::RigidPart;
@@ -1103,11 +1104,18 @@ void __cdecl principia__UpdateCelestialHierarchy(Plugin const* const plugin,
   return m.Return();
 }
 
-void __cdecl principia__UpdatePrediction(Plugin const* const plugin,
-                                         char const* const vessel_guid) {
-  journal::Method<journal::UpdatePrediction> m({plugin, vessel_guid});
+void __cdecl principia__UpdatePrediction(
+    Plugin const* const plugin,
+    char const* const vessel_guid,
+    char const* const target_vessel_guid) {
+  journal::Method<journal::UpdatePrediction> m(
+      {plugin, vessel_guid, target_vessel_guid});
   CHECK_NOTNULL(plugin);
-  plugin->UpdatePrediction(vessel_guid);
+  plugin->UpdatePrediction(
+      vessel_guid,
+      target_vessel_guid == nullptr
+          ? std::nullopt
+          : std::make_optional<GUID>(target_vessel_guid));
   return m.Return();
 }
 
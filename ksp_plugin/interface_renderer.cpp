@@ -29,7 +29,8 @@ Renderer& GetRenderer(Plugin* const plugin) {
 
 void __cdecl principia__ClearTargetVessel(Plugin* const plugin) {
   journal::Method<journal::ClearTargetVessel> m({plugin});
-  GetRenderer(plugin).ClearTargetVessel();
+  CHECK_NOTNULL(plugin);
+  plugin->ClearTargetVessel();
   return m.Return();
 }
 
@@ -19,16 +19,16 @@ using physics::MasslessBody;
 using quantities::IsFinite;
 
 OrbitAnalyser::OrbitAnalyser(not_null<Ephemeris<Barycentric>*> const ephemeris,
+                             not_null<Prognosticator*> const prognosticator,
                              Ephemeris<Barycentric>::FixedStepParameters const&
                                  analysed_trajectory_parameters)
     : ephemeris_(ephemeris),
-      analysed_trajectory_parameters_(analysed_trajectory_parameters) {}
+      analysed_trajectory_parameters_(analysed_trajectory_parameters),
+      prognosticator_(prognosticator) {}
 
 OrbitAnalyser::~OrbitAnalyser() {
-  if (analyser_.joinable()) {
-    keep_analysing_ = false;
-    analyser_.join();
-  }
+  keep_analysing_ = false;
+  prognosticator_->Cancel(this);
 }
 
 void OrbitAnalyser::RequestAnalysis(
@@ -36,20 +36,22 @@ void OrbitAnalyser::RequestAnalysis(
     DegreesOfFreedom<Barycentric> const& first_degrees_of_freedom,
     Time const& mission_duration,
     not_null<RotatingBody<Barycentric> const*> primary) {
-  if (!analyser_.joinable()) {
-    analyser_ = std::thread([this] { RepeatedlyAnalyseOrbit(); });
-  }
   Ephemeris<Barycentric>::Guard guard(ephemeris_);
   if (ephemeris_->t_min() > first_time) {
     // Too much has been forgotten; we cannot perform this analysis.
     return;
   }
-  absl::MutexLock l(&lock_);
-  parameters_ = {std::move(guard),
-                 first_time,
-                 first_degrees_of_freedom,
-                 mission_duration,
-                 primary};
+  {
+    absl::MutexLock l(&lock_);
+    parameters_ = {std::move(guard),
+                   first_time,
+                   first_degrees_of_freedom,
+                   mission_duration,
+                   primary};
+  }
+  prognosticator_->Request(this,
+                           Prognosticator::Priority::Analysis,
+                           [this]() { AnalyseOrbit(); });
 }
 
 void OrbitAnalyser::RefreshAnalysis() {
@@ -68,93 +70,84 @@ double OrbitAnalyser::progress_of_next_analysis() const {
   return progress_of_next_analysis_;
 }
 
-void OrbitAnalyser::RepeatedlyAnalyseOrbit() {
-  for (;;) {
-    // No point in going faster than 50 Hz.
-    std::chrono::steady_clock::time_point const wakeup_time =
-        std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+void OrbitAnalyser::AnalyseOrbit() {
+  if (!keep_analysing_) {
+    return;
+  }
 
-    if (!keep_analysing_) {
+  std::optional<Parameters> parameters;
+  {
+    absl::MutexLock l(&lock_);
+    if (!parameters_.has_value()) {
       return;
     }
+    std::swap(parameters, parameters_);
+  }
 
-    std::optional<Parameters> parameters;
-    {
-      absl::ReaderMutexLock l(&lock_);
-      if (!parameters_.has_value()) {
-        // No parameters, let's wait for them to appear.
-        continue;
-      }
-      std::swap(parameters, parameters_);
-    }
-
-    Analysis analysis{parameters->first_time,
-                      parameters->primary};
-    DiscreteTrajectory<Barycentric> trajectory;
-    trajectory.Append(parameters->first_time,
-                      parameters->first_degrees_of_freedom);
-    std::vector<not_null<DiscreteTrajectory<Barycentric>*>> trajectories = {
-        &trajectory};
-    auto instance = ephemeris_->NewInstance(
-        trajectories,
-        Ephemeris<Barycentric>::NoIntrinsicAccelerations,
-        analysed_trajectory_parameters_);
-    for (Instant t =
-             parameters->first_time + parameters->mission_duration / 0x1p10;
-         trajectory.back().time <
-         parameters->first_time + parameters->mission_duration;
-         t += parameters->mission_duration / 0x1p10) {
-      if (!ephemeris_->FlowWithFixedStep(t, *instance).ok()) {
-        break;
-      }
-      progress_of_next_analysis_ =
-          (trajectory.back().time - parameters->first_time) /
-          parameters->mission_duration;
-      if (!keep_analysing_) {
-        return;
-      }
-    }
-    analysis.mission_duration_ =
-        trajectory.back().time - parameters->first_time;
-
-    // TODO(egg): |next_analysis_percentage_| only reflects the progress of the
-    // integration, but the analysis itself can take a while; this results in
-    // the progress bar being stuck at 100% while the elements and nodes are
-    // being computed.
-
-    using PrimaryCentred = Frame<enum class PrimaryCentredTag, NonRotating>;
-    BodyCentredNonRotatingDynamicFrame<Barycentric, PrimaryCentred>
-        primary_centred(ephemeris_, parameters->primary);
-    DiscreteTrajectory<PrimaryCentred> primary_centred_trajectory;
-    for (auto const& [time, degrees_of_freedom] : trajectory) {
-      primary_centred_trajectory.Append(
-          time, primary_centred.ToThisFrameAtTime(time)(degrees_of_freedom));
+  Analysis analysis{parameters->first_time,
+                    parameters->primary};
+  DiscreteTrajectory<Barycentric> trajectory;
+  trajectory.Append(parameters->first_time,
+                    parameters->first_degrees_of_freedom);
+  std::vector<not_null<DiscreteTrajectory<Barycentric>*>> trajectories = {
+      &trajectory};
+  auto instance = ephemeris_->NewInstance(
+      trajectories,
+      Ephemeris<Barycentric>::NoIntrinsicAccelerations,
+      analysed_trajectory_parameters_);
+  for (Instant t =
+           parameters->first_time + parameters->mission_duration / 0x1p10;
+       trajectory.back().time <
+       parameters->first_time + parameters->mission_duration;
+       t += parameters->mission_duration / 0x1p10) {
+    if (!ephemeris_->FlowWithFixedStep(t, *instance).ok()) {
+      break;
     }
-
-    auto const elements = OrbitalElements::ForTrajectory(
-        primary_centred_trajectory, *parameters->primary, MasslessBody{});
-    if (elements.ok()) {
-      analysis.elements_ = elements.ValueOrDie();
-      // TODO(egg): max_abs_Cᴛₒ should probably depend on the number of
-      // revolutions.
-      analysis.closest_recurrence_ = OrbitRecurrence::ClosestRecurrence(
-          analysis.elements_->nodal_period(),
-          analysis.elements_->nodal_precession(),
-          *parameters->primary,
-          /*max_abs_Cᴛₒ=*/100);
-      analysis.ground_track_ =
-          OrbitGroundTrack::ForTrajectory(primary_centred_trajectory,
-                                          *parameters->primary,
-                                          /*mean_sun=*/std::nullopt);
-      analysis.ResetRecurrence();
+    progress_of_next_analysis_ =
+        (trajectory.back().time - parameters->first_time) /
+        parameters->mission_duration;
+    if (!keep_analysing_) {
+      return;
     }
+  }
+  analysis.mission_duration_ =
+      trajectory.back().time - parameters->first_time;
+
+  // TODO(egg): |next_analysis_percentage_| only reflects the progress of the
+  // integration, but the analysis itself can take a while; this results in
+  // the progress bar being stuck at 100% while the elements and nodes are
+  // being computed.
+
+  using PrimaryCentred = Frame<enum class PrimaryCentredTag, NonRotating>;
+  BodyCentredNonRotatingDynamicFrame<Barycentric, PrimaryCentred>
+      primary_centred(ephemeris_, parameters->primary);
+  DiscreteTrajectory<PrimaryCentred> primary_centred_trajectory;
+  for (auto const& [time, degrees_of_freedom] : trajectory) {
+    primary_centred_trajectory.Append(
+        time, primary_centred.ToThisFrameAtTime(time)(degrees_of_freedom));
+  }
 
-    {
-      absl::MutexLock l(&lock_);
-      next_analysis_ = std::move(analysis);
-    }
+  auto const elements = OrbitalElements::ForTrajectory(
+      primary_centred_trajectory, *parameters->primary, MasslessBody{});
+  if (elements.ok()) {
+    analysis.elements_ = elements.ValueOrDie();
+    // TODO(egg): max_abs_Cᴛₒ should probably depend on the number of
+    // revolutions.
+    analysis.closest_recurrence_ = OrbitRecurrence::ClosestRecurrence(
+        analysis.elements_->nodal_period(),
+        analysis.elements_->nodal_precession(),
+        *parameters->primary,
+        /*max_abs_Cᴛₒ=*/100);
+    analysis.ground_track_ =
+        OrbitGroundTrack::ForTrajectory(primary_centred_trajectory,
+                                        *parameters->primary,
+                                        /*mean_sun=*/std::nullopt);
+    analysis.ResetRecurrence();
+  }
 
-    std::this_thread::sleep_until(wakeup_time);
+  {
+    absl::MutexLock l(&lock_);
+    next_analysis_ = std::move(analysis);
   }
 }
 
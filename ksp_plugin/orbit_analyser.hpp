@@ -2,7 +2,6 @@
 
 #include <atomic>
 #include <optional>
-#include <thread>
 
 #include "absl/synchronization/mutex.h"
 #include "astronomy/orbit_ground_track.hpp"
@@ -11,6 +10,7 @@
 #include "base/not_null.hpp"
 #include "geometry/named_quantities.hpp"
 #include "ksp_plugin/frames.hpp"
+#include "ksp_plugin/prognosticator.hpp"
 #include "physics/degrees_of_freedom.hpp"
 #include "physics/ephemeris.hpp"
 #include "physics/rotating_body.hpp"
@@ -32,7 +32,7 @@ using quantities::Time;
 
 // The |OrbitAnalyser| asynchronously integrates a trajectory, and computes
 // orbital elements, recurrence, and ground track properties of the resulting
-// orbit.
+// orbit.  The computations are run by the given |Prognosticator|.
 class OrbitAnalyser {
  public:
   // The analysis stores the computed orbital characteristics.  It is publicly
@@ -84,6 +84,7 @@ class OrbitAnalyser {
   };
 
   OrbitAnalyser(not_null<Ephemeris<Barycentric>*> ephemeris,
+                not_null<Prognosticator*> prognosticator,
                 Ephemeris<Barycentric>::FixedStepParameters const&
                     analysed_trajectory_parameters);
   ~OrbitAnalyser();
@@ -116,7 +117,9 @@ class OrbitAnalyser {
     not_null<RotatingBody<Barycentric> const*> primary;
   };
 
-  void RepeatedlyAnalyseOrbit();
+  // Run by the |prognosticator_| to compute an analysis from the latest
+  // |parameters_|, if any.
+  void AnalyseOrbit();
 
   not_null<Ephemeris<Barycentric>*> const ephemeris_;
   Ephemeris<Barycentric>::FixedStepParameters const
@@ -124,20 +127,20 @@ class OrbitAnalyser {
 
   std::optional<Analysis> analysis_;
 
+  not_null<Prognosticator*> const prognosticator_;
   mutable absl::Mutex lock_;
-  std::thread analyser_;
-  // |parameters_| is set by the main thread; it is read and cleared by the
-  // |analyser_| thread.
+  // |parameters_| is set by the main thread; it is read and cleared by
+  // |AnalyseOrbit|.
   std::optional<Parameters> parameters_ GUARDED_BY(lock_);
-  // |next_analysis_| is set by the |analyser_| thread; it is read and cleared
-  // by the main thread.
+  // |next_analysis_| is set by |AnalyseOrbit|; it is read and cleared by the
+  // main thread.
   std::optional<Analysis> next_analysis_ GUARDED_BY(lock_);
-  // |progress_of_next_analysis_| is set by the |analyser_| thread; it tracks
-  // progress in computing |next_analysis_|.
+  // |progress_of_next_analysis_| is set by |AnalyseOrbit|; it tracks progress
+  // in computing |next_analysis_|.
   std::atomic<double> progress_of_next_analysis_ = 0;
-  // |keep_analysing_| is tested by the |analyser_| thread, which cooperatively
-  // aborts if it is false; it is set at construction, and cleared by the main
-  // thread at destruction.
+  // |keep_analysing_| is tested by |AnalyseOrbit|, which cooperatively aborts
+  // if it is false; it is set at construction, and cleared by the main thread
+  // at destruction.
   std::atomic_bool keep_analysing_ = true;
 };
 
@@ -58,10 +58,10 @@ PileUp::PileUp(
     mechanical_system.AddRigidBody(
         part->rigid_motion(), part->mass(), part->inertia_tensor());
   }
-  auto const barycentre = mechanical_system.centre_of_mass();
-  history_->Append(t, barycentre);
+  auto const moments = mechanical_system.ComputeMoments();
+  history_->Append(t, moments.centre_of_mass);
 
-  angular_momentum_ = mechanical_system.AngularMomentum();
+  angular_momentum_ = moments.angular_momentum;
 
   RigidMotion<Barycentric, NonRotatingPileUp> const barycentric_to_pile_up =
       mechanical_system.LinearMotion().Inverse();
@@ -316,12 +316,13 @@ void PileUp::DeformPileUpIfNeeded() {
     apparent_system.AddRigidBody(
         apparent_part_rigid_motion, part->mass(), part->inertia_tensor());
   }
-  auto const apparent_centre_of_mass = apparent_system.centre_of_mass();
-  auto const apparent_angular_momentum = apparent_system.AngularMomentum();
+  auto const apparent_moments = apparent_system.ComputeMoments();
+  auto const& apparent_centre_of_mass = apparent_moments.centre_of_mass;
+  auto const& apparent_angular_momentum = apparent_moments.angular_momentum;
   // Note that the inertia tensor is with respect to the centre of mass, so it
   // is unaffected by the apparent-bubble-to-pile-up correction, which is rigid
   // and involves no change in axes.
-  auto const inertia_tensor = apparent_system.InertiaTensor();
+  auto const& inertia_tensor = apparent_moments.inertia_tensor;
   // The angular velocity of a rigid body with the inertia and angular momentum
   // of the apparent parts.
   auto const apparent_equivalent_angular_velocity =
@@ -250,7 +250,7 @@ RP2Lines<Length, Camera> Planetarium::PlotMethod2(
   return lines;
 }
 
-std::vector<Sphere<Navigation>> Planetarium::ComputePlottableSpheres(
+SphereHierarchy<Navigation> Planetarium::ComputePlottableSpheres(
     Instant const& now) const {
   RigidMotion<Barycentric, Navigation> const rigid_motion_at_now =
       plotting_frame_->ToThisFrameAtTime(now);
@@ -272,11 +272,11 @@ std::vector<Sphere<Navigation>> Planetarium::ComputePlottableSpheres(
       plottable_spheres.emplace_back(std::move(plottable_sphere));
     }
   }
-  return plottable_spheres;
+  return perspective_.ComputeSphereHierarchy(std::move(plottable_spheres));
 }
 
 Segments<Navigation> Planetarium::ComputePlottableSegments(
-    const std::vector<Sphere<Navigation>>& plottable_spheres,
+    SphereHierarchy<Navigation> const& plottable_spheres,
     DiscreteTrajectory<Barycentric>::Iterator const& begin,
     DiscreteTrajectory<Barycentric>::Iterator const& end) const {
   Segments<Navigation> all_segments;
@@ -30,6 +30,7 @@ using geometry::RP2Point;
 using geometry::Segment;
 using geometry::Segments;
 using geometry::Sphere;
+using geometry::SphereHierarchy;
 using physics::DegreesOfFreedom;
 using physics::DiscreteTrajectory;
 using physics::Ephemeris;
@@ -102,14 +103,15 @@ class Planetarium {
 
  private:
   // Computes the coordinates of the spheres that represent the |ephemeris_|
-  // bodies.  These coordinates are in the |plotting_frame_| at time |now|.
-  std::vector<Sphere<Navigation>> ComputePlottableSpheres(
+  // bodies.  These coordinates are in the |plotting_frame_| at time |now|.  The
+  // spheres are organized in a hierarchy to speed up hiding.
+  SphereHierarchy<Navigation> ComputePlottableSpheres(
       Instant const& now) const;
 
   // Computes the segments of the trajectory defined by |begin| and |end| that
   // are not hidden by the |plottable_spheres|.
   Segments<Navigation> ComputePlottableSegments(
-      const std::vector<Sphere<Navigation>>& plottable_spheres,
+      SphereHierarchy<Navigation> const& plottable_spheres,
       DiscreteTrajectory<Barycentric>::Iterator const& begin,
       DiscreteTrajectory<Barycentric>::Iterator const& end) const;
 
@@ -28,6 +28,7 @@
 #include "base/serialization.hpp"
 #include "base/status.hpp"
 #include "base/unique_ptr_logging.hpp"
+#include "base/work_stealing_executor.hpp"
 #include "geometry/affine_map.hpp"
 #include "geometry/barycentre_calculator.hpp"
 #include "geometry/frame.hpp"
@@ -41,6 +42,7 @@
 #include "ksp_plugin/integrators.hpp"
 #include "ksp_plugin/part.hpp"
 #include "ksp_plugin/part_subsets.hpp"
+#include "ksp_plugin/prognosticator.hpp"
 #include "physics/apsides.hpp"
 #include "physics/barycentric_rotating_dynamic_frame_body.hpp"
 #include "physics/body_centred_body_direction_dynamic_frame.hpp"
@@ -63,6 +65,7 @@ using astronomy::KSPStockSystemFingerprint;
 using astronomy::ParseTT;
 using astronomy::StabilizeKSP;
 using base::check_not_null;
+using base::Completion;
 using base::dynamic_cast_not_null;
 using base::Error;
 using base::FindOrDie;
@@ -112,10 +115,24 @@ using quantities::si::Minute;
 using quantities::si::Radian;
 using ::operator<<;
 
+namespace {
+
+// Leave one core to the main thread, but have at least one worker besides the
+// one reserved for the predictions of the active and target vessels.
+std::int64_t NumberOfPrognosticatorWorkers() {
+  return std::max<std::int64_t>(
+      2, static_cast<std::int64_t>(std::thread::hardware_concurrency()) - 1);
+}
+
+}  // namespace
+
 Plugin::Plugin(std::string const& game_epoch,
                std::string const& solar_system_epoch,
                Angle const& planetarium_rotation)
-    : history_parameters_(DefaultHistoryParameters()),
+    : prognosticator_(NumberOfPrognosticatorWorkers(),
+                      /*reserved_workers=*/1,
+                      FlightPlan::max_ephemeris_steps_per_frame),
+      history_parameters_(DefaultHistoryParameters()),
       psychohistory_parameters_(DefaultPsychohistoryParameters()),
       vessel_thread_pool_(
           /*pool_size=*/2 * std::thread::hardware_concurrency()),
@@ -388,6 +405,7 @@ void Plugin::InsertOrKeepVessel(GUID const& vessel_guid,
                                          vessel_name,
                                          parent,
                                          ephemeris_.get(),
+                                         &prognosticator_,
                                          prediction_parameters));
   } else {
     inserted = false;
@@ -744,40 +762,15 @@ void Plugin::AdvanceTime(Instant const& t, Angle const& planetarium_rotation) {
   current_time_ = t;
   planetarium_rotation_ = planetarium_rotation;
   ephemeris_->Prolong(current_time_);
+  prognosticator_.StartFrame();
   UpdatePlanetariumRotation();
   loaded_vessels_.clear();
 }
 
 void Plugin::CatchUpLaggingVessels(VesselSet& collided_vessels) {
   CHECK(!initializing_);
-
-  // Start all the integrations in parallel.
-  std::vector<PileUpFuture> pile_up_futures;
-  for (auto* const pile_up : pile_ups_) {
-    pile_up_futures.emplace_back(
-        pile_up,
-        vessel_thread_pool_.Add([this, pile_up]() {
-          // Note that there cannot be contention in the following method as
-          // no two pile-ups are advanced at the same time.
-          return pile_up->DeformAndAdvanceTime(current_time_);
-        }));
-  }
-
-  // Wait for the integrations to finish and figure out which vessels collided
-  // with a celestial.
-  for (auto& pile_up_future : pile_up_futures) {
-    WaitForVesselToCatchUp(pile_up_future, collided_vessels);
-  }
-
-  // Update the vessels.
-  for (auto const& [_, vessel] : vessels_) {
-    if (vessel->psychohistory().back().time < current_time_) {
-      if (Contains(collided_vessels, vessel.get())) {
-        vessel->DisableDownsampling();
-      }
-      vessel->AdvanceTime();
-    }
-  }
+  CatchUpLaggingPileUps(collided_vessels);
+  AdvanceLaggingVessels(collided_vessels, vessel_thread_pool_.executor());
 }
 
 not_null<std::unique_ptr<PileUpFuture>> Plugin::CatchUpVessel(
@@ -825,13 +818,11 @@ void Plugin::WaitForVesselToCatchUp(PileUpFuture& pile_up_future,
   }
 }
 
-void Plugin::ForgetAllHistoriesBefore(Instant const& t) const {
+void Plugin::ForgetAllHistoriesBefore(Instant const& t) {
   CHECK(!initializing_);
   CHECK_LT(t, current_time_);
   ephemeris_->EventuallyForgetBefore(t);
-  for (auto const& [_, vessel] : vessels_) {
-    vessel->ForgetBefore(t);
-  }
+  ForgetVesselHistoriesBefore(t, vessel_thread_pool_.executor());
 }
 
 RelativeDegreesOfFreedom<AliceSun> Plugin::VesselFromParent(
@@ -884,7 +875,9 @@ void Plugin::SetPredictionAdaptiveStepParameters(
           prediction_adaptive_step_parameters);
 }
 
-void Plugin::UpdatePrediction(GUID const& vessel_guid) const {
+void Plugin::UpdatePrediction(
+    GUID const& vessel_guid,
+    std::optional<GUID> const& target_vessel_guid) const {
   CHECK(!initializing_);
   Vessel& vessel = *FindOrDie(vessels_, vessel_guid);
 
@@ -893,10 +886,15 @@ void Plugin::UpdatePrediction(GUID const& vessel_guid) const {
   // targetting frame.
   if (renderer_->HasTargetVessel()) {
     Vessel& target_vessel = renderer_->GetTargetVessel();
+    SetPredictionPriorities(vessel_guid, target_vessel.guid());
     target_vessel.RefreshPrediction();
     vessel.RefreshPrediction(target_vessel.prediction().back().time);
   } else {
+    SetPredictionPriorities(vessel_guid, target_vessel_guid);
     vessel.RefreshPrediction();
+    if (target_vessel_guid.has_value()) {
+      FindOrDie(vessels_, *target_vessel_guid)->RefreshPrediction();
+    }
   }
 }
 
@@ -1105,9 +1103,19 @@ void Plugin::SetTargetVessel(GUID const& vessel_guid,
   not_null<Celestial const*> const celestial =
       FindOrDie(celestials_, reference_body_index).get();
   not_null<Vessel*> const vessel = FindOrDie(vessels_, vessel_guid).get();
+  SetPredictionPriorities(active_vessel_guid_, vessel_guid);
   renderer_->SetTargetVessel(vessel, celestial, ephemeris_.get());
 }
 
+void Plugin::ClearTargetVessel() {
+  // The adapter calls this function at every frame when the renderer has no
+  // target; the target of |UpdatePrediction|, if any, is left alone.
+  if (renderer_->HasTargetVessel()) {
+    SetPredictionPriorities(active_vessel_guid_, std::nullopt);
+    renderer_->ClearTargetVessel();
+  }
+}
+
 std::unique_ptr<FrameField<World, Navball>> Plugin::NavballFrameField(
     Position<World> const& sun_world_position) const {
 
@@ -1377,6 +1385,7 @@ not_null<std::unique_ptr<Plugin>> Plugin::ReadFromMessage(
         vessel_message.vessel(),
         parent,
         plugin->ephemeris_.get(),
+        &plugin->prognosticator_,
         [&part_id_to_vessel = plugin->part_id_to_vessel_](
             PartId const part_id) {
           CHECK_NE(part_id_to_vessel.erase(part_id), 0) << part_id;
@@ -1470,7 +1479,10 @@ Plugin::Plugin(
     Ephemeris<Barycentric>::FixedStepParameters const& history_parameters,
     Ephemeris<Barycentric>::AdaptiveStepParameters const&
         psychohistory_parameters)
-    : history_parameters_(history_parameters),
+    : prognosticator_(NumberOfPrognosticatorWorkers(),
+                      /*reserved_workers=*/1,
+                      FlightPlan::max_ephemeris_steps_per_frame),
+      history_parameters_(history_parameters),
       psychohistory_parameters_(psychohistory_parameters),
       vessel_thread_pool_(
           /*pool_size=*/2 * std::thread::hardware_concurrency()) {}
@@ -1579,6 +1591,87 @@ bool Plugin::is_loaded(not_null<Vessel*> vessel) const {
   return Contains(loaded_vessels_, vessel);
 }
 
+void Plugin::CatchUpLaggingPileUps(VesselSet& collided_vessels) {
+  // Start all the integrations in parallel.
+  std::vector<PileUpFuture> pile_up_futures;
+  for (auto* const pile_up : pile_ups_) {
+    pile_up_futures.emplace_back(
+        pile_up,
+        vessel_thread_pool_.Add([this, pile_up]() {
+          // Note that there cannot be contention in the following method as
+          // no two pile-ups are advanced at the same time.
+          return pile_up->DeformAndAdvanceTime(current_time_);
+        }));
+  }
+
+  // Wait for the integrations to finish and figure out which vessels collided
+  // with a celestial.
+  for (auto& pile_up_future : pile_up_futures) {
+    WaitForVesselToCatchUp(pile_up_future, collided_vessels);
+  }
+}
+
+void Plugin::AdvanceLaggingVessels(VesselSet const& collided_vessels,
+                                   WorkStealingExecutor& executor) const {
+  // The vessels don't share any state, so this is done in parallel.
+  Completion vessels_advanced;
+  for (auto const& [_, vessel] : vessels_) {
+    if (vessel->psychohistory().back().time < current_time_) {
+      bool const collided = Contains(collided_vessels, vessel.get());
+      executor.Add(
+          [collided, vessel = vessel.get()]() {
+            if (collided) {
+              vessel->DisableDownsampling();
+            }
+            vessel->AdvanceTime();
+          },
+          &vessels_advanced);
+    }
+  }
+  vessels_advanced.Wait();
+}
+
+void Plugin::ForgetVesselHistoriesBefore(Instant const& t,
+                                         WorkStealingExecutor& executor) const {
+  Completion histories_forgotten;
+  for (auto const& [_, vessel] : vessels_) {
+    executor.Add([&t, vessel = vessel.get()]() { vessel->ForgetBefore(t); },
+                 &histories_forgotten);
+  }
+  histories_forgotten.Wait();
+}
+
+void Plugin::SetPredictionPriorities(
+    std::optional<GUID> const& active_vessel_guid,
+    std::optional<GUID> const& target_vessel_guid) const {
+  // The vessels may have been deleted since they got their priority.
+  auto const set_prediction_priority =
+      [this](std::optional<GUID> const& vessel_guid,
+             Prognosticator::Priority const priority) {
+        if (vessel_guid.has_value()) {
+          auto const it = vessels_.find(*vessel_guid);
+          if (it != vessels_.end()) {
+            it->second->set_prediction_priority(priority);
+          }
+        }
+      };
+  for (auto const& previous_vessel_guid :
+       {active_vessel_guid_, target_vessel_guid_}) {
+    if (previous_vessel_guid != active_vessel_guid &&
+        previous_vessel_guid != target_vessel_guid) {
+      set_prediction_priority(previous_vessel_guid,
+                              Prognosticator::Priority::Background);
+    }
+  }
+  active_vessel_guid_ = active_vessel_guid;
+  target_vessel_guid_ = target_vessel_guid;
+  // If the active vessel is also the target, it gets the higher priority.
+  set_prediction_priority(target_vessel_guid,
+                          Prognosticator::Priority::Target);
+  set_prediction_priority(active_vessel_guid,
+                          Prognosticator::Priority::Active);
+}
+
 }  // namespace internal_plugin
 }  // namespace ksp_plugin
 }  // namespace principia
@@ -24,6 +24,7 @@
 #include "ksp_plugin/frames.hpp"
 #include "ksp_plugin/manœuvre.hpp"
 #include "ksp_plugin/planetarium.hpp"
+#include "ksp_plugin/prognosticator.hpp"
 #include "ksp_plugin/renderer.hpp"
 #include "ksp_plugin/vessel.hpp"
 #include "integrators/ordinary_differential_equations.hpp"
@@ -51,6 +52,7 @@ using base::not_null;
 using base::Status;
 using base::Subset;
 using base::ThreadPool;
+using base::WorkStealingExecutor;
 using geometry::AffineMap;
 using geometry::AngularVelocity;
 using geometry::Bivector;
@@ -276,7 +278,8 @@ class Plugin {
 
   // Simulates the system until instant |t|.  Sets |current_time_| to |t|.
   // Must be called after initialization.
-  // Clears the intrinsic force on all loaded parts.
+  // Clears the intrinsic force on all loaded parts, and replenishes the budget
+  // of ephemeris steps of the predictions.
   // |t| must be greater than |current_time_|.  |planetarium_rotation| is the
   // value of KSP's |Planetarium.InverseRotAngle| at instant |t|, which provides
   // the rotation between the |World| axes and the |Barycentric| axes (we don't
@@ -307,7 +310,7 @@ class Plugin {
                                       VesselSet& collided_vessels);
 
   // Forgets the histories of the |celestials_| and of the vessels before |t|.
-  virtual void ForgetAllHistoriesBefore(Instant const& t) const;
+  virtual void ForgetAllHistoriesBefore(Instant const& t);
 
   // Returns the displacement and velocity of the vessel with GUID |vessel_guid|
   // relative to its parent at current time. For a KSP |Vessel| |v|, the
@@ -333,8 +336,14 @@ class Plugin {
       Ephemeris<Barycentric>::AdaptiveStepParameters const&
           prediction_adaptive_step_parameters) const;
 
-  // Updates the prediction for the vessel with guid |vessel_guid|.
-  void UpdatePrediction(GUID const& vessel_guid) const;
+  // Updates the prediction for the vessel with guid |vessel_guid|, which is
+  // the vessel that the user is looking at, and for the target vessel, which is
+  // either the target of the renderer or the vessel with guid
+  // |target_vessel_guid|, if any.  The predictions of these vessels get the
+  // |Active| and |Target| priorities, respectively, and the vessels that had
+  // these priorities before this call get the |Background| priority.
+  void UpdatePrediction(GUID const& vessel_guid,
+                        std::optional<GUID> const& target_vessel_guid) const;
 
   virtual void CreateFlightPlan(GUID const& vessel_guid,
                                 Instant const& final_time,
@@ -396,6 +405,7 @@ class Plugin {
 
   virtual void SetTargetVessel(GUID const& vessel_guid,
                                Index reference_body_index);
+  virtual void ClearTargetVessel();
 
   // The navball field at |current_time| for the current |plotting_frame_|.
   virtual std::unique_ptr<FrameField<World, Navball>> NavballFrameField(
@@ -484,6 +494,25 @@ class Plugin {
   // Whether |loaded_vessels_| contains |vessel|.
   bool is_loaded(not_null<Vessel*> vessel) const;
 
+  // The two phases of |CatchUpLaggingVessels|.  The first one integrates the
+  // pile ups and inserts the vessels that collided with a celestial into
+  // |collided_vessels|, the second one advances time on the vessels on the
+  // given |executor|.
+  void CatchUpLaggingPileUps(VesselSet& collided_vessels);
+  void AdvanceLaggingVessels(VesselSet const& collided_vessels,
+                             WorkStealingExecutor& executor) const;
+
+  // Forgets the histories of the vessels before |t| on the given |executor|.
+  void ForgetVesselHistoriesBefore(Instant const& t,
+                                   WorkStealingExecutor& executor) const;
+
+  // Gives the |Active| and |Target| priorities to the predictions of the given
+  // vessels, if any, and the |Background| priority to the vessels that had
+  // these priorities before this call, if they still exist.
+  void SetPredictionPriorities(
+      std::optional<GUID> const& active_vessel_guid,
+      std::optional<GUID> const& target_vessel_guid) const;
+
   // Initialization objects.
   base::Monostable initializing_;
   serialization::GravityModel gravity_model_;
@@ -500,6 +529,9 @@ class Plugin {
   std::optional<Ephemeris<Barycentric>::FixedStepParameters>
       ephemeris_fixed_step_parameters_;
 
+  // Computes the predictions and orbit analyses of the |vessels_|, which must
+  // therefore be destroyed first.
+  Prognosticator prognosticator_;
   GUIDToOwnedVessel vessels_;
   // For each part, the vessel that this part belongs to. The part is guaranteed
   // to be in the parts() map of the vessel, and owned by it.
@@ -548,6 +580,12 @@ class Plugin {
   std::map<GUID, Ephemeris<Barycentric>::AdaptiveStepParameters>
   zombie_prediction_adaptive_step_parameters_;
 
+  // The vessels whose predictions have the |Active| and |Target| priorities.
+  // Mutable because they are updated by |UpdatePrediction|.
+  mutable std::optional<GUID> active_vessel_guid_;
+  mutable std::optional<GUID> target_vessel_guid_;
+
+  friend class BenchmarkablePlugin;
   friend class NavballFrameField;
   friend class TestablePlugin;
 };
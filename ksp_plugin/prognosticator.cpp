@@ -0,0 +1,212 @@
+﻿
+#include "ksp_plugin/prognosticator.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "glog/logging.h"
+
+namespace principia {
+namespace ksp_plugin {
+namespace internal_prognosticator {
+
+Prognosticator::Prognosticator(std::int64_t const number_of_workers,
+                               std::int64_t const reserved_workers,
+                               std::int64_t const ephemeris_steps_per_frame)
+    : max_non_urgent_computations_(number_of_workers - reserved_workers),
+      ephemeris_steps_per_frame_(ephemeris_steps_per_frame),
+      ephemeris_steps_left_(ephemeris_steps_per_frame),
+      executor_(number_of_workers) {
+  CHECK_LE(0, reserved_workers);
+  CHECK_LT(reserved_workers, number_of_workers);
+  CHECK_LE(0, ephemeris_steps_per_frame);
+}
+
+Prognosticator::~Prognosticator() {
+  absl::MutexLock l(&lock_);
+  CHECK(clients_.empty()) << clients_.size() << " clients not cancelled";
+}
+
+void Prognosticator::Request(void const* const client,
+                             Priority const priority,
+                             std::function<void()> computation) {
+  CHECK(computation != nullptr);
+  absl::MutexLock l(&lock_);
+  Client& state = clients_[client];
+  ++statistics_.requests;
+  if (state.pending_computation != nullptr) {
+    ++statistics_.dropped_requests;
+  }
+  // The dropped computation is destroyed after we release the lock.
+  std::swap(state.pending_computation, computation);
+  state.request_time = std::chrono::steady_clock::now();
+  if (state.ready && state.priority != priority) {
+    // Requeue the client with its new priority.
+    MakeUnready(client, state);
+  }
+  state.priority = priority;
+  if (!state.ready && !state.running) {
+    MakeReady(client, state);
+  }
+}
+
+void Prognosticator::Cancel(void const* const client) {
+  std::function<void()> dropped_computation;
+  absl::MutexLock l(&lock_);
+  auto const it = clients_.find(client);
+  if (it == clients_.end()) {
+    return;
+  }
+  Client& state = it->second;
+  std::swap(dropped_computation, state.pending_computation);
+  if (state.ready) {
+    // The task added to the executor for this client will run the next ready
+    // client, if any.
+    MakeUnready(client, state);
+  }
+  auto const not_running = [&state]() { return !state.running; };
+  lock_.Await(absl::Condition(&not_running));
+  clients_.erase(it);
+}
+
+void Prognosticator::StartFrame() {
+  absl::MutexLock l(&lock_);
+  ++frame_;
+  auto const& spent = statistics_.ephemeris_steps_this_frame;
+  ephemeris_steps_left_ = ephemeris_steps_per_frame_;
+  urgent_ephemeris_steps_reserved_ =
+      std::min(ephemeris_steps_per_frame_,
+               spent[static_cast<int>(Priority::Active)] +
+                   spent[static_cast<int>(Priority::Target)]);
+  statistics_.ephemeris_steps_last_frame =
+      statistics_.ephemeris_steps_this_frame;
+  statistics_.ephemeris_steps_this_frame.fill(0);
+}
+
+Prognosticator::EphemerisSteps Prognosticator::DrawEphemerisSteps(
+    Priority const priority) {
+  absl::MutexLock l(&lock_);
+  std::int64_t const steps =
+      IsUrgent(priority)
+          ? ephemeris_steps_left_
+          : std::max<std::int64_t>(
+                0, ephemeris_steps_left_ - urgent_ephemeris_steps_reserved_);
+  ephemeris_steps_left_ -= steps;
+  return {frame_, steps};
+}
+
+void Prognosticator::SettleEphemerisSteps(Priority const priority,
+                                          EphemerisSteps const& drawn,
+                                          std::int64_t const spent) {
+  CHECK_LE(0, spent);
+  CHECK_LE(spent, drawn.steps);
+  absl::MutexLock l(&lock_);
+  statistics_.ephemeris_steps_this_frame[static_cast<int>(priority)] += spent;
+  if (drawn.frame == frame_) {
+    ephemeris_steps_left_ += drawn.steps - spent;
+    if (IsUrgent(priority)) {
+      urgent_ephemeris_steps_reserved_ -=
+          std::min(urgent_ephemeris_steps_reserved_, spent);
+    }
+  }
+}
+
+Prognosticator::Statistics Prognosticator::statistics() const {
+  absl::ReaderMutexLock l(&lock_);
+  return statistics_;
+}
+
+void Prognosticator::RunNext() {
+  void const* client;
+  std::function<void()> computation;
+  std::chrono::steady_clock::time_point request_time;
+  bool urgent;
+  {
+    absl::MutexLock l(&lock_);
+    auto const first_nonempty =
+        std::find_if(ready_clients_.begin(),
+                     ready_clients_.end(),
+                     [](std::deque<void const*> const& clients) {
+                       return !clients.empty();
+                     });
+    if (first_nonempty == ready_clients_.end()) {
+      // The client was cancelled or requeued.
+      return;
+    }
+    urgent = IsUrgent(static_cast<Priority>(
+        std::distance(ready_clients_.begin(), first_nonempty)));
+    if (!urgent &&
+        running_non_urgent_computations_ == max_non_urgent_computations_) {
+      // The client will be run when a non-urgent computation finishes.
+      return;
+    }
+    if (!urgent) {
+      ++running_non_urgent_computations_;
+    }
+    client = first_nonempty->front();
+    first_nonempty->pop_front();
+    Client& state = clients_.at(client);
+    state.ready = false;
+    state.running = true;
+    std::swap(computation, state.pending_computation);
+    request_time = state.request_time;
+    --statistics_.queue_depth;
+    ++statistics_.running;
+    auto const waiting_time = std::chrono::steady_clock::now() - request_time;
+    statistics_.total_waiting_time += waiting_time;
+    statistics_.max_waiting_time =
+        std::max(statistics_.max_waiting_time, waiting_time);
+  }
+
+  computation();
+  // Destroy the computation outside of the lock, as it may own objects whose
+  // destruction takes locks.
+  computation = nullptr;
+
+  absl::MutexLock l(&lock_);
+  Client& state = clients_.at(client);
+  state.running = false;
+  --statistics_.running;
+  ++statistics_.completed_requests;
+  auto const latency = std::chrono::steady_clock::now() - request_time;
+  statistics_.total_latency += latency;
+  statistics_.max_latency = std::max(statistics_.max_latency, latency);
+  if (state.pending_computation != nullptr) {
+    MakeReady(client, state);
+  }
+  if (!urgent) {
+    --running_non_urgent_computations_;
+    bool const has_ready_non_urgent_clients = std::any_of(
+        ready_clients_.begin() + static_cast<int>(Priority::Background),
+        ready_clients_.end(),
+        [](std::deque<void const*> const& clients) {
+          return !clients.empty();
+        });
+    if (has_ready_non_urgent_clients) {
+      executor_.Add([this]() { RunNext(); });
+    }
+  }
+}
+
+bool Prognosticator::IsUrgent(Priority const priority) {
+  return priority == Priority::Active || priority == Priority::Target;
+}
+
+void Prognosticator::MakeReady(void const* const client, Client& state) {
+  state.ready = true;
+  ready_clients_[static_cast<int>(state.priority)].push_back(client);
+  ++statistics_.queue_depth;
+  executor_.Add([this]() { RunNext(); });
+}
+
+void Prognosticator::MakeUnready(void const* const client, Client& state) {
+  auto& clients = ready_clients_[static_cast<int>(state.priority)];
+  clients.erase(std::find(clients.begin(), clients.end(), client));
+  state.ready = false;
+  --statistics_.queue_depth;
+}
+
+}  // namespace internal_prognosticator
+}  // namespace ksp_plugin
+}  // namespace principia
@@ -0,0 +1,183 @@
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "base/work_stealing_executor.hpp"
+
+namespace principia {
+namespace ksp_plugin {
+namespace internal_prognosticator {
+
+using base::WorkStealingExecutor;
+
+// The |Prognosticator| runs the asynchronous computations of all the vessels
+// (predictions and orbit analyses) on a bounded number of workers, instead of
+// having one thread per computation.  Each client (typically, a |Vessel| or an
+// |OrbitAnalyser|) has at most one running and one pending computation: a new
+// request replaces the pending one, if any, so that stale parameters are never
+// used.  The clients that have a pending computation are served by decreasing
+// priority, and in the order in which they became ready within a priority.
+// Computations are not preempted, so some workers are reserved for the
+// |Active| and |Target| priorities, lest they wait for long-running background
+// computations.
+// The computations share a budget of ephemeris steps, which is replenished at
+// each frame: the steps by which they prolong the ephemeris are drawn from it.
+// This class is thread-safe.
+class Prognosticator {
+ public:
+  // The classes of computations, by decreasing priority.
+  enum class Priority {
+    // The prediction of the vessel that the user is flying.
+    Active,
+    // The prediction of the target vessel, which is needed to draw the
+    // trajectory of the active vessel in the targetting frame.
+    Target,
+    // The predictions of the other vessels.
+    Background,
+    // The orbit analyses, which take much longer than the predictions.
+    Analysis,
+  };
+  static constexpr int number_of_priorities = 4;
+
+  struct Statistics {
+    // The number of clients whose pending computation is waiting for a worker.
+    std::int64_t queue_depth = 0;
+    // The number of computations being executed.
+    std::int64_t running = 0;
+
+    std::int64_t requests = 0;
+    // The requests that were replaced by a subsequent one before they started.
+    std::int64_t dropped_requests = 0;
+    std::int64_t completed_requests = 0;
+
+    // For the completed requests, the time from the request to the start of the
+    // computation, and the time from the request to its completion.
+    std::chrono::steady_clock::duration total_waiting_time{};
+    std::chrono::steady_clock::duration max_waiting_time{};
+    std::chrono::steady_clock::duration total_latency{};
+    std::chrono::steady_clock::duration max_latency{};
+
+    // The number of steps by which the computations prolonged the ephemeris in
+    // the current frame and in the previous one, indexed by |Priority|.
+    std::array<std::int64_t, number_of_priorities>
+        ephemeris_steps_this_frame{};
+    std::array<std::int64_t, number_of_priorities>
+        ephemeris_steps_last_frame{};
+  };
+
+  // The steps by which a computation may prolong the ephemeris, returned by
+  // |DrawEphemerisSteps|.
+  struct EphemerisSteps {
+    std::int64_t frame;
+    std::int64_t steps;
+  };
+
+  // At most |number_of_workers - reserved_workers| computations of priority
+  // |Background| or |Analysis| run at the same time.  The computations may
+  // prolong the ephemeris by at most |ephemeris_steps_per_frame| steps in each
+  // frame, all together.
+  Prognosticator(std::int64_t number_of_workers,
+                 std::int64_t reserved_workers,
+                 std::int64_t ephemeris_steps_per_frame);
+
+  // Executes the pending computations.  The clients must have been cancelled.
+  ~Prognosticator();
+
+  // Schedules |computation| on behalf of |client|.  If |client| already has a
+  // pending computation, it is replaced by |computation|, which is queued with
+  // the given |priority|.  If a computation of |client| is running,
+  // |computation| starts after it finishes.
+  void Request(void const* client,
+               Priority priority,
+               std::function<void()> computation);
+
+  // Drops the pending computation of |client|, if any, and waits for its
+  // running computation, if any, to finish.  Must not be called from a
+  // computation.
+  void Cancel(void const* client);
+
+  // Starts a new frame, which replenishes the budget of ephemeris steps.  The
+  // steps that the |Active| and |Target| computations spent in the frame that
+  // ends are reserved for them in the new one.
+  void StartFrame();
+
+  // Draws from the budget of the current frame the steps by which a
+  // computation of the given |priority| may prolong the ephemeris.  An |Active|
+  // or |Target| computation draws all the steps left.  The other computations
+  // only draw the steps left beyond those reserved for the |Active| and
+  // |Target| computations, which they have not spent yet in this frame.  The
+  // result must be passed to |SettleEphemerisSteps|.
+  EphemerisSteps DrawEphemerisSteps(Priority priority);
+
+  // Records that a computation of the given |priority| prolonged the ephemeris
+  // by |spent| of its |drawn| steps.  The steps that it did not spend go back
+  // to the budget, unless the frame in which they were drawn is over.
+  void SettleEphemerisSteps(Priority priority,
+                            EphemerisSteps const& drawn,
+                            std::int64_t spent);
+
+  Statistics statistics() const;
+
+ private:
+  struct Client {
+    // Empty if there is no pending computation.
+    std::function<void()> pending_computation;
+    Priority priority = Priority::Background;
+    std::chrono::steady_clock::time_point request_time;
+    // True if |client| is in |ready_clients_[priority]|.
+    bool ready = false;
+    bool running = false;
+  };
+
+  // Executes the pending computation of the first ready client of the highest
+  // priority, if any, unless that priority is not urgent and the maximum number
+  // of such computations are running.  One such task is added to the executor
+  // each time a client is added to |ready_clients_|, and each time a non-urgent
+  // computation finishes while non-urgent clients are ready.
+  void RunNext();
+
+  static bool IsUrgent(Priority priority);
+
+  // Adds |client| to |ready_clients_| and schedules its execution.
+  void MakeReady(void const* client, Client& state)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Removes |client|, which must be ready, from |ready_clients_|.
+  void MakeUnready(void const* client, Client& state)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  mutable absl::Mutex lock_;
+  std::map<void const*, Client> clients_ GUARDED_BY(lock_);
+  // Indexed by |Priority|.
+  std::array<std::deque<void const*>, number_of_priorities> ready_clients_
+      GUARDED_BY(lock_);
+  Statistics statistics_ GUARDED_BY(lock_);
+  std::int64_t const max_non_urgent_computations_;
+  std::int64_t running_non_urgent_computations_ GUARDED_BY(lock_) = 0;
+
+  std::int64_t const ephemeris_steps_per_frame_;
+  std::int64_t frame_ GUARDED_BY(lock_) = 0;
+  // The steps of the current frame that have not been drawn.
+  std::int64_t ephemeris_steps_left_ GUARDED_BY(lock_);
+  // The steps of the current frame that only the |Active| and |Target|
+  // computations may draw.
+  std::int64_t urgent_ephemeris_steps_reserved_ GUARDED_BY(lock_) = 0;
+
+  // Must be last so that it is destroyed, and its tasks executed, before the
+  // other members.
+  WorkStealingExecutor executor_;
+};
+
+}  // namespace internal_prognosticator
+
+using internal_prognosticator::Prognosticator;
+
+}  // namespace ksp_plugin
+}  // namespace principia
@@ -3,7 +3,9 @@
 
 #include <algorithm>
 #include <optional>
+#include <vector>
 
+#include "geometry/fused_orthogonal_map.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/named_quantities.hpp"
 #include "physics/apsides.hpp"
@@ -16,6 +18,7 @@ namespace internal_renderer {
 
 using base::make_not_null_unique;
 using geometry::AngularVelocity;
+using geometry::Fuse;
 using geometry::OddPermutation;
 using geometry::Permutation;
 using geometry::RigidTransformation;
@@ -146,20 +149,30 @@ Renderer::RenderPlottingTrajectoryInWorld(
   // camera is fixed in the plotting frame and project there; additional data
   // can be gathered from the velocities in the plotting frame as needed and
   // sent directly to be shown in markers.
-  RigidTransformation<Navigation, World> const
-      from_plotting_frame_to_world_at_current_time =
-          PlottingToWorld(time, sun_world_position, planetarium_rotation);
+  // The transformation is fused into a matrix and the positions are
+  // transformed in bulk into a preallocated buffer, which is much faster than
+  // transforming them one at a time.  The positions must be gathered because
+  // the timeline is not contiguous, but the times and velocities are read
+  // directly from the trajectory.
+  auto const from_plotting_frame_to_world_at_current_time =
+      Fuse(PlottingToWorld(time, sun_world_position, planetarium_rotation));
+  std::vector<Position<Navigation>> navigation_positions;
   for (auto it = begin; it != end; ++it) {
+    navigation_positions.push_back(it->degrees_of_freedom.position());
+  }
+  std::vector<Position<World>> world_positions(navigation_positions.size());
+  from_plotting_frame_to_world_at_current_time(
+      absl::MakeConstSpan(navigation_positions),
+      absl::MakeSpan(world_positions));
+  std::size_t i = 0;
+  for (auto it = begin; it != end; ++it, ++i) {
     auto const& [time, degrees_of_freedom] = *it;
-    DegreesOfFreedom<Navigation> const& navigation_degrees_of_freedom =
-        degrees_of_freedom;
     DegreesOfFreedom<World> const world_degrees_of_freedom = {
-        from_plotting_frame_to_world_at_current_time(
-            navigation_degrees_of_freedom.position()),
+        world_positions[i],
         geometry::Permutation<Navigation, World>(
             geometry::Permutation<Navigation,
                                   World>::CoordinatePermutation::YXZ)(
-            navigation_degrees_of_freedom.velocity())};
+            degrees_of_freedom.velocity())};
     trajectory->Append(time, world_degrees_of_freedom);
   }
   return trajectory;
@@ -2,6 +2,7 @@
 #include "ksp_plugin/vessel.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <list>
 #include <string>
@@ -19,6 +20,7 @@ namespace ksp_plugin {
 namespace internal_vessel {
 
 using astronomy::InfiniteFuture;
+using base::check_not_null;
 using base::Contains;
 using base::Error;
 using base::FindOrDie;
@@ -45,13 +47,16 @@ bool operator!=(Vessel::PrognosticatorParameters const& left,
              right.adaptive_step_parameters.length_integration_tolerance() ||
          left.adaptive_step_parameters.speed_integration_tolerance() !=
              right.adaptive_step_parameters.speed_integration_tolerance() ||
-         left.shutdown != right.shutdown;
+         left.adaptive_step_parameters.step_size_controller().kind() !=
+             right.adaptive_step_parameters.step_size_controller().kind() ||
+         left.priority != right.priority;
 }
 
 Vessel::Vessel(GUID const& guid,
                std::string const& name,
                not_null<Celestial const*> const parent,
                not_null<Ephemeris<Barycentric>*> const ephemeris,
+               not_null<Prognosticator*> const prognosticator,
                Ephemeris<Barycentric>::AdaptiveStepParameters const&
                    prediction_adaptive_step_parameters)
     : guid_(guid),
@@ -60,6 +65,7 @@ Vessel::Vessel(GUID const& guid,
       prediction_adaptive_step_parameters_(prediction_adaptive_step_parameters),
       parent_(parent),
       ephemeris_(ephemeris),
+      prognosticator_(prognosticator),
       history_(make_not_null_unique<DiscreteTrajectory<Barycentric>>()) {
   // Can't create the |psychohistory_| and |prediction_| here because |history_|
   // is empty;
@@ -67,19 +73,9 @@ Vessel::Vessel(GUID const& guid,
 
 Vessel::~Vessel() {
   LOG(INFO) << "Destroying vessel " << ShortDebugString();
-  // Ask the prognosticator to shut down.  This may take a while.  Make sure
-  // that we handle the case where |PrepareHistory| was not called.
-  if (prognosticator_.joinable()) {
-    {
-      absl::MutexLock l(&prognosticator_lock_);
-      prognosticator_parameters_ =
-          PrognosticatorParameters{Ephemeris<Barycentric>::Guard(ephemeris_),
-                                   psychohistory_->back().time,
-                                   psychohistory_->back().degrees_of_freedom,
-                                   prediction_adaptive_step_parameters_,
-                                   /*shutdown=*/true};
-    }
-    prognosticator_.join();
+  // Wait for our prognostication, if any, to finish.  This may take a while.
+  if (prognosticator_ != nullptr) {
+    prognosticator_->Cancel(this);
   }
 }
 
@@ -221,6 +217,27 @@ Vessel::prediction_adaptive_step_parameters() const {
   return prediction_adaptive_step_parameters_;
 }
 
+void Vessel::set_prediction_priority(
+    Prognosticator::Priority const priority) {
+  if (priority == prediction_priority_) {
+    return;
+  }
+  prediction_priority_ = priority;
+  absl::MutexLock l(&prognosticator_lock_);
+  if (prognosticator_parameters_) {
+    // Requeue the pending prognostication, so that a vessel that the user no
+    // longer looks at doesn't delay the others.
+    prognosticator_parameters_->priority = priority;
+    prognosticator_->Request(this,
+                             priority,
+                             [this]() { FlowLatestPrognostication(); });
+  }
+}
+
+Prognosticator::Priority Vessel::prediction_priority() const {
+  return prediction_priority_;
+}
+
 FlightPlan& Vessel::flight_plan() const {
   CHECK(has_flight_plan());
   return *flight_plan_;
@@ -307,7 +324,7 @@ void Vessel::RefreshPrediction() {
                                psychohistory_->back().time,
                                psychohistory_->back().degrees_of_freedom,
                                prediction_adaptive_step_parameters_,
-                               /*shutdown=*/false};
+                               prediction_priority_};
   if (synchronous_) {
     std::unique_ptr<DiscreteTrajectory<Barycentric>> prognostication;
     std::optional<PrognosticatorParameters> prognosticator_parameters;
@@ -317,7 +334,9 @@ void Vessel::RefreshPrediction() {
                             prognostication);
     SwapPrognostication(prognostication, status);
   } else {
-    StartPrognosticatorIfNeeded();
+    prognosticator_->Request(this,
+                             prediction_priority_,
+                             [this]() { FlowLatestPrognostication(); });
   }
   if (prognostication_ != nullptr) {
     AttachPrediction(std::move(prognostication_));
@@ -359,6 +378,7 @@ not_null<std::unique_ptr<Vessel>> Vessel::ReadFromMessage(
     serialization::Vessel const& message,
     not_null<Celestial const*> const parent,
     not_null<Ephemeris<Barycentric>*> const ephemeris,
+    not_null<Prognosticator*> const prognosticator,
     std::function<void(PartId)> const& deletion_callback) {
   bool const is_pre_cesàro = message.has_psychohistory_is_authoritative();
   bool const is_pre_chasles = message.has_prediction();
@@ -371,6 +391,7 @@ not_null<std::unique_ptr<Vessel>> Vessel::ReadFromMessage(
       message.name(),
       parent,
       ephemeris,
+      prognosticator,
       Ephemeris<Barycentric>::AdaptiveStepParameters::ReadFromMessage(
           message.prediction_adaptive_step_parameters()));
   for (auto const& serialized_part : message.parts()) {
@@ -455,7 +476,9 @@ void Vessel::RefreshOrbitAnalysis(
     // and given that we know many things about our trajectory in the analyser,
     // perhaps we should pick something appropriate automatically instead.  The
     // default will do in the meantime.
-    orbit_analyser_.emplace(ephemeris_, DefaultHistoryParameters());
+    orbit_analyser_.emplace(ephemeris_,
+                            check_not_null(prognosticator_),
+                            DefaultHistoryParameters());
   }
   orbit_analyser_->RequestAnalysis(psychohistory_->back().time,
                                    psychohistory_->back().degrees_of_freedom,
@@ -488,47 +511,26 @@ Vessel::Vessel()
       prediction_adaptive_step_parameters_(DefaultPredictionParameters()),
       parent_(testing_utilities::make_not_null<Celestial const*>()),
       ephemeris_(testing_utilities::make_not_null<Ephemeris<Barycentric>*>()),
+      prognosticator_(nullptr),
       history_(make_not_null_unique<DiscreteTrajectory<Barycentric>>()) {}
 
-void Vessel::StartPrognosticatorIfNeeded() {
-  prognosticator_lock_.AssertHeld();
-  if (!prognosticator_.joinable()) {
-    prognosticator_ =
-        std::thread(std::bind(&Vessel::RepeatedlyFlowPrognostication, this));
-  }
-}
-
-void Vessel::RepeatedlyFlowPrognostication() {
-  for (;;) {
-    // No point in going faster than 50 Hz.
-    std::chrono::steady_clock::time_point const wakeup_time =
-        std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
-
-    std::optional<PrognosticatorParameters> prognosticator_parameters;
-    {
-      absl::ReaderMutexLock l(&prognosticator_lock_);
-      if (!prognosticator_parameters_) {
-        // No parameters, let's wait for them to appear.
-        continue;
-      }
-      std::swap(prognosticator_parameters, prognosticator_parameters_);
-    }
-
-    if (prognosticator_parameters->shutdown) {
-      break;
-    }
-
-    std::unique_ptr<DiscreteTrajectory<Barycentric>> prognostication;
-    Status const status =
-        FlowPrognostication(std::move(*prognosticator_parameters),
-                            prognostication);
-    {
-      absl::MutexLock l(&prognosticator_lock_);
-      SwapPrognostication(prognostication, status);
+void Vessel::FlowLatestPrognostication() {
+  std::optional<PrognosticatorParameters> prognosticator_parameters;
+  {
+    absl::MutexLock l(&prognosticator_lock_);
+    if (!prognosticator_parameters_) {
+      // The parameters were consumed by a synchronous prognostication.
+      return;
     }
-
-    std::this_thread::sleep_until(wakeup_time);
+    std::swap(prognosticator_parameters, prognosticator_parameters_);
   }
+
+  std::unique_ptr<DiscreteTrajectory<Barycentric>> prognostication;
+  Status const status =
+      FlowPrognostication(std::move(*prognosticator_parameters),
+                          prognostication);
+  absl::MutexLock l(&prognosticator_lock_);
+  SwapPrognostication(prognostication, status);
 }
 
 Status Vessel::FlowPrognostication(
@@ -540,23 +542,41 @@ Status Vessel::FlowPrognostication(
   prognostication->Append(
       prognosticator_parameters.first_time,
       prognosticator_parameters.first_degrees_of_freedom);
+  // The steps by which this prognostication may prolong the ephemeris are
+  // drawn from the budget shared by all the computations of the current frame.
+  auto const ephemeris_steps =
+      prognosticator_->DrawEphemerisSteps(prognosticator_parameters.priority);
+  Instant const ephemeris_t_max = ephemeris_->t_max();
   Status status;
   status = ephemeris_->FlowWithAdaptiveStep(
       prognostication.get(),
       Ephemeris<Barycentric>::NoIntrinsicAcceleration,
-      ephemeris_->t_max(),
+      ephemeris_t_max,
       prognosticator_parameters.adaptive_step_parameters,
-      FlightPlan::max_ephemeris_steps_per_frame);
+      ephemeris_steps.steps);
   bool const reached_t_max = status.ok();
   if (reached_t_max) {
-    // This will prolong the ephemeris by |max_ephemeris_steps_per_frame|.
+    // This will prolong the ephemeris by at most |ephemeris_steps.steps|.
     status = ephemeris_->FlowWithAdaptiveStep(
         prognostication.get(),
         Ephemeris<Barycentric>::NoIntrinsicAcceleration,
         InfiniteFuture,
         prognosticator_parameters.adaptive_step_parameters,
-        FlightPlan::max_ephemeris_steps_per_frame);
+        ephemeris_steps.steps);
   }
+  // The ephemeris may also have been prolonged by concurrent computations, so
+  // this overestimates the steps spent by this one, but not beyond what it
+  // drew.
+  double const ephemeris_steps_spent =
+      std::ceil((ephemeris_->t_max() - ephemeris_t_max) /
+                ephemeris_->planetary_integrator_step());
+  prognosticator_->SettleEphemerisSteps(
+      prognosticator_parameters.priority,
+      ephemeris_steps,
+      static_cast<std::int64_t>(std::clamp(
+          ephemeris_steps_spent,
+          0.0,
+          static_cast<double>(ephemeris_steps.steps))));
   LOG_IF(INFO, !status.ok())
       << "Prognostication from " << prognosticator_parameters.first_time
       << " finished at " << prognostication->back().time << " with "
@@ -15,6 +15,7 @@
 #include "ksp_plugin/orbit_analyser.hpp"
 #include "ksp_plugin/part.hpp"
 #include "ksp_plugin/pile_up.hpp"
+#include "ksp_plugin/prognosticator.hpp"
 #include "physics/discrete_trajectory.hpp"
 #include "physics/ephemeris.hpp"
 #include "physics/massless_body.hpp"
@@ -45,12 +46,14 @@ class Vessel {
   using Manœuvres = std::vector<
       not_null<std::unique_ptr<Manœuvre<Barycentric, Navigation> const>>>;
 
-  // Constructs a vessel whose parent is initially |*parent|.  No transfer of
-  // ownership.
+  // Constructs a vessel whose parent is initially |*parent|, and whose
+  // predictions and orbit analyses are computed by |*prognosticator|.  No
+  // transfer of ownership.
   Vessel(GUID const& guid,
          std::string const& name,
          not_null<Celestial const*> parent,
          not_null<Ephemeris<Barycentric>*> ephemeris,
+         not_null<Prognosticator*> prognosticator,
          Ephemeris<Barycentric>::AdaptiveStepParameters const&
              prediction_adaptive_step_parameters);
 
@@ -125,6 +128,13 @@ class Vessel {
   virtual Ephemeris<Barycentric>::AdaptiveStepParameters const&
   prediction_adaptive_step_parameters() const;
 
+  // The priority of the prognostications requested by subsequent calls to
+  // |RefreshPrediction|, and of the pending one, if any.  It determines the
+  // order in which the prognostications of the vessels are computed, and how
+  // far they may prolong the ephemeris in a frame.  Defaults to |Background|.
+  virtual void set_prediction_priority(Prognosticator::Priority priority);
+  virtual Prognosticator::Priority prediction_priority() const;
+
   // Requires |has_flight_plan()|.
   virtual FlightPlan& flight_plan() const;
   virtual bool has_flight_plan() const;
@@ -170,6 +180,7 @@ class Vessel {
       serialization::Vessel const& message,
       not_null<Celestial const*> parent,
       not_null<Ephemeris<Barycentric>*> ephemeris,
+      not_null<Prognosticator*> prognosticator,
       std::function<void(PartId)> const& deletion_callback);
   void FillContainingPileUpsFromMessage(
       serialization::Vessel const& message,
@@ -195,7 +206,7 @@ class Vessel {
     Instant first_time;
     DegreesOfFreedom<Barycentric> first_degrees_of_freedom;
     Ephemeris<Barycentric>::AdaptiveStepParameters adaptive_step_parameters;
-    bool shutdown = false;
+    Prognosticator::Priority priority;
   };
   friend bool operator!=(PrognosticatorParameters const& left,
                          PrognosticatorParameters const& right);
@@ -203,13 +214,9 @@ class Vessel {
   using TrajectoryIterator =
       DiscreteTrajectory<Barycentric>::Iterator (Part::*)();
 
-  // Starts the |prognosticator_| if it is not started already.  The
-  // |prognosticator_parameters_| must have been set.
-  void StartPrognosticatorIfNeeded() REQUIRES(prognosticator_lock_);
-
-  // Run by the |prognosticator_| thread to periodically recompute the
-  // prognostication.
-  void RepeatedlyFlowPrognostication();
+  // Run by the |prognosticator_| to compute the prognostication from the
+  // latest |prognosticator_parameters_|, if any.
+  void FlowLatestPrognostication();
 
   // Runs the integrator to compute the |prognostication_| based on the given
   // parameters.
@@ -239,6 +246,8 @@ class Vessel {
   MasslessBody const body_;
   Ephemeris<Barycentric>::AdaptiveStepParameters
       prediction_adaptive_step_parameters_;
+  Prognosticator::Priority prediction_priority_ =
+      Prognosticator::Priority::Background;
   // The parent body for the 2-body approximation.
   not_null<Celestial const*> parent_;
   not_null<Ephemeris<Barycentric>*> const ephemeris_;
@@ -253,7 +262,10 @@ class Vessel {
   // that reading it clears it.
   std::optional<PrognosticatorParameters> prognosticator_parameters_
       GUARDED_BY(prognosticator_lock_);
-  std::thread prognosticator_;
+  // Shared with the other vessels.  Our requests to the |prognosticator_| are
+  // coalesced, so that at most one prognostication is pending at any time.
+  // Null for mocks.
+  Prognosticator* const prognosticator_;
 
   // See the comments in pile_up.hpp for an explanation of the terminology.
   not_null<std::unique_ptr<DiscreteTrajectory<Barycentric>>> history_;
@@ -346,7 +346,6 @@ private enum UnityLayers {
         plugin_.HasVessel(main_vessel.id.ToString());
 
     if (ready_to_draw_active_vessel_trajectory) {
-      plugin_.UpdatePrediction(main_vessel.id.ToString());
       string target_id =
           FlightGlobals.fetch.VesselTarget?.GetVessel()?.id.ToString();
       if (!plotting_frame_selector_.target_override &&
@@ -358,8 +357,12 @@ private enum UnityLayers {
                 main_vessel.id.ToString());
         plugin_.VesselSetPredictionAdaptiveStepParameters(
             target_id, adaptive_step_parameters);
-        plugin_.UpdatePrediction(target_id);
+      } else {
+        // When there is a target override, the plugin updates the prediction
+        // of the target of its renderer.
+        target_id = null;
       }
+      plugin_.UpdatePrediction(main_vessel.id.ToString(), target_id);
     }
   }
 
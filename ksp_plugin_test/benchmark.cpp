@@ -10,16 +10,21 @@
 #include "geometry/named_quantities.hpp"
 #include "gtest/gtest.h"
 #include "ksp_plugin/interface.hpp"
+#include "physics/solar_system.hpp"
+#include "quantities/elementary_functions.hpp"
 #include "quantities/quantities.hpp"
 #include "serialization/ksp_plugin.pb.h"
 #include "testing_utilities/serialization.hpp"
+#include "testing_utilities/solar_system_factory.hpp"
 
 namespace principia {
 
 using base::ParseFromBytes;
 using base::PullSerializer;
 using base::PushDeserializer;
+using geometry::Displacement;
 using geometry::Instant;
+using geometry::Velocity;
 using interface::principia__AdvanceTime;
 using interface::principia__DeletePlugin;
 using interface::principia__DeserializePlugin;
@@ -27,14 +32,51 @@ using interface::principia__FutureCatchUpVessel;
 using interface::principia__FutureWaitForVesselToCatchUp;
 using interface::principia__IteratorDelete;
 using interface::principia__SerializePlugin;
+using physics::RelativeDegreesOfFreedom;
+using quantities::Angle;
+using quantities::Cos;
 using quantities::Frequency;
+using quantities::Length;
+using quantities::Sin;
+using quantities::Speed;
+using quantities::Sqrt;
 using quantities::Time;
 using quantities::si::Hertz;
+using quantities::si::Kilo;
+using quantities::si::Metre;
+using quantities::si::Milli;
+using quantities::si::Radian;
 using quantities::si::Second;
 using testing_utilities::ReadFromBinaryFile;
 using testing_utilities::ReadLinesFromHexadecimalFile;
+using testing_utilities::SolarSystemFactory;
 
 namespace ksp_plugin {
+namespace internal_plugin {
+
+// Exposes the phases of |CatchUpLaggingVessels| so that they can be timed
+// separately.
+class BenchmarkablePlugin : public Plugin {
+ public:
+  using Plugin::Plugin;
+
+  void CatchUpLaggingPileUps(VesselSet& collided_vessels) {
+    Plugin::CatchUpLaggingPileUps(collided_vessels);
+  }
+
+  void AdvanceLaggingVessels(VesselSet const& collided_vessels) {
+    Plugin::AdvanceLaggingVessels(collided_vessels,
+                                  vessel_thread_pool_.executor());
+  }
+
+  void ForgetVesselHistoriesBefore(Instant const& t) {
+    Plugin::ForgetVesselHistoriesBefore(t, vessel_thread_pool_.executor());
+  }
+};
+
+}  // namespace internal_plugin
+
+using internal_plugin::BenchmarkablePlugin;
 
 // The caller takes ownership of the result, but it's inconvenient to express
 // with |std::unique_ptr|.
@@ -97,6 +139,76 @@ void BM_PluginIntegrationBenchmark(benchmark::State& state) {
   }
 }
 
+// Measures the bookkeeping of the catch-up phase, i.e., advancing time on the
+// vessels and forgetting their histories once their pile-ups have been
+// integrated, for |state.range(0)| unloaded vessels in low orbits around the
+// Earth.  The integration of the pile-ups is not timed.
+void BM_PluginCatchUpLaggingVessels(benchmark::State& state) {
+  int const number_of_vessels = state.range(0);
+  auto const solar_system = SolarSystemFactory::AtСпутник1Launch(
+      SolarSystemFactory::Accuracy::MajorBodiesOnly);
+  std::string const initial_time = "JD2451545.0625";
+  BenchmarkablePlugin plugin(initial_time,
+                             initial_time,
+                             /*planetarium_rotation=*/0 * Radian);
+  for (int index = SolarSystemFactory::Sun;
+       index <= SolarSystemFactory::LastMajorBody;
+       ++index) {
+    std::optional<Index> const parent_index =
+        index == SolarSystemFactory::Sun
+            ? std::nullopt
+            : std::make_optional(SolarSystemFactory::parent(index));
+    plugin.InsertCelestialAbsoluteCartesian(
+        index,
+        parent_index,
+        solar_system->gravity_model_message(SolarSystemFactory::name(index)),
+        solar_system->cartesian_initial_state_message(
+            SolarSystemFactory::name(index)));
+  }
+  plugin.EndInitialization();
+
+  auto const earth_gravitational_parameter =
+      solar_system->gravitational_parameter(
+          SolarSystemFactory::name(SolarSystemFactory::Earth));
+  for (int i = 0; i < number_of_vessels; ++i) {
+    GUID const vessel_guid = std::to_string(i);
+    bool inserted;
+    plugin.InsertOrKeepVessel(vessel_guid,
+                              "Vessel " + vessel_guid,
+                              SolarSystemFactory::Earth,
+                              /*loaded=*/false,
+                              inserted);
+    // Circular orbits with different radii and phases.
+    Length const r = 7000 * Kilo(Metre) + i * Kilo(Metre);
+    Angle const θ = i * Radian;
+    Speed const v = Sqrt(earth_gravitational_parameter / r);
+    plugin.InsertUnloadedPart(
+        /*part_id=*/i,
+        "Part " + vessel_guid,
+        vessel_guid,
+        RelativeDegreesOfFreedom<AliceSun>(
+            Displacement<AliceSun>({r * Cos(θ), r * Sin(θ), 0 * Metre}),
+            Velocity<AliceSun>({-v * Sin(θ), v * Cos(θ), 0 * Metre / Second})));
+  }
+  plugin.PrepareToReportCollisions();
+  plugin.FreeVesselsAndPartsAndCollectPileUps(20 * Milli(Second));
+
+  static constexpr int warp_factor = 100;
+  static constexpr Frequency refresh_frequency = 50 * Hertz;
+  static constexpr Time step = warp_factor / refresh_frequency;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Instant const previous_time = plugin.CurrentTime();
+    plugin.AdvanceTime(previous_time + step,
+                       /*planetarium_rotation=*/0 * Radian);
+    VesselSet collided_vessels;
+    plugin.CatchUpLaggingPileUps(collided_vessels);
+    state.ResumeTiming();
+    plugin.AdvanceLaggingVessels(collided_vessels);
+    plugin.ForgetVesselHistoriesBefore(previous_time);
+  }
+}
+
 void BM_PluginSerializationBenchmark(benchmark::State& state) {
   char const compressor[] = "gipfeli";
   char const encoder[] = "hexadecimal";
@@ -153,6 +265,7 @@ void BM_PluginDeserializationBenchmark(benchmark::State& state) {
 BENCHMARK(BM_PluginSerializationBenchmark);
 BENCHMARK(BM_PluginDeserializationBenchmark);
 BENCHMARK(BM_PluginIntegrationBenchmark);
+BENCHMARK(BM_PluginCatchUpLaggingVessels)->Arg(100)->Arg(500)->Arg(1000);
 
 // .\Release\x64\ksp_plugin_test_tests.exe --gtest_filter=PluginBenchmark.DISABLED_All --gtest_also_run_disabled_tests  // NOLINT
 TEST(PluginBenchmark, DISABLED_All) {
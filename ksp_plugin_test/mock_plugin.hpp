@@ -54,7 +54,7 @@ class MockPlugin : public Plugin {
   MOCK_METHOD2(AdvanceTime,
                void(Instant const& t, Angle const& planetarium_rotation));
 
-  MOCK_CONST_METHOD1(ForgetAllHistoriesBefore, void(Instant const& t));
+  MOCK_METHOD1(ForgetAllHistoriesBefore, void(Instant const& t));
 
   MOCK_CONST_METHOD2(VesselFromParent,
                      RelativeDegreesOfFreedom<AliceSun>(
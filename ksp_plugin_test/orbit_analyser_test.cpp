@@ -85,7 +85,11 @@ class OrbitAnalyserTest : public testing::Test {
 };
 
 TEST_F(OrbitAnalyserTest, TOPEXPoséidon) {
-  OrbitAnalyser analyser(ephemeris_.get(), DefaultHistoryParameters());
+  Prognosticator prognosticator(/*number_of_workers=*/1,
+                                /*reserved_workers=*/0,
+                                /*ephemeris_steps_per_frame=*/1000);
+  OrbitAnalyser analyser(
+      ephemeris_.get(), &prognosticator, DefaultHistoryParameters());
   EXPECT_THAT(analyser.analysis(), IsNull());
   EXPECT_THAT(analyser.progress_of_next_analysis(), Eq(0));
   auto const& arc =
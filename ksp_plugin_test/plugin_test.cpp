@@ -112,6 +112,7 @@ using ::testing::AnyNumber;
 using ::testing::ByMove;
 using ::testing::Contains;
 using ::testing::DoAll;
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::Ge;
 using ::testing::Gt;
@@ -412,7 +413,7 @@ TEST_F(PluginTest, Serialization) {
                              inserted);
   plugin->AdvanceTime(HistoryTime(time, 6), Angle());
   plugin->CatchUpLaggingVessels(collided_vessels);
-  plugin->UpdatePrediction(satellite);
+  plugin->UpdatePrediction(satellite, /*target_vessel_guid=*/std::nullopt);
 
   // The call to |UpdatePrediction| above may guard the ephemeris and delay
   // forgetting the histories until after the plugin is serialized below.  To
@@ -919,7 +920,7 @@ TEST_F(PluginTest, ForgetAllHistoriesBeforeAfterPredictionFork) {
   plugin_->CatchUpLaggingVessels(collided_vessels);
   EXPECT_CALL(plugin_->mock_ephemeris(), t_min_locked)
       .WillRepeatedly(Return(HistoryTime(time, 0)));
-  plugin_->UpdatePrediction(guid);
+  plugin_->UpdatePrediction(guid, /*target_vessel_guid=*/std::nullopt);
   plugin_->InsertOrKeepVessel(guid,
                               "v" + guid,
                               SolarSystemFactory::Earth,
@@ -1146,6 +1147,78 @@ TEST_F(PluginTest, NavballTargetVessel) {
   plugin.NavballFrameField(World::origin)->FromThisFrame(World::origin);
 }
 
+// The priorities of the predictions follow the active and target vessels, and
+// revert to |Background| when a vessel loses its role.
+TEST_F(PluginTest, PredictionPriorities) {
+  constexpr auto Active = Prognosticator::Priority::Active;
+  constexpr auto Target = Prognosticator::Priority::Target;
+  constexpr auto Background = Prognosticator::Priority::Background;
+  std::vector<GUID> const guids = {"Vessel 0", "Vessel 1", "Vessel 2"};
+
+  Plugin plugin(initial_time_,
+                initial_time_,
+                0 * Radian);
+  plugin.InsertCelestialAbsoluteCartesian(
+      SolarSystemFactory::Sun,
+      /*parent_index=*/std::nullopt,
+      solar_system_->gravity_model_message(
+          SolarSystemFactory::name(SolarSystemFactory::Sun)),
+      solar_system_->cartesian_initial_state_message(
+          SolarSystemFactory::name(SolarSystemFactory::Sun)));
+  plugin.EndInitialization();
+
+  for (int i = 0; i < guids.size(); ++i) {
+    bool inserted;
+    plugin.InsertOrKeepVessel(guids[i],
+                              "v" + guids[i],
+                              SolarSystemFactory::Sun,
+                              /*loaded=*/false,
+                              inserted);
+    plugin.InsertUnloadedPart(
+        /*part_id=*/i,
+        "part",
+        guids[i],
+        RelativeDegreesOfFreedom<AliceSun>(satellite_initial_displacement_,
+                                           satellite_initial_velocity_));
+  }
+  plugin.PrepareToReportCollisions();
+  plugin.FreeVesselsAndPartsAndCollectPileUps(20 * Milli(Second));
+
+  auto const priorities = [&guids, &plugin]() {
+    std::vector<Prognosticator::Priority> priorities;
+    for (auto const& guid : guids) {
+      priorities.push_back(plugin.GetVessel(guid)->prediction_priority());
+    }
+    return priorities;
+  };
+  EXPECT_THAT(priorities(), ElementsAre(Background, Background, Background));
+
+  plugin.UpdatePrediction(guids[0], /*target_vessel_guid=*/guids[1]);
+  EXPECT_THAT(priorities(), ElementsAre(Active, Target, Background));
+
+  // Switch the active vessel.
+  plugin.UpdatePrediction(guids[2], /*target_vessel_guid=*/guids[1]);
+  EXPECT_THAT(priorities(), ElementsAre(Background, Target, Active));
+
+  // Switch the target vessel.
+  plugin.UpdatePrediction(guids[2], /*target_vessel_guid=*/guids[0]);
+  EXPECT_THAT(priorities(), ElementsAre(Target, Background, Active));
+
+  // Drop the target vessel.
+  plugin.UpdatePrediction(guids[2], /*target_vessel_guid=*/std::nullopt);
+  EXPECT_THAT(priorities(), ElementsAre(Background, Background, Active));
+
+  // The target of the renderer takes precedence.
+  plugin.SetTargetVessel(guids[1], SolarSystemFactory::Sun);
+  EXPECT_THAT(priorities(), ElementsAre(Background, Target, Active));
+  plugin.UpdatePrediction(guids[0], /*target_vessel_guid=*/guids[2]);
+  EXPECT_THAT(priorities(), ElementsAre(Active, Target, Background));
+  plugin.SetTargetVessel(guids[2], SolarSystemFactory::Sun);
+  EXPECT_THAT(priorities(), ElementsAre(Active, Background, Target));
+  plugin.ClearTargetVessel();
+  EXPECT_THAT(priorities(), ElementsAre(Active, Background, Background));
+}
+
 TEST_F(PluginTest, Frenet) {
   // Create a plugin with planetarium rotation 0.
   Plugin plugin(initial_time_,
@@ -0,0 +1,263 @@
+﻿
+#include "ksp_plugin/prognosticator.hpp"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/notification.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace principia {
+namespace ksp_plugin {
+
+using ::testing::ElementsAre;
+
+constexpr auto Active = Prognosticator::Priority::Active;
+constexpr auto Target = Prognosticator::Priority::Target;
+constexpr auto Background = Prognosticator::Priority::Background;
+constexpr auto Analysis = Prognosticator::Priority::Analysis;
+
+class PrognosticatorTest : public ::testing::Test {
+ protected:
+  PrognosticatorTest()
+      : prognosticator_(/*number_of_workers=*/1,
+                        /*reserved_workers=*/0,
+                        /*ephemeris_steps_per_frame=*/1000) {}
+
+  // Occupies the only worker until |release_| is notified.
+  void Block() {
+    prognosticator_.Request(&blocker_, Background, [this]() {
+      blocking_.Notify();
+      release_.WaitForNotification();
+    });
+    blocking_.WaitForNotification();
+  }
+
+  Prognosticator prognosticator_;
+  int const blocker_ = 0;
+  absl::Notification blocking_;
+  absl::Notification release_;
+};
+
+TEST_F(PrognosticatorTest, Coalescing) {
+  int const client = 0;
+  std::vector<int> executed;
+  absl::Notification done;
+  Block();
+  for (int i = 0; i < 3; ++i) {
+    prognosticator_.Request(&client, Background, [i, &done, &executed]() {
+      executed.push_back(i);
+      done.Notify();
+    });
+  }
+  auto statistics = prognosticator_.statistics();
+  EXPECT_EQ(1, statistics.queue_depth);
+  EXPECT_EQ(1, statistics.running);
+  EXPECT_EQ(4, statistics.requests);
+  EXPECT_EQ(2, statistics.dropped_requests);
+
+  release_.Notify();
+  done.WaitForNotification();
+  prognosticator_.Cancel(&blocker_);
+  prognosticator_.Cancel(&client);
+  // Only the latest request was executed.
+  EXPECT_THAT(executed, ElementsAre(2));
+  statistics = prognosticator_.statistics();
+  EXPECT_EQ(0, statistics.queue_depth);
+  EXPECT_EQ(0, statistics.running);
+  EXPECT_EQ(2, statistics.completed_requests);
+  EXPECT_LE(statistics.max_waiting_time, statistics.max_latency);
+  EXPECT_LE(statistics.total_waiting_time, statistics.total_latency);
+}
+
+TEST_F(PrognosticatorTest, FirstComeFirstServed) {
+  std::vector<int> const clients = {0, 1, 2};
+  std::vector<int> executed;
+  absl::BlockingCounter all_executed(clients.size());
+  Block();
+  for (int const& client : clients) {
+    prognosticator_.Request(
+        &client, Background, [&all_executed, &client, &executed]() {
+          executed.push_back(client);
+          all_executed.DecrementCount();
+        });
+  }
+  EXPECT_EQ(3, prognosticator_.statistics().queue_depth);
+
+  release_.Notify();
+  all_executed.Wait();
+  prognosticator_.Cancel(&blocker_);
+  for (int const& client : clients) {
+    prognosticator_.Cancel(&client);
+  }
+  EXPECT_THAT(executed, ElementsAre(0, 1, 2));
+}
+
+TEST_F(PrognosticatorTest, Priorities) {
+  std::vector<int> const clients = {0, 1, 2, 3, 4};
+  std::vector<int> executed;
+  absl::BlockingCounter all_executed(clients.size());
+  auto const computation = [&all_executed, &executed](int const& client) {
+    return [&all_executed, &client, &executed]() {
+      executed.push_back(client);
+      all_executed.DecrementCount();
+    };
+  };
+  Block();
+  prognosticator_.Request(&clients[4], Analysis, computation(clients[4]));
+  prognosticator_.Request(&clients[0], Background, computation(clients[0]));
+  prognosticator_.Request(&clients[1], Background, computation(clients[1]));
+  prognosticator_.Request(&clients[2], Target, computation(clients[2]));
+  prognosticator_.Request(&clients[3], Active, computation(clients[3]));
+  // A new request with a different priority requeues the client.
+  prognosticator_.Request(&clients[1], Active, computation(clients[1]));
+  EXPECT_EQ(5, prognosticator_.statistics().queue_depth);
+
+  release_.Notify();
+  all_executed.Wait();
+  prognosticator_.Cancel(&blocker_);
+  for (int const& client : clients) {
+    prognosticator_.Cancel(&client);
+  }
+  EXPECT_THAT(executed, ElementsAre(3, 1, 2, 0, 4));
+}
+
+// A long analysis occupies the only worker available to the non-urgent
+// computations, but not the reserved one.
+TEST(PrognosticatorReservationTest, Reservation) {
+  Prognosticator prognosticator(/*number_of_workers=*/2,
+                                /*reserved_workers=*/1,
+                                /*ephemeris_steps_per_frame=*/1000);
+  int const analyser = 0;
+  int const background_vessel = 1;
+  int const active_vessel = 2;
+  absl::Notification analysing;
+  absl::Notification release;
+  absl::Notification background_done;
+  absl::Notification active_done;
+  prognosticator.Request(&analyser, Analysis, [&analysing, &release]() {
+    analysing.Notify();
+    release.WaitForNotification();
+  });
+  analysing.WaitForNotification();
+  prognosticator.Request(&background_vessel, Background, [&background_done]() {
+    background_done.Notify();
+  });
+  prognosticator.Request(&active_vessel, Active, [&active_done]() {
+    active_done.Notify();
+  });
+
+  // The active vessel is served while the analysis is running, but the
+  // background vessel waits.
+  active_done.WaitForNotification();
+  EXPECT_FALSE(background_done.HasBeenNotified());
+  EXPECT_EQ(1, prognosticator.statistics().queue_depth);
+
+  release.Notify();
+  background_done.WaitForNotification();
+  prognosticator.Cancel(&analyser);
+  prognosticator.Cancel(&background_vessel);
+  prognosticator.Cancel(&active_vessel);
+  EXPECT_EQ(3, prognosticator.statistics().completed_requests);
+}
+
+TEST_F(PrognosticatorTest, Cancel) {
+  int const client = 0;
+  bool executed = false;
+  Block();
+  prognosticator_.Request(&client, Background, [&executed]() {
+    executed = true;
+  });
+  prognosticator_.Cancel(&client);
+  EXPECT_EQ(0, prognosticator_.statistics().queue_depth);
+
+  release_.Notify();
+  prognosticator_.Cancel(&blocker_);
+  EXPECT_FALSE(executed);
+}
+
+// A client whose computation makes a new request, as happens when a vessel
+// refreshes its prediction while the previous one is being computed.
+TEST_F(PrognosticatorTest, RequestWhileRunning) {
+  int const client = 0;
+  std::atomic<int> executions = 0;
+  absl::Notification done;
+  std::function<void()> computation = [&]() {
+    if (++executions < 10) {
+      prognosticator_.Request(&client, Background, computation);
+    } else {
+      done.Notify();
+    }
+  };
+  prognosticator_.Request(&client, Background, computation);
+  done.WaitForNotification();
+  prognosticator_.Cancel(&client);
+  EXPECT_EQ(10, executions);
+  EXPECT_EQ(10, prognosticator_.statistics().completed_requests);
+}
+
+TEST_F(PrognosticatorTest, EphemerisSteps) {
+  // The |Active| computation draws all the steps, so nothing is left for the
+  // |Background| one until it settles.
+  auto const active = prognosticator_.DrawEphemerisSteps(Active);
+  EXPECT_EQ(1000, active.steps);
+  EXPECT_EQ(0, prognosticator_.DrawEphemerisSteps(Background).steps);
+  prognosticator_.SettleEphemerisSteps(Active, active, /*spent=*/300);
+  auto const background = prognosticator_.DrawEphemerisSteps(Background);
+  EXPECT_EQ(700, background.steps);
+  prognosticator_.SettleEphemerisSteps(Background, background, /*spent=*/100);
+  auto statistics = prognosticator_.statistics();
+  EXPECT_THAT(statistics.ephemeris_steps_this_frame,
+              ElementsAre(300, 0, 100, 0));
+
+  // The steps that the |Active| computation spent are reserved for the |Active|
+  // and |Target| computations in the next frame.
+  prognosticator_.StartFrame();
+  statistics = prognosticator_.statistics();
+  EXPECT_THAT(statistics.ephemeris_steps_this_frame, ElementsAre(0, 0, 0, 0));
+  EXPECT_THAT(statistics.ephemeris_steps_last_frame,
+              ElementsAre(300, 0, 100, 0));
+  auto const analysis = prognosticator_.DrawEphemerisSteps(Analysis);
+  EXPECT_EQ(700, analysis.steps);
+  auto const target = prognosticator_.DrawEphemerisSteps(Target);
+  EXPECT_EQ(300, target.steps);
+  prognosticator_.SettleEphemerisSteps(Target, target, /*spent=*/200);
+  EXPECT_EQ(0, prognosticator_.DrawEphemerisSteps(Background).steps);
+  // The steps drawn in a frame that is over don't go back to the budget.
+  prognosticator_.StartFrame();
+  prognosticator_.SettleEphemerisSteps(Analysis, analysis, /*spent=*/0);
+  EXPECT_EQ(800, prognosticator_.DrawEphemerisSteps(Background).steps);
+  EXPECT_THAT(prognosticator_.statistics().ephemeris_steps_last_frame,
+              ElementsAre(0, 200, 0, 0));
+}
+
+TEST(PrognosticatorManyClientsTest, ManyClients) {
+  constexpr int number_of_clients = 200;
+  std::vector<std::atomic<int>> executions(number_of_clients);
+  absl::BlockingCounter all_executed(number_of_clients);
+  Prognosticator prognosticator(/*number_of_workers=*/4,
+                                /*reserved_workers=*/1,
+                                /*ephemeris_steps_per_frame=*/1000);
+  for (int i = 0; i < number_of_clients; ++i) {
+    prognosticator.Request(
+        &executions[i], Background, [&all_executed, &executions, i]() {
+          ++executions[i];
+          all_executed.DecrementCount();
+        });
+  }
+  all_executed.Wait();
+  for (int i = 0; i < number_of_clients; ++i) {
+    prognosticator.Cancel(&executions[i]);
+  }
+  for (auto const& e : executions) {
+    EXPECT_EQ(1, e);
+  }
+  EXPECT_EQ(number_of_clients,
+            prognosticator.statistics().completed_requests);
+}
+
+}  // namespace ksp_plugin
+}  // namespace principia
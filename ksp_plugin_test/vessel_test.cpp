@@ -52,6 +52,8 @@ using testing_utilities::EqualsProto;
 using ::testing::AnyNumber;
 using ::testing::DoAll;
 using ::testing::ElementsAre;
+using ::testing::Invoke;
+using ::testing::InvokeWithoutArgs;
 using ::testing::MockFunction;
 using ::testing::Return;
 using ::testing::_;
@@ -70,10 +72,14 @@ class VesselTest : public testing::Test {
         celestial_(&body_),
         inertia_tensor1_(MakeWaterSphereInertiaTensor(mass1_)),
         inertia_tensor2_(MakeWaterSphereInertiaTensor(mass2_)),
+        prognosticator_(/*number_of_workers=*/1,
+                        /*reserved_workers=*/0,
+                        FlightPlan::max_ephemeris_steps_per_frame),
         vessel_("123",
                 "vessel",
                 &celestial_,
                 &ephemeris_,
+                &prognosticator_,
                 DefaultPredictionParameters()) {
     auto p1 = make_not_null_unique<Part>(
         part_id1_,
@@ -120,6 +126,7 @@ class VesselTest : public testing::Test {
 
   Part* p1_;
   Part* p2_;
+  Prognosticator prognosticator_;
   Vessel vessel_;
 };
 
@@ -327,6 +334,65 @@ TEST_F(VesselTest, Prediction) {
                                        40.0 * Metre / Second}), 0)));
 }
 
+// The predictions draw the steps by which they prolong the ephemeris from the
+// budget of the frame, and the steps spent by the active vessel are reserved
+// for it in the next frame.
+TEST_F(VesselTest, PredictionPriority) {
+  // The planetary integrator step of the mock is 1 s.
+  Instant ephemeris_t_max = astronomy::J2000 + 2 * Second;
+  EXPECT_CALL(ephemeris_, t_min_locked())
+      .WillRepeatedly(Return(astronomy::J2000));
+  EXPECT_CALL(ephemeris_, t_max())
+      .WillRepeatedly(Invoke([&ephemeris_t_max]() { return ephemeris_t_max; }));
+  vessel_.PrepareHistory(astronomy::J2000);
+  EXPECT_EQ(Prognosticator::Priority::Background,
+            vessel_.prediction_priority());
+
+  // Polling for the prognostications to happen.
+  auto const wait_for_prognostications = [this]() {
+    for (;;) {
+      auto const statistics = prognosticator_.statistics();
+      if (statistics.queue_depth == 0 && statistics.running == 0) {
+        return;
+      }
+      using namespace std::chrono_literals;
+      std::this_thread::sleep_for(10ms);
+    }
+  };
+
+  struct Prognostication {
+    Prognosticator::Priority priority;
+    std::int64_t drawn_steps;
+    std::int64_t spent_steps;
+  };
+  for (auto const& prognostication :
+       {Prognostication{Prognosticator::Priority::Background, 1000, 100},
+        Prognostication{Prognosticator::Priority::Active, 900, 300}}) {
+    vessel_.set_prediction_priority(prognostication.priority);
+    EXPECT_CALL(ephemeris_,
+                FlowWithAdaptiveStep(_, _, _, _, prognostication.drawn_steps))
+        .WillOnce(Return(Status::OK))
+        .WillOnce(DoAll(InvokeWithoutArgs([&ephemeris_t_max,
+                                           &prognostication]() {
+                          ephemeris_t_max +=
+                              prognostication.spent_steps * Second;
+                        }),
+                        Return(Status::OK)));
+    vessel_.RefreshPrediction();
+    wait_for_prognostications();
+  }
+  EXPECT_THAT(prognosticator_.statistics().ephemeris_steps_this_frame,
+              ElementsAre(300, 0, 100, 0));
+
+  prognosticator_.StartFrame();
+  vessel_.set_prediction_priority(Prognosticator::Priority::Background);
+  EXPECT_CALL(ephemeris_, FlowWithAdaptiveStep(_, _, _, _, 700))
+      .Times(2)
+      .WillRepeatedly(Return(Status::OK));
+  vessel_.RefreshPrediction();
+  wait_for_prognostications();
+}
+
 TEST_F(VesselTest, PredictBeyondTheInfinite) {
   EXPECT_CALL(ephemeris_, t_min_locked())
       .WillRepeatedly(Return(astronomy::J2000));
@@ -451,7 +517,11 @@ TEST_F(VesselTest, SerializationSuccess) {
 
   EXPECT_CALL(ephemeris_, Prolong(_)).Times(2);
   auto const v = Vessel::ReadFromMessage(
-      message, &celestial_, &ephemeris_, /*deletion_callback=*/nullptr);
+      message,
+      &celestial_,
+      &ephemeris_,
+      &prognosticator_,
+      /*deletion_callback=*/nullptr);
   EXPECT_TRUE(v->has_flight_plan());
 
   serialization::Vessel second_message;
@@ -51,10 +51,20 @@ template<typename T, typename U>
 DoublePrecision<Product<T, U>> Scale(T const& scale,
                                      DoublePrecision<U> const& right);
 
-// Returns the exact product of its arguments.
+// Returns the exact product of its arguments.  Uses the FMA instructions if
+// they are available, and Dekker's algorithm otherwise; the result is the same.
 template<typename T, typename U>
 DoublePrecision<Product<T, U>> TwoProduct(T const& a, U const& b);
 
+// Returns a * b + c with about twice the working precision: the rounding errors
+// of the product and of the sum are accumulated in the error, which is itself
+// rounded.  This is the building block of compensated dot products and Horner
+// schemes.
+template<typename T, typename U>
+DoublePrecision<Product<T, U>> TwoProductAdd(T const& a,
+                                             U const& b,
+                                             Product<T, U> const& c);
+
 // The arguments must be such that |a| >= |b| or a == 0.
 template<typename T, typename U>
 DoublePrecision<Sum<T, U>> QuickTwoSum(T const& a, U const& b);
@@ -112,6 +122,7 @@ std::ostream& operator<<(std::ostream& os,
 
 using internal_double_precision::DoublePrecision;
 using internal_double_precision::TwoProduct;
+using internal_double_precision::TwoProductAdd;
 using internal_double_precision::TwoSum;
 
 }  // namespace numerics
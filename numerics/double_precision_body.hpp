@@ -9,6 +9,7 @@
 #include <string>
 
 #include "geometry/serialization.hpp"
+#include "numerics/fma.hpp"
 #include "quantities/elementary_functions.hpp"
 #include "quantities/si.hpp"
 
@@ -19,7 +20,6 @@ namespace internal_double_precision {
 using geometry::DoubleOrQuantityOrPointOrMultivectorSerializer;
 using geometry::DoubleOrQuantityOrMultivectorSerializer;
 using quantities::Abs;
-using quantities::FusedMultiplyAdd;
 using quantities::Quantity;
 using quantities::SIUnit;
 
@@ -143,10 +143,47 @@ DoublePrecision<Product<T, U>> Scale(T const & scale,
   return result;
 }
 
+// Returns the error of the product of |a| and |b|, whose rounded value is |p|,
+// without using FMA.  See Dekker (1971), A floating-point technique for
+// extending the available precision, mul12.  The result is exact unless the
+// product underflows or |a| or |b| exceed 2^996 in magnitude.
+inline double DekkerProductError(double const a,
+                                 double const b,
+                                 double const p) {
+  // Veltkamp's splitting into 26-bit halves.
+  constexpr double veltkamp_factor = (1 << 27) + 1;
+  double const γ_a = veltkamp_factor * a;
+  double const a_high = γ_a - (γ_a - a);
+  double const a_low = a - a_high;
+  double const γ_b = veltkamp_factor * b;
+  double const b_high = γ_b - (γ_b - b);
+  double const b_low = b - b_high;
+  return (((a_high * b_high - p) + a_high * b_low) + a_low * b_high) +
+         a_low * b_low;
+}
+
 template<typename T, typename U>
 DoublePrecision<Product<T, U>> TwoProduct(T const& a, U const& b) {
-  DoublePrecision<Product<T, U>> result(a * b);
-  result.error = FusedMultiplyAdd(a, b, -result.value);
+  using Result = Product<T, U>;
+  DoublePrecision<Result> result(a * b);
+  double const x = a / SIUnit<T>();
+  double const y = b / SIUnit<U>();
+  double const p = result.value / SIUnit<Result>();
+  if (UseHardwareFMA) {
+    result.error = FusedMultiplySubtract(x, y, p) * SIUnit<Result>();
+  } else {
+    result.error = DekkerProductError(x, y, p) * SIUnit<Result>();
+  }
+  return result;
+}
+
+template<typename T, typename U>
+DoublePrecision<Product<T, U>> TwoProductAdd(T const& a,
+                                             U const& b,
+                                             Product<T, U> const& c) {
+  DoublePrecision<Product<T, U>> const product = TwoProduct(a, b);
+  DoublePrecision<Product<T, U>> result = TwoSum(product.value, c);
+  result.error += product.error;
   return result;
 }
 
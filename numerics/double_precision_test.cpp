@@ -1,6 +1,7 @@
 ﻿
 #include "numerics/double_precision.hpp"
 
+#include <cmath>
 #include <limits>
 #include <random>
 
@@ -288,6 +289,34 @@ TEST_F(DoublePrecisionTest, Product) {
                            0));
 }
 
+TEST_F(DoublePrecisionTest, ProductWithoutFMA) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> mantissa_distribution(-1.0, 1.0);
+  std::uniform_int_distribution<> exponent_distribution(-500, 500);
+  for (int i = 0; i < 10'000; ++i) {
+    double const a = std::ldexp(mantissa_distribution(random),
+                                exponent_distribution(random));
+    double const b = std::ldexp(mantissa_distribution(random),
+                                exponent_distribution(random));
+    double const p = a * b;
+    EXPECT_EQ(std::fma(a, b, -p), DekkerProductError(a, b, p)) << a << " " << b;
+  }
+}
+
+TEST_F(DoublePrecisionTest, ProductAdd) {
+  Mass const a = 1.0 / 3.0 * Kilogram;
+  Speed const b = 1.0 / 7.0 * Metre / Second;
+  Momentum const c = -1.0 / 21.0 * Kilogram * Metre / Second;
+  DoublePrecision<Momentum> const d = TwoProductAdd(a, b, c);
+  DoublePrecision<Momentum> const product = TwoProduct(a, b);
+  // The rounded product cancels with |c|, so a naïve computation would return
+  // 0, but the rounding error of the product is retained.
+  EXPECT_THAT(a * b + c, Eq(Momentum()));
+  EXPECT_THAT(d.value, Eq(Momentum()));
+  EXPECT_THAT(d.error, Eq(product.error));
+  EXPECT_THAT(d.error, Ne(Momentum()));
+}
+
 }  // namespace internal_double_precision
 }  // namespace numerics
 }  // namespace principia
@@ -1,6 +1,7 @@
 ﻿
 #include "numerics/elliptic_functions.hpp"
 
+#include <cstddef>
 #include <tuple>
 
 #include "glog/logging.h"
@@ -18,6 +19,7 @@ namespace internal_elliptic_functions {
 
 using quantities::Abs;
 using quantities::ArcTan;
+using quantities::NaN;
 using quantities::Pow;
 using quantities::Sqrt;
 using quantities::si::Radian;
@@ -26,12 +28,6 @@ namespace {
 
 constexpr Angle k_over_2_lower_bound = π / 4.0 * Radian;
 
-void JacobiSNCNDNReduced(Angle const& u,
-                         double mc,
-                         double& s,
-                         double& c,
-                         double& d);
-
 // Maclaurin series for Fukushima b₀.  These are polynomials in m that are used
 // as coefficients of a polynomial in u₀².  The index gives the corresponding
 // power of u₀².
@@ -44,6 +40,37 @@ PolynomialInMonomialBasis<double, double, 2, HornerEvaluator>
                                                11.0 / 180.0,
                                                1.0 / 45.0));
 
+// The quantities of the computation of the Jacobi elliptic functions that only
+// depend on the parameter.  They are computed once when evaluating the
+// functions for many arguments with the same parameter.
+struct FukushimaParameters {
+  explicit FukushimaParameters(double mc);
+
+  double const mc;
+  double const m;
+  Angle const uT;
+  Angle const uA;
+  PolynomialInMonomialBasis<double, double, 3, HornerEvaluator> const
+      fukushima_b₀_maclaurin_u₀²_3;
+};
+
+void JacobiSNCNDNReduced(Angle const& u,
+                         FukushimaParameters const& parameters,
+                         double& s,
+                         double& c,
+                         double& d);
+
+FukushimaParameters::FukushimaParameters(double const mc)
+    : mc(mc),
+      m(1.0 - mc),
+      uT((5.217e-3 - 2.143e-3 * m) * Radian),
+      uA((1.76269 + 1.16357 * mc) * Radian),
+      fukushima_b₀_maclaurin_u₀²_3(
+          std::make_tuple(0.0,
+                          fukushima_b₀_maclaurin_m_1.Evaluate(m),
+                          fukushima_b₀_maclaurin_m_2.Evaluate(m),
+                          fukushima_b₀_maclaurin_m_3.Evaluate(m))) {}
+
 // Double precision subroutine to compute three Jacobian elliptic functions
 // simultaneously
 //
@@ -61,14 +88,15 @@ PolynomialInMonomialBasis<double, double, 2, HornerEvaluator>
 //     Output: s = sn(u|m), c=cn(u|m), d=dn(u|m)
 //
 void JacobiSNCNDNReduced(Angle const& u,
-                         double const mc,
+                         FukushimaParameters const& parameters,
                          double& s,
                          double& c,
                          double& d) {
   constexpr int max_reductions = 20;
 
-  double const m = 1.0 - mc;
-  Angle const uT = (5.217e-3 - 2.143e-3 * m) * Radian;
+  double const mc = parameters.mc;
+  double const m = parameters.m;
+  Angle const& uT = parameters.uT;
 
   Angle u₀ = u;
   int n = 0;  // Note that this variable is used after the loop.
@@ -78,20 +106,14 @@ void JacobiSNCNDNReduced(Angle const& u,
     u₀ = 0.5 * u₀;
   }
 
-  double const b₀1 = fukushima_b₀_maclaurin_m_1.Evaluate(m);
-  double const b₀2 = fukushima_b₀_maclaurin_m_2.Evaluate(m);
-  double const b₀3 = fukushima_b₀_maclaurin_m_3.Evaluate(m);
-  PolynomialInMonomialBasis<double, double, 3, HornerEvaluator>
-      fukushima_b₀_maclaurin_u₀²_3(std::make_tuple(0.0, b₀1, b₀2, b₀3));
   double const u₀² = (u₀ * u₀) / Pow<2>(Radian);
 
   // We use the subscript i to indicate variables that are computed as part of
   // the iteration (Fukushima uses subscripts n and N).  This avoids confusion
   // between c (the result) and cᵢ (the intermediate numerator of c).
-  double bᵢ = fukushima_b₀_maclaurin_u₀²_3.Evaluate(u₀²);
+  double bᵢ = parameters.fukushima_b₀_maclaurin_u₀²_3.Evaluate(u₀²);
 
-  Angle const uA = (1.76269 + 1.16357 * mc) * Radian;
-  bool const may_have_cancellation = u > uA;
+  bool const may_have_cancellation = u > parameters.uA;
   double aᵢ = 1.0;
   for (int i = 0; i < n; ++i) {
     double const yᵢ = bᵢ * (2.0 * aᵢ - bᵢ);
@@ -142,7 +164,7 @@ void JacobiSNCNDNReduced(Angle const& u,
 //     Output: s = sn(u|m), c=cn(u|m), d=dn(u|m)
 //
 void JacobiSNCNDNWithK(Angle const& u,
-                       double const mc,
+                       FukushimaParameters const& parameters,
                        Angle const& k,
                        double& s,
                        double& c,
@@ -151,10 +173,10 @@ void JacobiSNCNDNWithK(Angle const& u,
   // Jacobian elliptic function and incomplete elliptic integrals for constant
   // values of elliptic parameter and elliptic characteristic, sections 2.4 and
   // 3.5.2.
-  double const kʹ = Sqrt(mc);
+  double const kʹ = Sqrt(parameters.mc);
   Angle abs_u = Abs(u);
   if (abs_u < k_over_2_lower_bound) {
-    JacobiSNCNDNReduced(abs_u, mc, s, c, d);
+    JacobiSNCNDNReduced(abs_u, parameters, s, c, d);
   } else {
     Angle const two_k = 2.0 * k;
     Angle const three_k = 3.0 * k;
@@ -162,40 +184,40 @@ void JacobiSNCNDNWithK(Angle const& u,
     abs_u =
         abs_u - four_k * static_cast<double>(static_cast<int>(abs_u / four_k));
     if (abs_u < 0.5 * k) {
-      JacobiSNCNDNReduced(abs_u, mc, s, c, d);
+      JacobiSNCNDNReduced(abs_u, parameters, s, c, d);
     } else if (abs_u < k) {
-      JacobiSNCNDNReduced(k - abs_u, mc, s, c, d);
+      JacobiSNCNDNReduced(k - abs_u, parameters, s, c, d);
       double const sx = c / d;
       c = kʹ * s / d;
       s = sx;
       d = kʹ / d;
     } else if (abs_u < 1.5 * k) {
-      JacobiSNCNDNReduced(abs_u - k, mc, s, c, d);
+      JacobiSNCNDNReduced(abs_u - k, parameters, s, c, d);
       double const sx = c / d;
       c = -kʹ * s / d;
       s = sx;
       d = kʹ / d;
     } else if (abs_u < two_k) {
-      JacobiSNCNDNReduced(two_k - abs_u, mc, s, c, d);
+      JacobiSNCNDNReduced(two_k - abs_u, parameters, s, c, d);
       c = -c;
     } else if (abs_u < 2.5 * k) {
-      JacobiSNCNDNReduced(abs_u - two_k, mc, s, c, d);
+      JacobiSNCNDNReduced(abs_u - two_k, parameters, s, c, d);
       s = -s;
       c = -c;
     } else if (abs_u < three_k) {
-      JacobiSNCNDNReduced(three_k - abs_u, mc, s, c, d);
+      JacobiSNCNDNReduced(three_k - abs_u, parameters, s, c, d);
       double const sx = -c / d;
       c = -kʹ * s / d;
       s = sx;
       d = kʹ / d;
     } else if (abs_u < 3.5 * k) {
-      JacobiSNCNDNReduced(abs_u - three_k, mc, s, c, d);
+      JacobiSNCNDNReduced(abs_u - three_k, parameters, s, c, d);
       double const sx = -c / d;
       c = kʹ * s / d;
       s = sx;
       d = kʹ / d;
     } else {
-      JacobiSNCNDNReduced(four_k - abs_u, mc, s, c, d);
+      JacobiSNCNDNReduced(four_k - abs_u, parameters, s, c, d);
       s = -s;
     }
   }
@@ -203,18 +225,20 @@ void JacobiSNCNDNWithK(Angle const& u,
     s = -s;
   }
 }
-}  // namespace
 
-Angle JacobiAmplitude(Angle const& u, double mc) {
-  DCHECK_LE(0, mc);
-  DCHECK_GE(1, mc);
+// The implementations of |JacobiAmplitude| and |JacobiSNCNDN| for the given
+// |parameters|.  |k| must be K(m); it is only used if |u| ≥ π/4, so the scalar
+// functions only compute it in that case.
+Angle JacobiAmplitudeWithParameters(Angle const& u,
+                                    FukushimaParameters const& parameters,
+                                    Angle const& k) {
   double s;
   double c;
   double d;
   double n;
   Angle abs_u = Abs(u);
   if (abs_u < k_over_2_lower_bound) {
-    JacobiSNCNDNReduced(abs_u, mc, s, c, d);
+    JacobiSNCNDNReduced(abs_u, parameters, s, c, d);
     if (u < Angle()) {
       s = -s;
     }
@@ -232,13 +256,52 @@ Angle JacobiAmplitude(Angle const& u, double mc) {
     // to the range [-π/2, π/2].  We avoid the branch cut, and any inaccuracy in
     // the rounding has the innocuous effect of causing the ArcTan to go a bit
     // beyond -π/2 or π/2.
-    Angle const k = EllipticK(mc);
     n = std::nearbyint(u / (2.0 * k));
-    JacobiSNCNDNWithK(u - 2.0 * n * k, mc, k, s, c, d);
+    JacobiSNCNDNWithK(u - 2.0 * n * k, parameters, k, s, c, d);
   }
   return n * π * Radian + ArcTan(s, c);
 }
 
+void JacobiSNCNDNWithParameters(Angle const& u,
+                                FukushimaParameters const& parameters,
+                                Angle const& k,
+                                double& s,
+                                double& c,
+                                double& d) {
+  Angle const abs_u = Abs(u);
+  if (abs_u < k_over_2_lower_bound) {
+    JacobiSNCNDNReduced(abs_u, parameters, s, c, d);
+    if (u < Angle()) {
+      s = -s;
+    }
+  } else {
+    JacobiSNCNDNWithK(u, parameters, k, s, c, d);
+  }
+}
+
+}  // namespace
+
+Angle JacobiAmplitude(Angle const& u, double mc) {
+  DCHECK_LE(0, mc);
+  DCHECK_GE(1, mc);
+  FukushimaParameters const parameters(mc);
+  Angle const k = Abs(u) < k_over_2_lower_bound ? NaN<Angle>() : EllipticK(mc);
+  return JacobiAmplitudeWithParameters(u, parameters, k);
+}
+
+void JacobiAmplitude(absl::Span<Angle const> u,
+                     double const mc,
+                     absl::Span<Angle> φ) {
+  DCHECK_LE(0, mc);
+  DCHECK_GE(1, mc);
+  CHECK_EQ(u.size(), φ.size());
+  FukushimaParameters const parameters(mc);
+  Angle const k = EllipticK(mc);
+  for (std::size_t i = 0; i < u.size(); ++i) {
+    φ[i] = JacobiAmplitudeWithParameters(u[i], parameters, k);
+  }
+}
+
 // Double precision subroutine to compute three Jacobian elliptic functions
 // simultaneously
 //
@@ -262,15 +325,25 @@ void JacobiSNCNDN(Angle const& u,
                   double& d) {
   DCHECK_LE(0, mc);
   DCHECK_GE(1, mc);
-  Angle const abs_u = Abs(u);
-  if (abs_u < k_over_2_lower_bound) {
-    JacobiSNCNDNReduced(abs_u, mc, s, c, d);
-    if (u < Angle()) {
-      s = -s;
-    }
-  } else {
-    Angle const k = EllipticK(mc);
-    JacobiSNCNDNWithK(u, mc, k, s, c, d);
+  FukushimaParameters const parameters(mc);
+  Angle const k = Abs(u) < k_over_2_lower_bound ? NaN<Angle>() : EllipticK(mc);
+  JacobiSNCNDNWithParameters(u, parameters, k, s, c, d);
+}
+
+void JacobiSNCNDN(absl::Span<Angle const> u,
+                  double const mc,
+                  absl::Span<double> s,
+                  absl::Span<double> c,
+                  absl::Span<double> d) {
+  DCHECK_LE(0, mc);
+  DCHECK_GE(1, mc);
+  CHECK_EQ(u.size(), s.size());
+  CHECK_EQ(u.size(), c.size());
+  CHECK_EQ(u.size(), d.size());
+  FukushimaParameters const parameters(mc);
+  Angle const k = EllipticK(mc);
+  for (std::size_t i = 0; i < u.size(); ++i) {
+    JacobiSNCNDNWithParameters(u[i], parameters, k, s[i], c[i], d[i]);
   }
 }
 
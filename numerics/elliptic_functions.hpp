@@ -1,5 +1,6 @@
 #pragma once
 
+#include "absl/types/span.h"
 #include "quantities/quantities.hpp"
 
 // This code is a derived from: Fukushima, Toshio. (2012). xgscd.txt (Fortran
@@ -16,8 +17,23 @@ using quantities::Angle;
 
 Angle JacobiAmplitude(Angle const& u, double mc);
 
+// Same as above for each element of |u|, with the same parameter.  The results
+// are identical to those of the scalar function, but the computations that
+// only depend on |mc| are done once.  |φ| must have the size of |u|.
+void JacobiAmplitude(absl::Span<Angle const> u,
+                     double mc,
+                     absl::Span<Angle> φ);
+
 void JacobiSNCNDN(Angle const& u, double mc, double& s, double& c, double& d);
 
+// Same as above for each element of |u|, with the same parameter.  |s|, |c| and
+// |d| must have the size of |u|.
+void JacobiSNCNDN(absl::Span<Angle const> u,
+                  double mc,
+                  absl::Span<double> s,
+                  absl::Span<double> c,
+                  absl::Span<double> d);
+
 }  // namespace internal_elliptic_functions
 
 using internal_elliptic_functions::JacobiAmplitude;
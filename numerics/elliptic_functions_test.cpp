@@ -2,6 +2,8 @@
 #include "numerics/elliptic_functions.hpp"
 
 #include <limits>
+#include <random>
+#include <vector>
 
 #include "glog/logging.h"
 #include "gmock/gmock.h"
@@ -104,6 +106,40 @@ TEST_F(EllipticFunctionsTest, Mathematica) {
   }
 }
 
+TEST_F(EllipticFunctionsTest, Batch) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution_u(-10.0, 10.0);
+  std::vector<Angle> us;
+  for (int i = 0; i < 1000; ++i) {
+    us.push_back(distribution_u(random) * Radian);
+  }
+  us.push_back(0.1 * Radian);
+  us.push_back(-0.1 * Radian);
+
+  for (double const mc : {0.01, 0.3, 0.99}) {
+    std::vector<Angle> φs(us.size());
+    std::vector<double> ss(us.size());
+    std::vector<double> cs(us.size());
+    std::vector<double> ds(us.size());
+    JacobiAmplitude(us, mc, absl::MakeSpan(φs));
+    JacobiSNCNDN(us,
+                 mc,
+                 absl::MakeSpan(ss),
+                 absl::MakeSpan(cs),
+                 absl::MakeSpan(ds));
+    for (int i = 0; i < us.size(); ++i) {
+      double s;
+      double c;
+      double d;
+      JacobiSNCNDN(us[i], mc, s, c, d);
+      EXPECT_EQ(JacobiAmplitude(us[i], mc), φs[i]) << us[i] << " " << mc;
+      EXPECT_EQ(s, ss[i]) << us[i] << " " << mc;
+      EXPECT_EQ(c, cs[i]) << us[i] << " " << mc;
+      EXPECT_EQ(d, ds[i]) << us[i] << " " << mc;
+    }
+  }
+}
+
 #if !defined(_DEBUG)
 TEST_F(EllipticFunctionsTest, Monotonicity) {
   for (double const mc : {0.01, 0.1, 0.5}) {
@@ -1,6 +1,9 @@
 ﻿
 #include "glog/logging.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <limits>
 #include <tuple>
 #include <utility>
@@ -78,6 +81,43 @@ void FukushimaEllipticBDJ(double nc,
                           Angle& D_m,
                           ThirdKind& J_n_m);
 
+// A cache for the complete integrals B(m), D(m) and J(n|m), which are needed
+// to compute the incomplete integrals for large amplitudes.  When computing the
+// incomplete integrals for many amplitudes with the same n and mc, the complete
+// integrals are only computed once.  There are two entries because the
+// reductions of amplitude and of parameter or characteristic may require the
+// complete integrals for two different values of (n, mc).
+template<typename ThirdKind>
+class CompleteIntegralsCache {
+ public:
+  // Same as |FukushimaEllipticBDJ| above, but returns the cached values if they
+  // have already been computed for |nc| and |mc|.
+  void Get(double nc, double mc, Angle& B_m, Angle& D_m, ThirdKind& J_n_m);
+
+ private:
+  struct Entry {
+    double nc;
+    double mc;
+    Angle B_m;
+    Angle D_m;
+    Angle J_n_m;
+  };
+
+  static constexpr int capacity = 2;
+  std::array<Entry, capacity> entries_;
+  int size_ = 0;
+  int next_ = 0;
+};
+
+// Same as |FukushimaEllipticBDJ| above, but uses the |cache| if it is not null.
+template<typename ThirdKind>
+void FukushimaEllipticBDJ(double nc,
+                          double mc,
+                          CompleteIntegralsCache<ThirdKind>* cache,
+                          Angle& B_m,
+                          Angle& D_m,
+                          ThirdKind& J_n_m);
+
 // Computes Fukushima's incomplete integrals of the second kind and third kind
 // from the cosine of the amplitude: Bc(c|m) = B(arccos c|m),
 // Dc(c|m) = D(arccos c|m), Jc(c, n|m) = J(arccos c, n|m), where m = 1 - mc.
@@ -131,16 +171,19 @@ void FukushimaEllipticBDJ(Angle const& φ,
                           double const mc,
                           Angle& B_φǀm,
                           Angle& D_φǀm,
-                          ThirdKind& J_φ_nǀm);
+                          ThirdKind& J_φ_nǀm,
+                          CompleteIntegralsCache<ThirdKind>* cache = nullptr);
 
 // Implementation of the B, D, J functions with all arguments reduced.
 template<typename ThirdKind, typename = EnableIfAngleResult<ThirdKind>>
-void FukushimaEllipticBDJReduced(Angle const& φ,
-                                 double const n,
-                                 double const mc,
-                                 Angle& B_φǀm,
-                                 Angle& D_φǀm,
-                                 ThirdKind& J_φ_nǀm);
+void FukushimaEllipticBDJReduced(
+    Angle const& φ,
+    double const n,
+    double const mc,
+    Angle& B_φǀm,
+    Angle& D_φǀm,
+    ThirdKind& J_φ_nǀm,
+    CompleteIntegralsCache<ThirdKind>* cache = nullptr);
 
 // The common implementation underlying the functions |EllipticFEΠ| and
 // |EllipticFE| declared in the header file.
@@ -150,7 +193,8 @@ void EllipticFEΠ(Angle const& φ,
                  double const mc,
                  Angle& F_φǀm,
                  Angle& E_φǀm,
-                 ThirdKind& Π_φ_nǀm);
+                 ThirdKind& Π_φ_nǀm,
+                 CompleteIntegralsCache<ThirdKind>* cache = nullptr);
 
 // A generator for the Maclaurin series for q(m) / m where q is Jacobi's nome
 // function.
@@ -1355,6 +1399,50 @@ void FukushimaEllipticBDJ(double const nc,
   }
 }
 
+template<typename ThirdKind>
+void CompleteIntegralsCache<ThirdKind>::Get(double const nc,
+                                            double const mc,
+                                            Angle& B_m,
+                                            Angle& D_m,
+                                            ThirdKind& J_n_m) {
+  for (int i = 0; i < size_; ++i) {
+    Entry const& entry = entries_[i];
+    if (entry.nc == nc && entry.mc == mc) {
+      B_m = entry.B_m;
+      D_m = entry.D_m;
+      if constexpr (should_compute<ThirdKind>) {
+        J_n_m = entry.J_n_m;
+      }
+      return;
+    }
+  }
+  FukushimaEllipticBDJ(nc, mc, B_m, D_m, J_n_m);
+  Entry& entry = entries_[next_];
+  entry.nc = nc;
+  entry.mc = mc;
+  entry.B_m = B_m;
+  entry.D_m = D_m;
+  if constexpr (should_compute<ThirdKind>) {
+    entry.J_n_m = J_n_m;
+  }
+  next_ = (next_ + 1) % capacity;
+  size_ = std::min(size_ + 1, capacity);
+}
+
+template<typename ThirdKind>
+void FukushimaEllipticBDJ(double const nc,
+                          double const mc,
+                          CompleteIntegralsCache<ThirdKind>* const cache,
+                          Angle& B_m,
+                          Angle& D_m,
+                          ThirdKind& J_n_m) {
+  if (cache == nullptr) {
+    FukushimaEllipticBDJ(nc, mc, B_m, D_m, J_n_m);
+  } else {
+    cache->Get(nc, mc, B_m, D_m, J_n_m);
+  }
+}
+
 // Note that the identifiers in the function definition are not the same as
 // those in the function declaration.
 // The declaration follows [Fuk11b], equations (9) and (10), and [Fuk12],
@@ -1735,12 +1823,14 @@ void Reduce(Angle const& angle,
 }
 
 template<typename ThirdKind, typename>
-void FukushimaEllipticBDJReduced(Angle const& φ,
-                                 double const n,
-                                 double const mc,
-                                 Angle& B_φǀm,
-                                 Angle& D_φǀm,
-                                 ThirdKind& J_φ_nǀm) {
+void FukushimaEllipticBDJReduced(
+    Angle const& φ,
+    double const n,
+    double const mc,
+    Angle& B_φǀm,
+    Angle& D_φǀm,
+    ThirdKind& J_φ_nǀm,
+    CompleteIntegralsCache<ThirdKind>* const cache) {
   DCHECK_LE(φ, π/2 * Radian);
   DCHECK_GE(φ, 0 * Radian);
   if constexpr (should_compute<ThirdKind>) {
@@ -1784,7 +1874,7 @@ void FukushimaEllipticBDJReduced(Angle const& φ,
       Angle Ds{uninitialized};      // Ds(z|m).
       ThirdKind Js{uninitialized};  // Js(z, n|m).
       FukushimaEllipticBsDsJs(z, n, mc, Bs, Ds, Js);
-      FukushimaEllipticBDJ(nc, mc, B_m, D_m, J_nǀm);
+      FukushimaEllipticBDJ(nc, mc, cache, B_m, D_m, J_nǀm);
       double const sz = z * Sqrt(1.0 - c²);
       B_φǀm = B_m - (Bs - sz * Radian);
       D_φǀm = D_m - (Ds + sz * Radian);
@@ -1803,7 +1893,7 @@ void FukushimaEllipticBDJReduced(Angle const& φ,
         Angle Dc{uninitialized};      // Dc(w|m).
         ThirdKind Jc{uninitialized};  // Jc(w, n|m).
         FukushimaEllipticBcDcJc(Sqrt(mc * w²_over_mc), n, mc, Bc, Dc, Jc);
-        FukushimaEllipticBDJ(nc, mc, B_m, D_m, J_nǀm);
+        FukushimaEllipticBDJ(nc, mc, cache, B_m, D_m, J_nǀm);
         double const sz = c * Sqrt(w²_over_mc);
         B_φǀm = B_m - (Bc - sz * Radian);
         D_φǀm = D_m - (Dc + sz * Radian);
@@ -1822,7 +1912,8 @@ void FukushimaEllipticBDJ(Angle const& φ,
                           double const mc,
                           Angle& B_φǀm,
                           Angle& D_φǀm,
-                          ThirdKind& J_φ_nǀm) {
+                          ThirdKind& J_φ_nǀm,
+                          CompleteIntegralsCache<ThirdKind>* const cache) {
   // See Appendix B of [Fuk11b] and Appendix A.1 of [Fuk12] for argument
   // reduction.
 
@@ -1835,7 +1926,8 @@ void FukushimaEllipticBDJ(Angle const& φ,
     Reduce(φ, φ_reduced, j);
     Angle const abs_φ_reduced = Abs(φ_reduced);
 
-    FukushimaEllipticBDJ(abs_φ_reduced, n, mc, B_φǀm, D_φǀm, J_φ_nǀm);
+    FukushimaEllipticBDJ(
+        abs_φ_reduced, n, mc, B_φǀm, D_φǀm, J_φ_nǀm, cache);
 
     if (φ_reduced < 0.0 * Radian) {
       // TODO(egg): Much ado about nothing's sign bit.
@@ -1851,7 +1943,7 @@ void FukushimaEllipticBDJ(Angle const& φ,
       Angle B_m{uninitialized};        // B(m).
       Angle D_m{uninitialized};        // D(m).
       ThirdKind J_nǀm{uninitialized};  // J(n|m).
-      FukushimaEllipticBDJ(nc, mc, B_m, D_m, J_nǀm);
+      FukushimaEllipticBDJ(nc, mc, cache, B_m, D_m, J_nǀm);
 
       // See [Fuk11b], equations (B.2), and [Fuk12], equation (A.2).
       B_φǀm += 2 * j * B_m;
@@ -1877,7 +1969,8 @@ void FukushimaEllipticBDJ(Angle const& φ,
     Angle B_φRǀmR{uninitialized};
     Angle D_φRǀmR{uninitialized};
     ThirdKind J_φR_nRǀmR{uninitialized};
-    FukushimaEllipticBDJ(φR, nR, mcR, B_φRǀmR, D_φRǀmR, J_φR_nRǀmR);
+    FukushimaEllipticBDJ(
+        φR, nR, mcR, B_φRǀmR, D_φRǀmR, J_φR_nRǀmR, cache);
 
     B_φǀm = sqrt_mR * (B_φRǀmR + mcR * D_φRǀmR);
     D_φǀm = mR * sqrt_mR * D_φRǀmR;
@@ -1896,7 +1989,8 @@ void FukushimaEllipticBDJ(Angle const& φ,
     Angle B_φNǀmN{uninitialized};
     Angle D_φNǀmN{uninitialized};
     ThirdKind J_φN_nNǀmN{uninitialized};
-    FukushimaEllipticBDJ(φN, nN, mcN, B_φNǀmN, D_φNǀmN, J_φN_nNǀmN);
+    FukushimaEllipticBDJ(
+        φN, nN, mcN, B_φNǀmN, D_φNǀmN, J_φN_nNǀmN, cache);
 
     double const sin_φN = Sin(φN);
     double const sqrt_mcN = Sqrt(mcN);
@@ -1932,7 +2026,7 @@ void FukushimaEllipticBDJ(Angle const& φ,
       double const n1 = m / n;
 
       ThirdKind J_φ_n1ǀm{uninitialized};
-      FukushimaEllipticBDJ(φ, n1, mc, B_φǀm, D_φǀm, J_φ_n1ǀm);
+      FukushimaEllipticBDJ(φ, n1, mc, B_φǀm, D_φǀm, J_φ_n1ǀm, cache);
 
       J_φ_nǀm = (-B_φǀm - D_φǀm + FukushimaT(t1, h1) - n1 * J_φ_n1ǀm) / n;
       return;
@@ -1945,7 +2039,7 @@ void FukushimaEllipticBDJ(Angle const& φ,
       double const n2 = (m - n) / nc;
 
       ThirdKind J_φ_n2ǀm{uninitialized};
-      FukushimaEllipticBDJ(φ, n2, mc, B_φǀm, D_φǀm, J_φ_n2ǀm);
+      FukushimaEllipticBDJ(φ, n2, mc, B_φǀm, D_φǀm, J_φ_n2ǀm, cache);
 
       J_φ_nǀm =
           (B_φǀm + D_φǀm - FukushimaT(t2, h2) - (mc / nc) * J_φ_n2ǀm) / nc;
@@ -1954,7 +2048,7 @@ void FukushimaEllipticBDJ(Angle const& φ,
   }
 
   // No further reduction needed.
-  FukushimaEllipticBDJReduced(φ, n, mc, B_φǀm, D_φǀm, J_φ_nǀm);
+  FukushimaEllipticBDJReduced(φ, n, mc, B_φǀm, D_φǀm, J_φ_nǀm, cache);
 }
 
 template<typename ThirdKind, typename>
@@ -1963,11 +2057,12 @@ void EllipticFEΠ(Angle const& φ,
                  double const mc,
                  Angle& F_φǀm,
                  Angle& E_φǀm,
-                 ThirdKind& Π_φ_nǀm) {
+                 ThirdKind& Π_φ_nǀm,
+                 CompleteIntegralsCache<ThirdKind>* const cache) {
   Angle B{uninitialized};
   Angle D{uninitialized};
   ThirdKind J{uninitialized};
-  FukushimaEllipticBDJ(φ, n, mc, B, D, J);
+  FukushimaEllipticBDJ(φ, n, mc, B, D, J, cache);
   F_φǀm = B + D;
   E_φǀm = B + mc * D;
   if constexpr (should_compute<ThirdKind>) {
@@ -1986,6 +2081,22 @@ void FukushimaEllipticBDJ(Angle const& φ,
   return FukushimaEllipticBDJ<Angle>(φ, n, mc, B_φǀm, D_φǀm, J_φ_nǀm);
 }
 
+void FukushimaEllipticBDJ(absl::Span<Angle const> φ,
+                          double const n,
+                          double const mc,
+                          absl::Span<Angle> B_φǀm,
+                          absl::Span<Angle> D_φǀm,
+                          absl::Span<Angle> J_φ_nǀm) {
+  CHECK_EQ(φ.size(), B_φǀm.size());
+  CHECK_EQ(φ.size(), D_φǀm.size());
+  CHECK_EQ(φ.size(), J_φ_nǀm.size());
+  CompleteIntegralsCache<Angle> cache;
+  for (std::size_t i = 0; i < φ.size(); ++i) {
+    FukushimaEllipticBDJ<Angle>(
+        φ[i], n, mc, B_φǀm[i], D_φǀm[i], J_φ_nǀm[i], &cache);
+  }
+}
+
 void FukushimaEllipticBD(Angle const& φ,
                          double const mc,
                          Angle& B_φǀm,
@@ -2000,6 +2111,17 @@ Angle EllipticF(Angle const& φ, double const mc) {
   return F;
 }
 
+void EllipticF(absl::Span<Angle const> φ,
+               double const mc,
+               absl::Span<Angle> F_φǀm) {
+  CHECK_EQ(φ.size(), F_φǀm.size());
+  CompleteIntegralsCache<UnusedResult const> cache;
+  for (std::size_t i = 0; i < φ.size(); ++i) {
+    Angle E{uninitialized};
+    EllipticFEΠ(φ[i], /*n=*/1, mc, F_φǀm[i], E, /*Π=*/unused, &cache);
+  }
+}
+
 Angle EllipticE(Angle const& φ, double const mc) {
   Angle F{uninitialized};
   Angle E{uninitialized};
@@ -2015,6 +2137,19 @@ Angle EllipticΠ(Angle const& φ, double const n, double const mc) {
   return Π;
 }
 
+void EllipticΠ(absl::Span<Angle const> φ,
+               double const n,
+               double const mc,
+               absl::Span<Angle> Π_φ_nǀm) {
+  CHECK_EQ(φ.size(), Π_φ_nǀm.size());
+  CompleteIntegralsCache<Angle> cache;
+  for (std::size_t i = 0; i < φ.size(); ++i) {
+    Angle F{uninitialized};
+    Angle E{uninitialized};
+    EllipticFEΠ<Angle>(φ[i], n, mc, F, E, Π_φ_nǀm[i], &cache);
+  }
+}
+
 void EllipticFE(Angle const& φ, double mc, Angle& F_φǀm, Angle& E_φǀm) {
   EllipticFEΠ(φ, /*n=*/1, mc, F_φǀm, E_φǀm, /*Π=*/unused);
 }
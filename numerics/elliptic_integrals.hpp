@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "absl/types/span.h"
 #include "quantities/quantities.hpp"
 
 // Bibliography:
@@ -51,6 +52,17 @@ void FukushimaEllipticBDJ(Angle const& φ,
                           Angle& D_φǀm,
                           Angle& J_φ_nǀm);
 
+// Same as above for each element of |φ|, with the same characteristic and
+// parameter.  The results are identical to those of the scalar function, but
+// the complete integrals needed by the argument reduction are only computed
+// once.  The output spans must have the size of |φ|.
+void FukushimaEllipticBDJ(absl::Span<Angle const> φ,
+                          double n,
+                          double mc,
+                          absl::Span<Angle> B_φǀm,
+                          absl::Span<Angle> D_φǀm,
+                          absl::Span<Angle> J_φ_nǀm);
+
 // Same as above, but does not compute J.
 void FukushimaEllipticBD(Angle const& φ, double mc, Angle& B_φǀm, Angle& D_φǀm);
 
@@ -58,6 +70,10 @@ void FukushimaEllipticBD(Angle const& φ, double mc, Angle& B_φǀm, Angle& D_φ
 // m = 1 - mc.
 Angle EllipticF(Angle const& φ, double mc);
 
+// Same as above for each element of |φ|, with the same parameter.  |F_φǀm| must
+// have the size of |φ|.
+void EllipticF(absl::Span<Angle const> φ, double mc, absl::Span<Angle> F_φǀm);
+
 // Returns the incomplete elliptic integral of the second kind E(φ|m), where
 // m = 1 - mc.
 Angle EllipticE(Angle const& φ, double mc);
@@ -66,6 +82,13 @@ Angle EllipticE(Angle const& φ, double mc);
 // m = 1 - mc.
 Angle EllipticΠ(Angle const& φ, double n, double mc);
 
+// Same as above for each element of |φ|, with the same characteristic and
+// parameter.  |Π_φ_nǀm| must have the size of |φ|.
+void EllipticΠ(absl::Span<Angle const> φ,
+               double n,
+               double mc,
+               absl::Span<Angle> Π_φ_nǀm);
+
 // Computes the incomplete elliptic integrals the first and second kinds F(φ|m)
 // and E(φ|m), where m = 1 - mc.
 void EllipticFE(Angle const& φ, double mc, Angle& F_φǀm, Angle& E_φǀm);
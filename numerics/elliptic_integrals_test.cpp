@@ -2,6 +2,7 @@
 #include "numerics/elliptic_integrals.hpp"
 
 #include <filesystem>
+#include <random>
 #include <vector>
 #include <utility>
 
@@ -188,5 +189,44 @@ TEST_F(EllipticIntegralsTest, MathematicaTrivariate) {
   }
 }
 
+TEST_F(EllipticIntegralsTest, Batch) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution_φ(-10.0, 10.0);
+  std::vector<Angle> φs;
+  for (int i = 0; i < 100; ++i) {
+    φs.push_back(distribution_φ(random) * Radian);
+  }
+
+  for (double const n : {-0.5, 0.3, 1.5}) {
+    for (double const mc : {0.2, 0.9}) {
+      std::vector<Angle> bs(φs.size());
+      std::vector<Angle> ds(φs.size());
+      std::vector<Angle> js(φs.size());
+      std::vector<Angle> fs(φs.size());
+      std::vector<Angle> ᴨs(φs.size());
+      FukushimaEllipticBDJ(φs,
+                           n,
+                           mc,
+                           absl::MakeSpan(bs),
+                           absl::MakeSpan(ds),
+                           absl::MakeSpan(js));
+      EllipticF(φs, mc, absl::MakeSpan(fs));
+      EllipticΠ(φs, n, mc, absl::MakeSpan(ᴨs));
+      for (int i = 0; i < φs.size(); ++i) {
+        Angle b;
+        Angle d;
+        Angle j;
+        FukushimaEllipticBDJ(φs[i], n, mc, b, d, j);
+        EXPECT_EQ(b, bs[i]) << φs[i] << " " << n << " " << mc;
+        EXPECT_EQ(d, ds[i]) << φs[i] << " " << n << " " << mc;
+        EXPECT_EQ(j, js[i]) << φs[i] << " " << n << " " << mc;
+        EXPECT_EQ(EllipticF(φs[i], mc), fs[i]) << φs[i] << " " << mc;
+        EXPECT_EQ(EllipticΠ(φs[i], n, mc), ᴨs[i])
+            << φs[i] << " " << n << " " << mc;
+      }
+    }
+  }
+}
+
 }  // namespace numerics
 }  // namespace principia
@@ -1,9 +1,13 @@
 ﻿
 #include "numerics/fast_sin_cos_2π.hpp"
 
+#include <cstddef>
+#include <immintrin.h>
+#include <limits>
 #include <pmmintrin.h>
 
 #include "base/macros.hpp"
+#include "glog/logging.h"
 #include "numerics/polynomial.hpp"
 #include "numerics/polynomial_evaluators.hpp"
 
@@ -34,11 +38,12 @@ double const s₅ = 79.5314110676979262924240784281 / (4 * 16 * 16);
 // The cosine polynomial for 16 z² ⟼ (Cos(2 π z) - 1)/(16 z²) is turned into a
 // polynomial for 16 z² ⟼ Cos(2 π z) by multiplying by the argument and adding
 // 1, i.e., prepending 1 to the list of coefficients.
-P3 cos_polynomial(P3::Coefficients{
-    1.0,
-    -19.7391672615468690589481752820 / 16,
-    64.9232282990046449731568966307 / (16 * 16),
-    -83.6659064641344641438100039739 / (16 * 16 * 16)});
+// The coefficients are named for use by the SIMD evaluation.
+double const c₀ = 1.0;
+double const c₁ = -19.7391672615468690589481752820 / 16;
+double const c₂ = 64.9232282990046449731568966307 / (16 * 16);
+double const c₃ = -83.6659064641344641438100039739 / (16 * 16 * 16);
+P3 cos_polynomial(P3::Coefficients{c₀, c₁, c₂, c₃});
 
 struct Decomposition {
   std::int64_t integer_part;
@@ -60,6 +65,118 @@ Decomposition Decompose(double const x) {
   return decomposition;
 }
 
+#if PRINCIPIA_USE_AVX_INTRINSICS
+// Computes the sines and cosines of 4 arguments using the same operations as
+// |FastSinCos2π|, but without branches.
+FORCE_INLINE(inline) void FastSinCos2πInLanes(double const* const cycles,
+                                              double* const sin,
+                                              double* const cos) {
+  __m256d const x = _mm256_mul_pd(_mm256_set1_pd(4.0),
+                                  _mm256_loadu_pd(cycles));
+  // This rounds in the same way as |_mm_cvtsd_si64| in |Decompose|.  The
+  // addition turns -0.0 into +0.0, like the conversion from an integer.
+  __m256d const integer_part = _mm256_add_pd(
+      _mm256_round_pd(x, _MM_FROUND_CUR_DIRECTION), _mm256_setzero_pd());
+  __m256d const y = _mm256_sub_pd(x, integer_part);
+  __m256d const y² = _mm256_mul_pd(y, y);
+  __m256d const y³ = _mm256_mul_pd(y², y);
+
+  // The quadrant is exactly |integer_part| modulo 4, as a double.
+  __m256d const quadrant = _mm256_sub_pd(
+      integer_part,
+      _mm256_mul_pd(_mm256_set1_pd(4.0),
+                    _mm256_floor_pd(_mm256_mul_pd(_mm256_set1_pd(0.25),
+                                                  integer_part))));
+  __m256d const quadrant_1 =
+      _mm256_cmp_pd(quadrant, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+  __m256d const quadrant_2 =
+      _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+  __m256d const quadrant_3 =
+      _mm256_cmp_pd(quadrant, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+
+  __m256d const s = _mm256_add_pd(
+      _mm256_mul_pd(_mm256_set1_pd(s₁), y),
+      _mm256_mul_pd(_mm256_add_pd(_mm256_set1_pd(s₃),
+                                  _mm256_mul_pd(_mm256_set1_pd(s₅), y²)),
+                    y³));
+  // Same evaluation as |EstrinEvaluator|.
+  __m256d const y⁴ = _mm256_mul_pd(y², y²);
+  __m256d const c = _mm256_add_pd(
+      _mm256_add_pd(_mm256_set1_pd(c₀),
+                    _mm256_mul_pd(y², _mm256_set1_pd(c₁))),
+      _mm256_mul_pd(y⁴,
+                    _mm256_add_pd(_mm256_set1_pd(c₂),
+                                  _mm256_mul_pd(y², _mm256_set1_pd(c₃)))));
+
+  // Swap the functions in the odd quadrants, and change the signs as needed.
+  __m256d const sign_bit = _mm256_set1_pd(-0.0);
+  __m256d const swap = _mm256_or_pd(quadrant_1, quadrant_3);
+  __m256d const negate_sin = _mm256_or_pd(quadrant_2, quadrant_3);
+  __m256d const negate_cos = _mm256_or_pd(quadrant_1, quadrant_2);
+  _mm256_storeu_pd(sin,
+                   _mm256_xor_pd(_mm256_blendv_pd(s, c, swap),
+                                 _mm256_and_pd(negate_sin, sign_bit)));
+  _mm256_storeu_pd(cos,
+                   _mm256_xor_pd(_mm256_blendv_pd(c, s, swap),
+                                 _mm256_and_pd(negate_cos, sign_bit)));
+}
+#elif PRINCIPIA_USE_SSE3_INTRINSICS
+// Same as above with 2 arguments, using only SSE2 instructions.  Returns false,
+// without storing anything, if the integer part of |4 * cycles| may not fit in
+// a 32-bit integer.
+FORCE_INLINE(inline) bool FastSinCos2πInLanes(double const* const cycles,
+                                              double* const sin,
+                                              double* const cos) {
+  __m128d const x = _mm_mul_pd(_mm_set1_pd(4.0), _mm_loadu_pd(cycles));
+  // This rounds in the same way as |_mm_cvtsd_si64| in |Decompose|.  The
+  // conversion returns the smallest 32-bit integer if it overflows.
+  __m128i const integer_part = _mm_cvtpd_epi32(x);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi32(
+          integer_part, _mm_set1_epi32(std::numeric_limits<int>::min()))) !=
+      0) {
+    return false;
+  }
+  __m128d const y = _mm_sub_pd(x, _mm_cvtepi32_pd(integer_part));
+  __m128d const y² = _mm_mul_pd(y, y);
+  __m128d const y³ = _mm_mul_pd(y², y);
+
+  // Each 64-bit lane gets the integer part of its argument in both halves.
+  // The low bits of the integer part are the quadrant.  Bit 0 indicates that
+  // the functions must be swapped, bit 1 that the sine must be negated, and
+  // bit 1 of the quadrant plus 1 that the cosine must be negated.
+  __m128i const quadrant =
+      _mm_shuffle_epi32(integer_part, _MM_SHUFFLE(1, 1, 0, 0));
+  __m128i const one = _mm_set1_epi32(1);
+  __m128d const swap = _mm_castsi128_pd(
+      _mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+  __m128d const sign_bit = _mm_set1_pd(-0.0);
+  __m128d const negate_sin =
+      _mm_and_pd(_mm_castsi128_pd(_mm_slli_epi64(quadrant, 62)), sign_bit);
+  __m128d const negate_cos = _mm_and_pd(
+      _mm_castsi128_pd(_mm_slli_epi64(_mm_add_epi32(quadrant, one), 62)),
+      sign_bit);
+
+  __m128d const s = _mm_add_pd(
+      _mm_mul_pd(_mm_set1_pd(s₁), y),
+      _mm_mul_pd(_mm_add_pd(_mm_set1_pd(s₃),
+                            _mm_mul_pd(_mm_set1_pd(s₅), y²)),
+                 y³));
+  // Same evaluation as |EstrinEvaluator|.
+  __m128d const y⁴ = _mm_mul_pd(y², y²);
+  __m128d const c = _mm_add_pd(
+      _mm_add_pd(_mm_set1_pd(c₀), _mm_mul_pd(y², _mm_set1_pd(c₁))),
+      _mm_mul_pd(y⁴,
+                 _mm_add_pd(_mm_set1_pd(c₂),
+                            _mm_mul_pd(y², _mm_set1_pd(c₃)))));
+
+  // Swap the functions in the odd quadrants, and change the signs as needed.
+  __m128d const swapped_bits = _mm_and_pd(swap, _mm_xor_pd(s, c));
+  _mm_storeu_pd(sin, _mm_xor_pd(_mm_xor_pd(s, swapped_bits), negate_sin));
+  _mm_storeu_pd(cos, _mm_xor_pd(_mm_xor_pd(c, swapped_bits), negate_cos));
+  return true;
+}
+#endif
+
 }  // namespace
 
 void FastSinCos2π(double const cycles, double& sin, double& cos) {
@@ -102,5 +219,28 @@ void FastSinCos2π(double const cycles, double& sin, double& cos) {
   }
 }
 
+void FastSinCos2π(absl::Span<double const> const cycles,
+                  absl::Span<double> const sin,
+                  absl::Span<double> const cos) {
+  CHECK_EQ(cycles.size(), sin.size());
+  CHECK_EQ(cycles.size(), cos.size());
+  std::size_t i = 0;
+#if PRINCIPIA_USE_AVX_INTRINSICS
+  for (; i + 4 <= cycles.size(); i += 4) {
+    FastSinCos2πInLanes(&cycles[i], &sin[i], &cos[i]);
+  }
+#elif PRINCIPIA_USE_SSE3_INTRINSICS
+  for (; i + 2 <= cycles.size(); i += 2) {
+    if (!FastSinCos2πInLanes(&cycles[i], &sin[i], &cos[i])) {
+      FastSinCos2π(cycles[i], sin[i], cos[i]);
+      FastSinCos2π(cycles[i + 1], sin[i + 1], cos[i + 1]);
+    }
+  }
+#endif
+  for (; i < cycles.size(); ++i) {
+    FastSinCos2π(cycles[i], sin[i], cos[i]);
+  }
+}
+
 }  // namespace numerics
 }  // namespace principia
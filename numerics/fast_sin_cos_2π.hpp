@@ -1,6 +1,8 @@
 ﻿
 #pragma once
 
+#include "absl/types/span.h"
+
 namespace principia {
 namespace numerics {
 
@@ -9,5 +11,13 @@ namespace numerics {
 // cycles.  The argument must be in the range of the 64-bit integers.
 void FastSinCos2π(double cycles, double& sin, double& cos);
 
+// Same as above for each element of |cycles|, with the results stored in the
+// corresponding elements of |sin| and |cos|, which must have the same size as
+// |cycles|.  The computation is done in SIMD lanes if possible, and the results
+// are bitwise identical to those of the preceding function.
+void FastSinCos2π(absl::Span<double const> cycles,
+                  absl::Span<double> sin,
+                  absl::Span<double> cos);
+
 }  // namespace numerics
 }  // namespace principia
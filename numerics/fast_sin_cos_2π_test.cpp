@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <random>
+#include <vector>
 
 #include "glog/logging.h"
 #include "gtest/gtest.h"
@@ -143,5 +144,30 @@ TEST_F(FastSinCos2πTest, Monotonicity) {
   EXPECT_LT(max_cos_error, 4e-16);
 }
 
+// Check that the batch function gives the same results as the scalar one,
+// including for the special values and the elements that don't fill a SIMD
+// register.
+TEST_F(FastSinCos2πTest, Batch) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> distribution(-1e6, 1e6);
+  std::vector<double> cycles{0.0, -0.0, 0.25, 0.5, 0.75, 1.0, -0.25,
+                             0.125, -0.375, -0.625, 1e15 + 0.5,
+                             0x1p50 + 0.125, 0x1p50 + 0.375, -0x1p50 - 0.375,
+                             3e15 + 0.25, -1e18};
+  for (int i = 0; i < 1000; ++i) {
+    cycles.push_back(distribution(random));
+  }
+  std::vector<double> sin(cycles.size());
+  std::vector<double> cos(cycles.size());
+  FastSinCos2π(cycles, absl::MakeSpan(sin), absl::MakeSpan(cos));
+  for (int i = 0; i < cycles.size(); ++i) {
+    double expected_sin;
+    double expected_cos;
+    FastSinCos2π(cycles[i], expected_sin, expected_cos);
+    EXPECT_THAT(sin[i], AlmostEquals(expected_sin, 0)) << cycles[i];
+    EXPECT_THAT(cos[i], AlmostEquals(expected_cos, 0)) << cycles[i];
+  }
+}
+
 }  // namespace numerics
 }  // namespace principia
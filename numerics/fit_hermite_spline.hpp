@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include <list>
+#include <vector>
 
 #include "numerics/hermite3.hpp"
 
@@ -34,6 +35,23 @@ std::list<typename Samples::const_iterator> FitHermiteSpline(
         typename Samples::value_type const&)> const& get_derivative,
     typename Normed<Difference<Value>>::NormType const& tolerance);
 
+// Same as above, but the iterators are written to |tail|, which is cleared
+// first, so that its storage may be reused across calls.  The end of each
+// polynomial is found by an exponential search followed by a binary search, so
+// the running time is linear in the size of |samples| times the logarithm of
+// the length of the polynomials.
+template<typename Argument, typename Value, typename Samples>
+void FitHermiteSpline(
+    Samples const& samples,
+    std::function<Argument const&(typename Samples::value_type const&)> const&
+        get_argument,
+    std::function<Value const&(typename Samples::value_type const&)> const&
+        get_value,
+    std::function<Derivative<Value, Argument> const&(
+        typename Samples::value_type const&)> const& get_derivative,
+    typename Normed<Difference<Value>>::NormType const& tolerance,
+    std::vector<typename Samples::const_iterator>& tail);
+
 }  // namespace internal_fit_hermite_spline
 
 using internal_fit_hermite_spline::FitHermiteSpline;
@@ -1,8 +1,11 @@
 ﻿
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <list>
 #include <type_traits>
+#include <vector>
 
 #include "base/ranges.hpp"
 #include "numerics/hermite3.hpp"
@@ -14,19 +17,24 @@ namespace internal_fit_hermite_spline {
 using base::Range;
 using geometry::Normed;
 
-template<typename Argument, typename Value, typename Samples>
-std::list<typename Samples::const_iterator> FitHermiteSpline(
-    Samples const& samples,
-    std::function<Argument const&(typename Samples::value_type const&)> const&
+// Fits the samples in [begin, last] and appends the iterators delimiting the
+// polynomials to |tail|, as specified for |FitHermiteSpline|.
+template<typename Argument, typename Value, typename Iterator>
+void FitHermiteSplineRange(
+    Iterator begin,
+    Iterator const last,
+    std::function<Argument const&(
+        typename std::iterator_traits<Iterator>::value_type const&)> const&
         get_argument,
-    std::function<Value const&(typename Samples::value_type const&)> const&
+    std::function<Value const&(
+        typename std::iterator_traits<Iterator>::value_type const&)> const&
         get_value,
     std::function<Derivative<Value, Argument> const&(
-        typename Samples::value_type const&)> const& get_derivative,
-    typename Normed<Difference<Value>>::NormType const& tolerance) {
-  using Iterator = typename Samples::const_iterator;
-
-  auto interpolation_error = [get_argument, get_derivative, get_value](
+        typename std::iterator_traits<Iterator>::value_type const&)> const&
+        get_derivative,
+    typename Normed<Difference<Value>>::NormType const& tolerance,
+    std::vector<Iterator>& tail) {
+  auto interpolation_error = [&get_argument, &get_derivative, &get_value](
                                  Iterator begin, Iterator last) {
     return Hermite3<Argument, Value>(
                {get_argument(*begin), get_argument(*last)},
@@ -35,17 +43,7 @@ std::list<typename Samples::const_iterator> FitHermiteSpline(
         .LInfinityError(Range(begin, last + 1), get_argument, get_value);
   };
 
-  std::list<Iterator> tail;
-  if (samples.size() < 3) {
-    // With 0 or 1 points there is nothing to interpolate, with 2 we cannot
-    // estimate the error.
-    return tail;
-  }
-
-  Iterator begin = samples.begin();
-  Iterator const last = samples.end() - 1;
-  while (last - begin + 1 >= 3 &&
-         interpolation_error(begin, last) >= tolerance) {
+  while (last - begin + 1 >= 3) {
     // Look for a cubic that fits the beginning within |tolerance| and
     // such the cubic fitting one more sample would not fit the samples within
     // |tolerance|.
@@ -55,8 +53,23 @@ std::list<typename Samples::const_iterator> FitHermiteSpline(
 
     // Invariant: The Hermite interpolant on [begin, lower] is below the
     // tolerance, the Hermite interpolant on [begin, upper] is above.
+    // We first establish the invariant by doubling the length of the
+    // interpolant, so that the cost of the search is proportional to the length
+    // of the cubic that we find, not to the number of samples left.  If we
+    // reach |last| without exceeding the tolerance, the rest of the samples are
+    // fitted by a single cubic and we are done.
     Iterator lower = begin + 1;
-    Iterator upper = last;
+    Iterator upper;
+    for (std::ptrdiff_t length = 2;; length *= 2) {
+      upper = last - begin > length ? begin + length : last;
+      if (interpolation_error(begin, upper) >= tolerance) {
+        break;
+      } else if (upper == last) {
+        return;
+      }
+      lower = upper;
+    }
+
     for (;;) {
       auto const middle = lower + (upper - lower) / 2;
       // Note that lower ≤ middle ≤ upper.
@@ -78,12 +91,54 @@ std::list<typename Samples::const_iterator> FitHermiteSpline(
 
     begin = lower;
   }
+}
+
+template<typename Argument, typename Value, typename Samples>
+std::list<typename Samples::const_iterator> FitHermiteSpline(
+    Samples const& samples,
+    std::function<Argument const&(typename Samples::value_type const&)> const&
+        get_argument,
+    std::function<Value const&(typename Samples::value_type const&)> const&
+        get_value,
+    std::function<Derivative<Value, Argument> const&(
+        typename Samples::value_type const&)> const& get_derivative,
+    typename Normed<Difference<Value>>::NormType const& tolerance) {
+  std::vector<typename Samples::const_iterator> tail;
+  FitHermiteSpline<Argument, Value>(
+      samples, get_argument, get_value, get_derivative, tolerance, tail);
+  return std::list<typename Samples::const_iterator>(tail.begin(), tail.end());
+}
+
+template<typename Argument, typename Value, typename Samples>
+void FitHermiteSpline(
+    Samples const& samples,
+    std::function<Argument const&(typename Samples::value_type const&)> const&
+        get_argument,
+    std::function<Value const&(typename Samples::value_type const&)> const&
+        get_value,
+    std::function<Derivative<Value, Argument> const&(
+        typename Samples::value_type const&)> const& get_derivative,
+    typename Normed<Difference<Value>>::NormType const& tolerance,
+    std::vector<typename Samples::const_iterator>& tail) {
+  tail.clear();
+  if (samples.size() < 3) {
+    // With 0 or 1 points there is nothing to interpolate, with 2 we cannot
+    // estimate the error.
+    return;
+  }
+
+  FitHermiteSplineRange<Argument, Value>(samples.begin(),
+                                         samples.end() - 1,
+                                         get_argument,
+                                         get_value,
+                                         get_derivative,
+                                         tolerance,
+                                         tail);
 
   // If downsampling is not effective we'll output one iterator for each input
   // point, except at the end where we give up because we don't have enough
   // points left.
   CHECK_LT(tail.size(), samples.size() - 2);
-  return tail;
 }
 
 }  // namespace internal_fit_hermite_spline
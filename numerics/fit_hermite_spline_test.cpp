@@ -29,6 +29,7 @@ using quantities::si::Second;
 using testing_utilities::IsNear;
 using testing_utilities::operator""_⑴;
 using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
 using ::testing::Eq;
 using ::testing::ResultOf;
 
@@ -113,6 +114,51 @@ TEST_F(FitHermiteSplineTest, Sinusoid) {
               IsNear(107_⑴ * Nano(Metre)));
 }
 
+TEST_F(FitHermiteSplineTest, Tail) {
+  AngularFrequency const ω = 1 * Radian / Second;
+  auto const f = [ω, this](Instant const& t) {
+    return Cos(ω * (t - t0_)) * Metre;
+  };
+  auto const df = [ω, this](Instant const& t) {
+    return -ω * Sin(ω *(t - t0_)) * Metre / Radian;
+  };
+  std::vector<Sample> samples;
+  for (auto t = DoublePrecision<Instant>(t0_);
+       t.value < t0_ + 100 * Second;
+       t.Increment(10 * Milli(Second))) {
+    samples.push_back({t.value, f(t.value), df(t.value)});
+  }
+  auto const get_t = [](auto&& sample) -> auto&& { return sample.t; };
+  auto const get_x = [](auto&& sample) -> auto&& { return sample.x; };
+  auto const get_v = [](auto&& sample) -> auto&& { return sample.v; };
+  Length const tolerance = 1 * Milli(Metre);
+
+  std::list<std::vector<Sample>::const_iterator> const list_tail =
+      FitHermiteSpline<Instant, Length>(
+          samples, get_t, get_x, get_v, tolerance);
+  std::vector<std::vector<Sample>::const_iterator> vector_tail;
+  FitHermiteSpline<Instant, Length>(
+      samples, get_t, get_x, get_v, tolerance, vector_tail);
+  EXPECT_THAT(vector_tail, ElementsAreArray(list_tail));
+  EXPECT_THAT(vector_tail.size(), Eq(95));
+
+  // All the polynomials, including the one that ends at the last sample, fit
+  // the samples within the tolerance.
+  vector_tail.push_back(samples.cend() - 1);
+  auto lower_bound = samples.cbegin();
+  for (auto const upper_bound : vector_tail) {
+    ASSERT_LT(lower_bound, upper_bound);
+    Hermite3<Instant, Length> const polynomial(
+        {lower_bound->t, upper_bound->t},
+        {lower_bound->x, upper_bound->x},
+        {lower_bound->v, upper_bound->v});
+    EXPECT_LT(polynomial.LInfinityError(
+                  Range(lower_bound, upper_bound + 1), get_t, get_x),
+              tolerance);
+    lower_bound = upper_bound;
+  }
+}
+
 TEST_F(FitHermiteSplineDeathTest, NoDownsampling) {
   AngularFrequency const ω = 1 * Radian / Second;
   auto const f = [ω, this](Instant const& t) {
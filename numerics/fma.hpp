@@ -0,0 +1,50 @@
+﻿
+#pragma once
+
+#include "base/cpuid.hpp"
+#include "base/macros.hpp"
+
+namespace principia {
+namespace numerics {
+namespace internal_fma {
+
+// True if the compiler lets us emit FMA instructions regardless of the
+// processor that it targets.  MSVC does, Clang and GCC only do so if they
+// target a processor that has FMA.
+#if PRINCIPIA_COMPILER_MSVC || PRINCIPIA_USE_FMA_INTRINSICS
+constexpr bool CanEmitFMAInstructions = true;
+#else
+constexpr bool CanEmitFMAInstructions = false;
+#endif
+
+// True if the functions below may be called.  This is decided at compile time
+// if the compiler targets a processor that has FMA, and at startup, based on
+// the processor on which we run, otherwise.  These functions should only be
+// used when the result doesn't depend on the availability of FMA (e.g., in
+// error-free transformations), lest the results differ between processors.
+// Note that with Clang and GCC |CanEmitFMAInstructions| is false unless we
+// compile with -mfma, in which case the choice is made at compile time: the
+// choice at startup only ever happens with MSVC.
+inline bool const UseHardwareFMA =
+    CanEmitFMAInstructions &&
+    (PRINCIPIA_USE_FMA_INTRINSICS || base::CPUSupportsFMA());
+
+// Returns a * b + c computed with a single rounding using the FMA
+// instructions.  Must only be called if |UseHardwareFMA| is true.
+double FusedMultiplyAdd(double a, double b, double c);
+
+// Returns a * b - c computed with a single rounding using the FMA
+// instructions.  Must only be called if |UseHardwareFMA| is true.
+double FusedMultiplySubtract(double a, double b, double c);
+
+}  // namespace internal_fma
+
+using internal_fma::CanEmitFMAInstructions;
+using internal_fma::FusedMultiplyAdd;
+using internal_fma::FusedMultiplySubtract;
+using internal_fma::UseHardwareFMA;
+
+}  // namespace numerics
+}  // namespace principia
+
+#include "numerics/fma_body.hpp"
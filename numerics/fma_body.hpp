@@ -0,0 +1,43 @@
+﻿
+#pragma once
+
+#include "numerics/fma.hpp"
+
+#include <immintrin.h>
+
+#include <cmath>
+
+#include "glog/logging.h"
+
+namespace principia {
+namespace numerics {
+namespace internal_fma {
+
+// MSVC doesn't reliably turn |std::fma| into an FMA instruction, and Clang and
+// GCC don't handle the scalar intrinsics well, so we need both flavours.
+
+inline double FusedMultiplyAdd(double const a, double const b, double const c) {
+  DCHECK(UseHardwareFMA);
+#if PRINCIPIA_COMPILER_MSVC
+  return _mm_cvtsd_f64(
+      _mm_fmadd_sd(_mm_set_sd(a), _mm_set_sd(b), _mm_set_sd(c)));
+#else
+  return std::fma(a, b, c);
+#endif
+}
+
+inline double FusedMultiplySubtract(double const a,
+                                    double const b,
+                                    double const c) {
+  DCHECK(UseHardwareFMA);
+#if PRINCIPIA_COMPILER_MSVC
+  return _mm_cvtsd_f64(
+      _mm_fmsub_sd(_mm_set_sd(a), _mm_set_sd(b), _mm_set_sd(c)));
+#else
+  return std::fma(a, b, -c);
+#endif
+}
+
+}  // namespace internal_fma
+}  // namespace numerics
+}  // namespace principia
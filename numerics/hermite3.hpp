@@ -38,6 +38,10 @@ class Hermite3 final {
   // The result is sorted.
   BoundedArray<Argument, 2> FindExtrema() const;
 
+  // Returns the real roots of this polynomial, which must be scalar-valued.
+  // The result is sorted.
+  BoundedArray<Argument, 3> FindRoots() const;
+
   // |samples| must be a container; |get_argument| and |get_value| on the
   // elements of |samples| must return |Argument| and |Value| respectively
   // (possibly by reference or const-reference)
@@ -64,6 +64,12 @@ BoundedArray<Argument, 2> Hermite3<Argument, Value>::FindExtrema() const {
       arguments_.first, a1_, 2.0 * a2_, 3.0 * a3_);
 }
 
+template<typename Argument, typename Value>
+BoundedArray<Argument, 3> Hermite3<Argument, Value>::FindRoots() const {
+  return SolveCubicEquation<Argument, Value>(
+      arguments_.first, a0_, a1_, a2_, a3_);
+}
+
 template<typename Argument, typename Value>
 template<typename Samples>
 typename Normed<Difference<Value>>::NormType
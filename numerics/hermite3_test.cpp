@@ -69,6 +69,18 @@ TEST_F(Hermite3Test, Precomputed) {
                           t0_ + ((64.0 + sqrt(430.0)) / 39.0) * Second));
 }
 
+TEST_F(Hermite3Test, Roots) {
+  // The polynomial (t - 1.25 s) (t - 1.5 s) (t - 3 s) in m s^-3.
+  Hermite3<Instant, Length> h({t0_ + 1 * Second, t0_ + 2 * Second},
+                              {-0.25 * Metre, -0.375 * Metre},
+                              {1.625 * Metre / Second,
+                               -0.875 * Metre / Second});
+  EXPECT_THAT(h.FindRoots(),
+              ElementsAre(AlmostEquals(t0_ + 1.25 * Second, 0),
+                          AlmostEquals(t0_ + 1.5 * Second, 0),
+                          AlmostEquals(t0_ + 3 * Second, 0)));
+}
+
 TEST_F(Hermite3Test, Typed) {
   // Just here to check that the types work in the presence of affine spaces.
   Hermite3<Instant, Position<World>> h({t0_ + 1 * Second, t0_ + 2 * Second},
@@ -0,0 +1,106 @@
+﻿
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <variant>
+
+#include "absl/types/span.h"
+#include "base/macros.hpp"
+#include "base/not_null.hpp"
+#include "numerics/polynomial.hpp"
+#include "quantities/named_quantities.hpp"
+#include "serialization/numerics.pb.h"
+
+namespace principia {
+namespace numerics {
+namespace internal_inline_polynomial {
+
+using base::not_null;
+using quantities::Derivative;
+
+template<typename Value, typename Argument,
+         template<typename, typename, int> class Evaluator,
+         typename Degrees>
+struct InlinePolynomialAlternatives;
+
+template<typename Value, typename Argument,
+         template<typename, typename, int> class Evaluator,
+         int... degrees>
+struct InlinePolynomialAlternatives<Value, Argument, Evaluator,
+                                    std::integer_sequence<int, degrees...>> {
+  // The alternative at index d > 0 is the polynomial of degree d.
+  using Variant = std::variant<
+      not_null<std::unique_ptr<Polynomial<Value, Argument>>>,
+      PolynomialInMonomialBasis<Value, Argument, degrees + 1, Evaluator>...>;
+};
+
+// A polynomial whose degree is only known at runtime, like a
+// |Polynomial<Value, Argument>|, but which stores a
+// |PolynomialInMonomialBasis| of degree at most |max_degree| inline instead of
+// on the heap.  Evaluation dispatches on the degree with a switch and calls the
+// statically-typed polynomial directly, which avoids the virtual call and the
+// indirection to the coefficients.  Other polynomials are held by pointer and
+// evaluated through the virtual functions.  The price to pay is that the object
+// is as large as the polynomial of degree |max_degree|.
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+class InlinePolynomial final {
+  // 24 is the largest degree that |Polynomial::ReadFromMessage| supports.
+  static_assert(1 <= max_degree && max_degree <= 24,
+                "Unsupported maximum degree");
+
+ public:
+  template<int degree_>
+  InlinePolynomial(  // NOLINT(runtime/explicit)
+      PolynomialInMonomialBasis<Value, Argument, degree_, Evaluator> const&
+          polynomial);
+  explicit InlinePolynomial(
+      not_null<std::unique_ptr<Polynomial<Value, Argument>>> polynomial);
+
+  FORCE_INLINE(inline) Value Evaluate(Argument const& argument) const;
+  FORCE_INLINE(inline) Derivative<Value, Argument> EvaluateDerivative(
+      Argument const& argument) const;
+  FORCE_INLINE(inline) void EvaluateWithDerivative(
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative) const;
+  Derivative<Value, Argument, 2> EvaluateSecondDerivative(
+      Argument const& argument) const;
+
+  void Evaluate(absl::Span<Argument const> arguments,
+                absl::Span<Value> values) const;
+  void EvaluateDerivative(
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives) const;
+
+  int degree() const;
+
+  // True if the polynomial is stored inline.
+  bool is_inline() const;
+
+  void WriteToMessage(not_null<serialization::Polynomial*> message) const;
+  static InlinePolynomial ReadFromMessage(
+      serialization::Polynomial const& message);
+
+ private:
+  using Variant = typename InlinePolynomialAlternatives<
+      Value, Argument, Evaluator,
+      std::make_integer_sequence<int, max_degree>>::Variant;
+
+  // Calls |f| with the polynomial of the actual type if it is inline, and with
+  // a |Polynomial<Value, Argument>| otherwise.
+  template<typename F>
+  FORCE_INLINE(inline) decltype(auto) Visit(F&& f) const;
+
+  Variant polynomial_;
+};
+
+}  // namespace internal_inline_polynomial
+
+using internal_inline_polynomial::InlinePolynomial;
+
+}  // namespace numerics
+}  // namespace principia
+
+#include "numerics/inline_polynomial_body.hpp"
@@ -0,0 +1,217 @@
+﻿
+#pragma once
+
+#include "numerics/inline_polynomial.hpp"
+
+#include <utility>
+
+#include "glog/logging.h"
+
+namespace principia {
+namespace numerics {
+namespace internal_inline_polynomial {
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+template<int degree_>
+InlinePolynomial<Value, Argument, max_degree, Evaluator>::InlinePolynomial(
+    PolynomialInMonomialBasis<Value, Argument, degree_, Evaluator> const&
+        polynomial)
+    : polynomial_(std::in_place_index<degree_>, polynomial) {
+  static_assert(1 <= degree_ && degree_ <= max_degree,
+                "Degree cannot be stored inline");
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+InlinePolynomial<Value, Argument, max_degree, Evaluator>::InlinePolynomial(
+    not_null<std::unique_ptr<Polynomial<Value, Argument>>> polynomial)
+    : polynomial_(std::in_place_index<0>, std::move(polynomial)) {}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+Value InlinePolynomial<Value, Argument, max_degree, Evaluator>::Evaluate(
+    Argument const& argument) const {
+  return Visit([&argument](auto const& polynomial) {
+    return polynomial.Evaluate(argument);
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+Derivative<Value, Argument>
+InlinePolynomial<Value, Argument, max_degree, Evaluator>::EvaluateDerivative(
+    Argument const& argument) const {
+  return Visit([&argument](auto const& polynomial) {
+    return polynomial.EvaluateDerivative(argument);
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+void InlinePolynomial<Value, Argument, max_degree, Evaluator>::
+EvaluateWithDerivative(Argument const& argument,
+                       Value& value,
+                       Derivative<Value, Argument>& derivative) const {
+  Visit([&argument, &value, &derivative](auto const& polynomial) {
+    polynomial.EvaluateWithDerivative(argument, value, derivative);
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+Derivative<Value, Argument, 2>
+InlinePolynomial<Value, Argument, max_degree, Evaluator>::
+EvaluateSecondDerivative(Argument const& argument) const {
+  return Visit([&argument](auto const& polynomial) {
+    return polynomial.EvaluateSecondDerivative(argument);
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+void InlinePolynomial<Value, Argument, max_degree, Evaluator>::Evaluate(
+    absl::Span<Argument const> const arguments,
+    absl::Span<Value> const values) const {
+  Visit([arguments, values](auto const& polynomial) {
+    polynomial.Evaluate(arguments, values);
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+void InlinePolynomial<Value, Argument, max_degree, Evaluator>::
+EvaluateDerivative(
+    absl::Span<Argument const> const arguments,
+    absl::Span<Derivative<Value, Argument>> const derivatives) const {
+  Visit([arguments, derivatives](auto const& polynomial) {
+    polynomial.EvaluateDerivative(arguments, derivatives);
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+int InlinePolynomial<Value, Argument, max_degree, Evaluator>::degree() const {
+  return Visit([](auto const& polynomial) {
+    return polynomial.degree();
+  });
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+bool InlinePolynomial<Value, Argument, max_degree, Evaluator>::is_inline()
+    const {
+  return polynomial_.index() != 0;
+}
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+void InlinePolynomial<Value, Argument, max_degree, Evaluator>::WriteToMessage(
+    not_null<serialization::Polynomial*> const message) const {
+  Visit([message](auto const& polynomial) {
+    polynomial.WriteToMessage(message);
+  });
+}
+
+#define PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(value)                        \
+  case value:                                                               \
+    if constexpr (value <= max_degree) {                                    \
+      return InlinePolynomial(                                              \
+          PolynomialInMonomialBasis<Value, Argument, value, Evaluator>::    \
+              ReadFromMessage(message));                                    \
+    }                                                                       \
+    break
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+InlinePolynomial<Value, Argument, max_degree, Evaluator>
+InlinePolynomial<Value, Argument, max_degree, Evaluator>::ReadFromMessage(
+    serialization::Polynomial const& message) {
+  switch (message.degree()) {
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(1);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(2);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(3);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(4);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(5);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(6);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(7);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(8);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(9);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(10);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(11);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(12);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(13);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(14);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(15);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(16);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(17);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(18);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(19);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(20);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(21);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(22);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(23);
+    PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE(24);
+    default:
+      break;
+  }
+  // Too large to be stored inline.
+  return InlinePolynomial(
+      Polynomial<Value, Argument>::template ReadFromMessage<Evaluator>(
+          message));
+}
+
+#undef PRINCIPIA_INLINE_POLYNOMIAL_READ_CASE
+
+// We don't use |std::visit| because it is not guaranteed to compile to a jump
+// table.
+#define PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(value)           \
+  case value:                                                   \
+    if constexpr (value <= max_degree) {                        \
+      return f(*std::get_if<value>(&polynomial_));              \
+    }                                                           \
+    break
+
+template<typename Value, typename Argument, int max_degree,
+         template<typename, typename, int> class Evaluator>
+template<typename F>
+decltype(auto) InlinePolynomial<Value, Argument, max_degree, Evaluator>::Visit(
+    F&& f) const {
+  switch (polynomial_.index()) {
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(1);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(2);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(3);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(4);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(5);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(6);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(7);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(8);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(9);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(10);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(11);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(12);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(13);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(14);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(15);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(16);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(17);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(18);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(19);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(20);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(21);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(22);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(23);
+    PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE(24);
+    default:
+      break;
+  }
+  // The polynomial is not inline.
+  Polynomial<Value, Argument> const& polynomial = *std::get<0>(polynomial_);
+  return f(polynomial);
+}
+
+#undef PRINCIPIA_INLINE_POLYNOMIAL_VISIT_CASE
+
+}  // namespace internal_inline_polynomial
+}  // namespace numerics
+}  // namespace principia
@@ -0,0 +1,123 @@
+﻿
+#include "numerics/inline_polynomial.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "base/not_null.hpp"
+#include "geometry/frame.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/named_quantities.hpp"
+#include "gtest/gtest.h"
+#include "numerics/polynomial.hpp"
+#include "numerics/polynomial_evaluators.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/si.hpp"
+#include "serialization/geometry.pb.h"
+#include "serialization/numerics.pb.h"
+
+namespace principia {
+
+using base::make_not_null_unique;
+using geometry::Displacement;
+using geometry::Frame;
+using geometry::Handedness;
+using geometry::Inertial;
+using geometry::Instant;
+using geometry::Vector;
+using geometry::Velocity;
+using quantities::Acceleration;
+using quantities::Quotient;
+using quantities::Time;
+using quantities::si::Metre;
+using quantities::si::Second;
+
+namespace numerics {
+
+class InlinePolynomialTest : public ::testing::Test {
+ protected:
+  using World = Frame<serialization::Frame::TestTag,
+                      Inertial,
+                      Handedness::Right,
+                      serialization::Frame::TEST>;
+
+  using P3 = PolynomialInMonomialBasis<Displacement<World>, Instant, 3,
+                                       EstrinEvaluator>;
+  using IP2 = InlinePolynomial<Displacement<World>, Instant, /*max_degree=*/2,
+                               EstrinEvaluator>;
+  using IP3 = InlinePolynomial<Displacement<World>, Instant, /*max_degree=*/3,
+                               EstrinEvaluator>;
+
+  InlinePolynomialTest()
+      : polynomial_(
+            {Displacement<World>({0 * Metre, 0 * Metre, 1 * Metre}),
+             Velocity<World>(
+                 {0 * Metre / Second, 1 * Metre / Second, 0 * Metre / Second}),
+             Vector<Acceleration, World>({1 * Metre / Second / Second,
+                                          0 * Metre / Second / Second,
+                                          0 * Metre / Second / Second}),
+             Vector<Quotient<Acceleration, Time>, World>(
+                 {0 * Metre / Second / Second / Second,
+                  1 * Metre / Second / Second / Second,
+                  2 * Metre / Second / Second / Second})},
+            Instant() + 1 * Second) {}
+
+  // Checks that |inline_polynomial| behaves exactly like |polynomial_|.
+  template<typename IP>
+  void ExpectSameAsPolynomial(IP const& inline_polynomial) {
+    EXPECT_EQ(3, inline_polynomial.degree());
+    std::vector<Instant> times;
+    for (int i = 0; i < 10; ++i) {
+      Instant const t = Instant() + 0.3 * i * Second;
+      times.push_back(t);
+      EXPECT_EQ(polynomial_.Evaluate(t), inline_polynomial.Evaluate(t));
+      EXPECT_EQ(polynomial_.EvaluateDerivative(t),
+                inline_polynomial.EvaluateDerivative(t));
+      Displacement<World> value;
+      Velocity<World> derivative;
+      inline_polynomial.EvaluateWithDerivative(t, value, derivative);
+      EXPECT_EQ(polynomial_.Evaluate(t), value);
+      EXPECT_EQ(polynomial_.EvaluateDerivative(t), derivative);
+    }
+    std::vector<Displacement<World>> values(times.size());
+    std::vector<Velocity<World>> derivatives(times.size());
+    inline_polynomial.Evaluate(times, absl::MakeSpan(values));
+    inline_polynomial.EvaluateDerivative(times, absl::MakeSpan(derivatives));
+    for (int i = 0; i < times.size(); ++i) {
+      EXPECT_EQ(polynomial_.Evaluate(times[i]), values[i]);
+      EXPECT_EQ(polynomial_.EvaluateDerivative(times[i]), derivatives[i]);
+    }
+  }
+
+  P3 const polynomial_;
+};
+
+TEST_F(InlinePolynomialTest, Inline) {
+  IP3 const inline_polynomial(polynomial_);
+  EXPECT_TRUE(inline_polynomial.is_inline());
+  ExpectSameAsPolynomial(inline_polynomial);
+}
+
+TEST_F(InlinePolynomialTest, Pointer) {
+  IP2 const inline_polynomial(make_not_null_unique<P3>(polynomial_));
+  EXPECT_FALSE(inline_polynomial.is_inline());
+  ExpectSameAsPolynomial(inline_polynomial);
+}
+
+TEST_F(InlinePolynomialTest, Serialization) {
+  serialization::Polynomial message;
+  IP3(polynomial_).WriteToMessage(&message);
+  EXPECT_EQ(3, message.degree());
+
+  auto const ip3 = IP3::ReadFromMessage(message);
+  EXPECT_TRUE(ip3.is_inline());
+  ExpectSameAsPolynomial(ip3);
+
+  // The degree is too large for the polynomial to be stored inline.
+  auto const ip2 = IP2::ReadFromMessage(message);
+  EXPECT_FALSE(ip2.is_inline());
+  ExpectSameAsPolynomial(ip2);
+}
+
+}  // namespace numerics
+}  // namespace principia
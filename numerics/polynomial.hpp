@@ -5,6 +5,7 @@
 #include <tuple>
 #include <utility>
 
+#include "absl/types/span.h"
 #include "base/not_null.hpp"
 #include "geometry/point.hpp"
 #include "quantities/named_quantities.hpp"
@@ -41,6 +42,25 @@ class Polynomial {
   virtual Value Evaluate(Argument const& argument) const = 0;
   virtual Derivative<Value, Argument> EvaluateDerivative(
       Argument const& argument) const = 0;
+  // Equivalent to calling |Evaluate| and |EvaluateDerivative|, but may be
+  // faster.
+  virtual void EvaluateWithDerivative(
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative) const = 0;
+  virtual Derivative<Value, Argument, 2> EvaluateSecondDerivative(
+      Argument const& argument) const = 0;
+
+  // Equivalent to calling |Evaluate| (resp. |EvaluateDerivative|) for each
+  // element of |arguments| and storing the results in the corresponding
+  // elements of |values| (resp. |derivatives|), which must have the same size.
+  // Faster because there is a single virtual call and the evaluation may be
+  // vectorized across arguments.
+  virtual void Evaluate(absl::Span<Argument const> arguments,
+                        absl::Span<Value> values) const = 0;
+  virtual void EvaluateDerivative(
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives) const = 0;
 
   // Only useful for benchmarking or analyzing performance.  Do not use in real
   // code.
@@ -74,6 +94,18 @@ class PolynomialInMonomialBasis : public Polynomial<Value, Argument> {
   Evaluate(Argument const& argument) const override;
   FORCE_INLINE(inline) Derivative<Value, Argument>
   EvaluateDerivative(Argument const& argument) const override;
+  FORCE_INLINE(inline) void EvaluateWithDerivative(
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative) const override;
+  Derivative<Value, Argument, 2> EvaluateSecondDerivative(
+      Argument const& argument) const override;
+
+  void Evaluate(absl::Span<Argument const> arguments,
+                absl::Span<Value> values) const override;
+  void EvaluateDerivative(
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives) const override;
 
   constexpr int degree() const override;
 
@@ -147,6 +179,18 @@ class PolynomialInMonomialBasis<Value, Point<Argument>, degree_, Evaluator>
   Evaluate(Point<Argument> const& argument) const override;
   FORCE_INLINE(inline) Derivative<Value, Argument>
   EvaluateDerivative(Point<Argument> const& argument) const override;
+  FORCE_INLINE(inline) void EvaluateWithDerivative(
+      Point<Argument> const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative) const override;
+  Derivative<Value, Argument, 2> EvaluateSecondDerivative(
+      Point<Argument> const& argument) const override;
+
+  void Evaluate(absl::Span<Point<Argument> const> arguments,
+                absl::Span<Value> values) const override;
+  void EvaluateDerivative(
+      absl::Span<Point<Argument> const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives) const override;
 
   constexpr int degree() const override;
 
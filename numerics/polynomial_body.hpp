@@ -3,12 +3,15 @@
 #include "numerics/polynomial.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <tuple>
 #include <utility>
 
 #include "base/not_constructible.hpp"
 #include "geometry/cartesian_product.hpp"
 #include "geometry/serialization.hpp"
+#include "glog/logging.h"
 #include "numerics/combinatorics.hpp"
 
 namespace principia {
@@ -25,6 +28,10 @@ using geometry::cartesian_product::operator/;
 using geometry::polynomial_ring::operator*;
 using quantities::Apply;
 
+// The arguments of the polynomials based on a |Point| are shifted by the origin
+// in chunks of this size by the overloads taking spans, to avoid allocating.
+constexpr std::size_t shifted_arguments_size = 64;
+
 template<typename Tuple, int order,
          typename = std::make_index_sequence<std::tuple_size_v<Tuple> - order>>
 struct TupleDerivation;
@@ -164,6 +171,56 @@ EvaluateDerivative(Argument const& argument) const {
       coefficients_, argument);
 }
 
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+void PolynomialInMonomialBasis<Value, Argument, degree_, Evaluator>::
+EvaluateWithDerivative(Argument const& argument,
+                       Value& value,
+                       quantities::Derivative<Value, Argument>& derivative)
+    const {
+  Evaluator<Value, Argument, degree_>::EvaluateWithDerivative(
+      coefficients_, argument, value, derivative);
+}
+
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+Derivative<Value, Argument, 2>
+PolynomialInMonomialBasis<Value, Argument, degree_, Evaluator>::
+EvaluateSecondDerivative(Argument const& argument) const {
+  if constexpr (degree_ < 2) {
+    return quantities::Derivative<Value, Argument, 2>{};
+  } else {
+    // The second derivative is the derivative of the first derivative, whose
+    // degree is at least 1.
+    return Evaluator<quantities::Derivative<Value, Argument>,
+                     Argument,
+                     degree_ - 1>::
+        EvaluateDerivative(
+            TupleDerivation<Coefficients, 1>::Derive(coefficients_),
+            argument);
+  }
+}
+
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+void PolynomialInMonomialBasis<Value, Argument, degree_, Evaluator>::Evaluate(
+    absl::Span<Argument const> const arguments,
+    absl::Span<Value> const values) const {
+  Evaluator<Value, Argument, degree_>::Evaluate(
+      coefficients_, arguments, values);
+}
+
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+void PolynomialInMonomialBasis<Value, Argument, degree_, Evaluator>::
+EvaluateDerivative(
+    absl::Span<Argument const> const arguments,
+    absl::Span<quantities::Derivative<Value, Argument>> const derivatives)
+    const {
+  Evaluator<Value, Argument, degree_>::EvaluateDerivative(
+      coefficients_, arguments, derivatives);
+}
+
 template<typename Value, typename Argument, int degree_,
          template<typename, typename, int> class Evaluator>
 constexpr int
@@ -240,6 +297,78 @@ EvaluateDerivative(Point<Argument> const& argument) const {
       coefficients_, argument - origin_);
 }
 
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+void PolynomialInMonomialBasis<Value, Point<Argument>, degree_, Evaluator>::
+EvaluateWithDerivative(Point<Argument> const& argument,
+                       Value& value,
+                       quantities::Derivative<Value, Argument>& derivative)
+    const {
+  Evaluator<Value, Argument, degree_>::EvaluateWithDerivative(
+      coefficients_, argument - origin_, value, derivative);
+}
+
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+Derivative<Value, Argument, 2>
+PolynomialInMonomialBasis<Value, Point<Argument>, degree_, Evaluator>::
+EvaluateSecondDerivative(Point<Argument> const& argument) const {
+  if constexpr (degree_ < 2) {
+    return quantities::Derivative<Value, Argument, 2>{};
+  } else {
+    return Evaluator<quantities::Derivative<Value, Argument>,
+                     Argument,
+                     degree_ - 1>::
+        EvaluateDerivative(
+            TupleDerivation<Coefficients, 1>::Derive(coefficients_),
+            argument - origin_);
+  }
+}
+
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+void PolynomialInMonomialBasis<Value, Point<Argument>, degree_, Evaluator>::
+Evaluate(absl::Span<Point<Argument> const> const arguments,
+         absl::Span<Value> const values) const {
+  CHECK_EQ(arguments.size(), values.size());
+  std::array<Argument, shifted_arguments_size> shifted_arguments;
+  for (std::size_t i = 0; i < arguments.size();
+       i += shifted_arguments_size) {
+    std::size_t const size =
+        std::min(shifted_arguments_size, arguments.size() - i);
+    for (std::size_t j = 0; j < size; ++j) {
+      shifted_arguments[j] = arguments[i + j] - origin_;
+    }
+    Evaluator<Value, Argument, degree_>::Evaluate(
+        coefficients_,
+        absl::MakeConstSpan(shifted_arguments.data(), size),
+        values.subspan(i, size));
+  }
+}
+
+template<typename Value, typename Argument, int degree_,
+         template<typename, typename, int> class Evaluator>
+void PolynomialInMonomialBasis<Value, Point<Argument>, degree_, Evaluator>::
+EvaluateDerivative(
+    absl::Span<Point<Argument> const> const arguments,
+    absl::Span<quantities::Derivative<Value, Argument>> const derivatives)
+    const {
+  CHECK_EQ(arguments.size(), derivatives.size());
+  std::array<Argument, shifted_arguments_size> shifted_arguments;
+  for (std::size_t i = 0; i < arguments.size();
+       i += shifted_arguments_size) {
+    std::size_t const size =
+        std::min(shifted_arguments_size, arguments.size() - i);
+    for (std::size_t j = 0; j < size; ++j) {
+      shifted_arguments[j] = arguments[i + j] - origin_;
+    }
+    Evaluator<Value, Argument, degree_>::EvaluateDerivative(
+        coefficients_,
+        absl::MakeConstSpan(shifted_arguments.data(), size),
+        derivatives.subspan(i, size));
+  }
+}
+
 template<typename Value, typename Argument, int degree_,
          template<typename, typename, int> class Evaluator>
 constexpr int
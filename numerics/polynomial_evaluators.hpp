@@ -1,6 +1,8 @@
 #pragma once
 
+#include "absl/types/span.h"
 #include "base/macros.hpp"
+#include "geometry/grassmann.hpp"
 #include "numerics/polynomial.hpp"
 #include "quantities/quantities.hpp"
 
@@ -8,6 +10,7 @@ namespace principia {
 namespace numerics {
 namespace internal_polynomial_evaluators {
 
+using geometry::Multivector;
 using quantities::Derivative;
 using quantities::Square;
 
@@ -32,6 +35,59 @@ struct EstrinEvaluator {
   FORCE_INLINE(static) Derivative<Value, Argument>
   EvaluateDerivative(Coefficients const& coefficients,
                      Argument const& argument);
+  FORCE_INLINE(static) void EvaluateWithDerivative(
+      Coefficients const& coefficients,
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative);
+
+  // Evaluates the polynomial at each element of |arguments| and stores the
+  // results in the corresponding elements of |values| (resp. |derivatives|),
+  // which must have the same size.  The results are bitwise identical to those
+  // of the functions taking a single argument.
+  static void Evaluate(Coefficients const& coefficients,
+                       absl::Span<Argument const> arguments,
+                       absl::Span<Value> values);
+  static void EvaluateDerivative(
+      Coefficients const& coefficients,
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives);
+};
+
+// Specialization for polynomials whose values are 3-vectors, e.g.,
+// |Displacement|.  The coordinates of each coefficient are kept in a single
+// SIMD register (two without AVX), and |EvaluateWithDerivative| computes the
+// value and the derivative in a single pass.  Without FMA the results are
+// bitwise identical to those of the general case.  The overloads taking spans
+// load the coefficients only once.  The released binaries don't target AVX, so
+// they use the SSE2 code; see |PRINCIPIA_USE_AVX_INTRINSICS|.
+template<typename Scalar, typename Frame, typename Argument, int degree>
+struct EstrinEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree> {
+  using Value = Multivector<Scalar, Frame, 1>;
+  using Coefficients = typename PolynomialInMonomialBasis<
+      Value,
+      Argument,
+      degree,
+      internal_polynomial_evaluators::EstrinEvaluator>::Coefficients;
+
+  FORCE_INLINE(static) Value Evaluate(Coefficients const& coefficients,
+                                      Argument const& argument);
+  FORCE_INLINE(static) Derivative<Value, Argument>
+  EvaluateDerivative(Coefficients const& coefficients,
+                     Argument const& argument);
+  FORCE_INLINE(static) void EvaluateWithDerivative(
+      Coefficients const& coefficients,
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative);
+
+  static void Evaluate(Coefficients const& coefficients,
+                       absl::Span<Argument const> arguments,
+                       absl::Span<Value> values);
+  static void EvaluateDerivative(
+      Coefficients const& coefficients,
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives);
 };
 
 template<typename Value, typename Argument, int degree>
@@ -49,6 +105,49 @@ struct HornerEvaluator {
   FORCE_INLINE(static) Derivative<Value, Argument>
   EvaluateDerivative(Coefficients const& coefficients,
                      Argument const& argument);
+  FORCE_INLINE(static) void EvaluateWithDerivative(
+      Coefficients const& coefficients,
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative);
+
+  static void Evaluate(Coefficients const& coefficients,
+                       absl::Span<Argument const> arguments,
+                       absl::Span<Value> values);
+  static void EvaluateDerivative(
+      Coefficients const& coefficients,
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives);
+};
+
+// Same as the specialization of |EstrinEvaluator|, for Horner's scheme.
+template<typename Scalar, typename Frame, typename Argument, int degree>
+struct HornerEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree> {
+  using Value = Multivector<Scalar, Frame, 1>;
+  using Coefficients = typename PolynomialInMonomialBasis<
+      Value,
+      Argument,
+      degree,
+      internal_polynomial_evaluators::HornerEvaluator>::Coefficients;
+
+  FORCE_INLINE(static) Value Evaluate(Coefficients const& coefficients,
+                                      Argument const& argument);
+  FORCE_INLINE(static) Derivative<Value, Argument>
+  EvaluateDerivative(Coefficients const& coefficients,
+                     Argument const& argument);
+  FORCE_INLINE(static) void EvaluateWithDerivative(
+      Coefficients const& coefficients,
+      Argument const& argument,
+      Value& value,
+      Derivative<Value, Argument>& derivative);
+
+  static void Evaluate(Coefficients const& coefficients,
+                       absl::Span<Argument const> arguments,
+                       absl::Span<Value> values);
+  static void EvaluateDerivative(
+      Coefficients const& coefficients,
+      absl::Span<Argument const> arguments,
+      absl::Span<Derivative<Value, Argument>> derivatives);
 };
 
 }  // namespace internal_polynomial_evaluators
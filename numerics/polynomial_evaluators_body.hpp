@@ -2,13 +2,30 @@
 
 #include "numerics/polynomial_evaluators.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <tuple>
+#include <utility>
+
+#include "geometry/r3_element.hpp"
+#include "glog/logging.h"
+#include "numerics/r3_element_lanes.hpp"
 
 namespace principia {
 namespace numerics {
 namespace internal_polynomial_evaluators {
 
+using geometry::R3Element;
+using internal_r3_element_lanes::Broadcast;
+using internal_r3_element_lanes::Lanes;
+using internal_r3_element_lanes::Load;
+using internal_r3_element_lanes::MakeBroadcast;
+using internal_r3_element_lanes::Multiply;
+using internal_r3_element_lanes::MultiplyAdd;
+using internal_r3_element_lanes::Store;
+using quantities::SIUnit;
+
 namespace {
 
 // Greatest power of 2 less than or equal to n.  8 -> 8, 7 -> 4.
@@ -243,6 +260,45 @@ EstrinEvaluator<Value, Argument, degree>::EvaluateDerivative(
   }
 }
 
+template<typename Value, typename Argument, int degree>
+inline void EstrinEvaluator<Value, Argument, degree>::EvaluateWithDerivative(
+    Coefficients const& coefficients,
+    Argument const& argument,
+    Value& value,
+    Derivative<Value, Argument>& derivative) {
+  value = Evaluate(coefficients, argument);
+  derivative = EvaluateDerivative(coefficients, argument);
+}
+
+template<typename Value, typename Argument, int degree>
+void EstrinEvaluator<Value, Argument, degree>::Evaluate(
+    Coefficients const& coefficients,
+    absl::Span<Argument const> const arguments,
+    absl::Span<Value> const values) {
+  CHECK_EQ(arguments.size(), values.size());
+  // The iterations are independent, so the compiler may vectorize this loop.
+  std::transform(arguments.begin(),
+                 arguments.end(),
+                 values.begin(),
+                 [&coefficients](Argument const& argument) {
+                   return Evaluate(coefficients, argument);
+                 });
+}
+
+template<typename Value, typename Argument, int degree>
+void EstrinEvaluator<Value, Argument, degree>::EvaluateDerivative(
+    Coefficients const& coefficients,
+    absl::Span<Argument const> const arguments,
+    absl::Span<Derivative<Value, Argument>> const derivatives) {
+  CHECK_EQ(arguments.size(), derivatives.size());
+  std::transform(arguments.begin(),
+                 arguments.end(),
+                 derivatives.begin(),
+                 [&coefficients](Argument const& argument) {
+                   return EvaluateDerivative(coefficients, argument);
+                 });
+}
+
 // Internal helper for Horner evaluation.  |degree| is the degree of the overall
 // polynomial, |low| defines the subpolynomial that we currently evaluate, i.e.,
 // the one with a constant term coefficient |std::get<low>(coefficients)|.
@@ -333,6 +389,302 @@ HornerEvaluator<Value, Argument, degree>::EvaluateDerivative(
   }
 }
 
+template<typename Value, typename Argument, int degree>
+inline void HornerEvaluator<Value, Argument, degree>::EvaluateWithDerivative(
+    Coefficients const& coefficients,
+    Argument const& argument,
+    Value& value,
+    Derivative<Value, Argument>& derivative) {
+  value = Evaluate(coefficients, argument);
+  derivative = EvaluateDerivative(coefficients, argument);
+}
+
+template<typename Value, typename Argument, int degree>
+void HornerEvaluator<Value, Argument, degree>::Evaluate(
+    Coefficients const& coefficients,
+    absl::Span<Argument const> const arguments,
+    absl::Span<Value> const values) {
+  CHECK_EQ(arguments.size(), values.size());
+  // The iterations are independent, so the compiler may vectorize this loop.
+  std::transform(arguments.begin(),
+                 arguments.end(),
+                 values.begin(),
+                 [&coefficients](Argument const& argument) {
+                   return Evaluate(coefficients, argument);
+                 });
+}
+
+template<typename Value, typename Argument, int degree>
+void HornerEvaluator<Value, Argument, degree>::EvaluateDerivative(
+    Coefficients const& coefficients,
+    absl::Span<Argument const> const arguments,
+    absl::Span<Derivative<Value, Argument>> const derivatives) {
+  CHECK_EQ(arguments.size(), derivatives.size());
+  std::transform(arguments.begin(),
+                 arguments.end(),
+                 derivatives.begin(),
+                 [&coefficients](Argument const& argument) {
+                   return EvaluateDerivative(coefficients, argument);
+                 });
+}
+
+template<typename Coefficients, std::size_t... k>
+FORCE_INLINE(inline) std::array<Lanes, sizeof...(k)> LoadCoefficients(
+    Coefficients const& coefficients,
+    std::index_sequence<k...>) {
+  return {Load(std::get<k>(coefficients).coordinates())...};
+}
+
+// Returns x², x⁴, x⁸... computed as in |SquaresGenerator|.
+template<int size>
+FORCE_INLINE(inline) std::array<Broadcast, size> BroadcastSquares(
+    double const x) {
+  std::array<Broadcast, size> result;
+  double square = x;
+  for (int i = 0; i < size; ++i) {
+    square *= square;
+    result[i] = MakeBroadcast(square);
+  }
+  return result;
+}
+
+// The SIMD counterparts of |InternalEstrinEvaluator::Evaluate| and
+// |InternalEstrinEvaluator::EvaluateDerivative|.
+template<int low, int subdegree, std::size_t size, std::size_t squares>
+FORCE_INLINE(inline) Lanes EstrinValue(
+    std::array<Lanes, size> const& coefficients,
+    double const x,
+    std::array<Broadcast, squares> const& x_squares) {
+  if constexpr (subdegree == 0) {
+    return coefficients[low];
+  } else if constexpr (subdegree == 1) {
+    return MultiplyAdd(
+        coefficients[low + 1], MakeBroadcast(x), coefficients[low]);
+  } else {
+    constexpr int n = CeilingLog2(subdegree) - 1;
+    constexpr int m = FloorOfPowerOf2(subdegree);
+    return MultiplyAdd(
+        EstrinValue<low + m, subdegree - m>(coefficients, x, x_squares),
+        x_squares[n],
+        EstrinValue<low, m - 1>(coefficients, x, x_squares));
+  }
+}
+
+template<int low, int subdegree, std::size_t size, std::size_t squares>
+FORCE_INLINE(inline) Lanes EstrinDerivative(
+    std::array<Lanes, size> const& coefficients,
+    double const x,
+    std::array<Broadcast, squares> const& x_squares) {
+  if constexpr (subdegree == 0) {
+    return Multiply(coefficients[low], MakeBroadcast(low));
+  } else if constexpr (subdegree == 1) {
+    return MultiplyAdd(coefficients[low + 1],
+                       MakeBroadcast(x * (low + 1)),
+                       Multiply(coefficients[low], MakeBroadcast(low)));
+  } else {
+    constexpr int n = CeilingLog2(subdegree) - 1;
+    constexpr int m = FloorOfPowerOf2(subdegree);
+    return MultiplyAdd(
+        EstrinDerivative<low + m, subdegree - m>(coefficients, x, x_squares),
+        x_squares[n],
+        EstrinDerivative<low, m - 1>(coefficients, x, x_squares));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+inline auto EstrinEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+Evaluate(Coefficients const& coefficients,
+         Argument const& argument) -> Value {
+  double const x = argument / SIUnit<Argument>();
+  auto const lanes = LoadCoefficients(
+      coefficients, std::make_index_sequence<degree + 1>());
+  auto const x_squares = BroadcastSquares<CeilingLog2(degree)>(x);
+  return Value(Store<Scalar>(
+      EstrinValue</*low=*/0, /*subdegree=*/degree>(lanes, x, x_squares)));
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+inline auto EstrinEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+EvaluateDerivative(Coefficients const& coefficients,
+                   Argument const& argument) -> Derivative<Value, Argument> {
+  if constexpr (degree == 0) {
+    return Derivative<Value, Argument>{};
+  } else {
+    double const x = argument / SIUnit<Argument>();
+    auto const lanes = LoadCoefficients(
+        coefficients, std::make_index_sequence<degree + 1>());
+    auto const x_squares = BroadcastSquares<CeilingLog2(degree)>(x);
+    return Derivative<Value, Argument>(
+        Store<Derivative<Scalar, Argument>>(
+            EstrinDerivative</*low=*/1, /*subdegree=*/degree - 1>(
+                lanes, x, x_squares)));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+inline void EstrinEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+EvaluateWithDerivative(Coefficients const& coefficients,
+                       Argument const& argument,
+                       Value& value,
+                       Derivative<Value, Argument>& derivative) {
+  double const x = argument / SIUnit<Argument>();
+  auto const lanes = LoadCoefficients(
+      coefficients, std::make_index_sequence<degree + 1>());
+  auto const x_squares = BroadcastSquares<CeilingLog2(degree)>(x);
+  value = Value(Store<Scalar>(
+      EstrinValue</*low=*/0, /*subdegree=*/degree>(lanes, x, x_squares)));
+  if constexpr (degree == 0) {
+    derivative = Derivative<Value, Argument>{};
+  } else {
+    derivative = Derivative<Value, Argument>(
+        Store<Derivative<Scalar, Argument>>(
+            EstrinDerivative</*low=*/1, /*subdegree=*/degree - 1>(
+                lanes, x, x_squares)));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+void EstrinEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+Evaluate(Coefficients const& coefficients,
+         absl::Span<Argument const> const arguments,
+         absl::Span<Value> const values) {
+  CHECK_EQ(arguments.size(), values.size());
+  auto const lanes = LoadCoefficients(
+      coefficients, std::make_index_sequence<degree + 1>());
+  for (std::size_t i = 0; i < arguments.size(); ++i) {
+    double const x = arguments[i] / SIUnit<Argument>();
+    auto const x_squares = BroadcastSquares<CeilingLog2(degree)>(x);
+    values[i] = Value(Store<Scalar>(
+        EstrinValue</*low=*/0, /*subdegree=*/degree>(lanes, x, x_squares)));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+void EstrinEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+EvaluateDerivative(Coefficients const& coefficients,
+                   absl::Span<Argument const> const arguments,
+                   absl::Span<Derivative<Value, Argument>> const derivatives) {
+  CHECK_EQ(arguments.size(), derivatives.size());
+  if constexpr (degree == 0) {
+    std::fill(derivatives.begin(), derivatives.end(),
+              Derivative<Value, Argument>{});
+  } else {
+    auto const lanes = LoadCoefficients(
+        coefficients, std::make_index_sequence<degree + 1>());
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+      double const x = arguments[i] / SIUnit<Argument>();
+      auto const x_squares = BroadcastSquares<CeilingLog2(degree)>(x);
+      derivatives[i] = Derivative<Value, Argument>(
+          Store<Derivative<Scalar, Argument>>(
+              EstrinDerivative</*low=*/1, /*subdegree=*/degree - 1>(
+                  lanes, x, x_squares)));
+    }
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+inline auto HornerEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+Evaluate(Coefficients const& coefficients,
+         Argument const& argument) -> Value {
+  Broadcast const x = MakeBroadcast(argument / SIUnit<Argument>());
+  auto const lanes = LoadCoefficients(
+      coefficients, std::make_index_sequence<degree + 1>());
+  Lanes result = lanes[degree];
+  for (int k = degree - 1; k >= 0; --k) {
+    result = MultiplyAdd(result, x, lanes[k]);
+  }
+  return Value(Store<Scalar>(result));
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+inline auto HornerEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+EvaluateDerivative(Coefficients const& coefficients,
+                   Argument const& argument) -> Derivative<Value, Argument> {
+  if constexpr (degree == 0) {
+    return Derivative<Value, Argument>{};
+  } else {
+    Broadcast const x = MakeBroadcast(argument / SIUnit<Argument>());
+    auto const lanes = LoadCoefficients(
+        coefficients, std::make_index_sequence<degree + 1>());
+    Lanes result = Multiply(lanes[degree], MakeBroadcast(degree));
+    for (int k = degree - 1; k >= 1; --k) {
+      result = MultiplyAdd(result, x, Multiply(lanes[k], MakeBroadcast(k)));
+    }
+    return Derivative<Value, Argument>(
+        Store<Derivative<Scalar, Argument>>(result));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+inline void HornerEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+EvaluateWithDerivative(Coefficients const& coefficients,
+                       Argument const& argument,
+                       Value& value,
+                       Derivative<Value, Argument>& derivative) {
+  if constexpr (degree == 0) {
+    value = Evaluate(coefficients, argument);
+    derivative = Derivative<Value, Argument>{};
+  } else {
+    // The two Horner chains are independent, so they can be interleaved.
+    Broadcast const x = MakeBroadcast(argument / SIUnit<Argument>());
+    auto const lanes = LoadCoefficients(
+        coefficients, std::make_index_sequence<degree + 1>());
+    Lanes value_lanes = lanes[degree];
+    Lanes derivative_lanes = Multiply(lanes[degree], MakeBroadcast(degree));
+    for (int k = degree - 1; k >= 1; --k) {
+      value_lanes = MultiplyAdd(value_lanes, x, lanes[k]);
+      derivative_lanes = MultiplyAdd(
+          derivative_lanes, x, Multiply(lanes[k], MakeBroadcast(k)));
+    }
+    value_lanes = MultiplyAdd(value_lanes, x, lanes[0]);
+    value = Value(Store<Scalar>(value_lanes));
+    derivative = Derivative<Value, Argument>(
+        Store<Derivative<Scalar, Argument>>(derivative_lanes));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+void HornerEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+Evaluate(Coefficients const& coefficients,
+         absl::Span<Argument const> const arguments,
+         absl::Span<Value> const values) {
+  CHECK_EQ(arguments.size(), values.size());
+  auto const lanes = LoadCoefficients(
+      coefficients, std::make_index_sequence<degree + 1>());
+  for (std::size_t i = 0; i < arguments.size(); ++i) {
+    Broadcast const x = MakeBroadcast(arguments[i] / SIUnit<Argument>());
+    Lanes result = lanes[degree];
+    for (int k = degree - 1; k >= 0; --k) {
+      result = MultiplyAdd(result, x, lanes[k]);
+    }
+    values[i] = Value(Store<Scalar>(result));
+  }
+}
+
+template<typename Scalar, typename Frame, typename Argument, int degree>
+void HornerEvaluator<Multivector<Scalar, Frame, 1>, Argument, degree>::
+EvaluateDerivative(Coefficients const& coefficients,
+                   absl::Span<Argument const> const arguments,
+                   absl::Span<Derivative<Value, Argument>> const derivatives) {
+  CHECK_EQ(arguments.size(), derivatives.size());
+  if constexpr (degree == 0) {
+    std::fill(derivatives.begin(), derivatives.end(),
+              Derivative<Value, Argument>{});
+  } else {
+    auto const lanes = LoadCoefficients(
+        coefficients, std::make_index_sequence<degree + 1>());
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+      Broadcast const x = MakeBroadcast(arguments[i] / SIUnit<Argument>());
+      Lanes result = Multiply(lanes[degree], MakeBroadcast(degree));
+      for (int k = degree - 1; k >= 1; --k) {
+        result = MultiplyAdd(result, x, Multiply(lanes[k], MakeBroadcast(k)));
+      }
+      derivatives[i] = Derivative<Value, Argument>(
+          Store<Derivative<Scalar, Argument>>(result));
+    }
+  }
+}
+
 }  // namespace internal_polynomial_evaluators
 }  // namespace numerics
 }  // namespace principia
@@ -2,21 +2,49 @@
 #include "numerics/polynomial_evaluators.hpp"
 
 #include <cstddef>
+#include <tuple>
 #include <utility>
+#include <vector>
 
+#include "geometry/frame.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/r3_element.hpp"
 #include "gtest/gtest.h"
 #include "numerics/combinatorics.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/si.hpp"
 
 namespace principia {
+
+using geometry::Displacement;
+using geometry::Frame;
+using geometry::Inertial;
+using geometry::R3Element;
+using quantities::Derivative;
+using quantities::Pow;
+using quantities::Time;
+using quantities::si::Metre;
+using quantities::si::Second;
+
 namespace numerics {
 
 class PolynomialEvaluatorTest : public ::testing::Test {
  public:
+  using World = Frame<enum class WorldTag, Inertial>;
+
   template<typename Tuple, int n, std::size_t... k>
   Tuple MakeBinomialTuple(std::index_sequence<k...>) {
     return {Binomial(n, k)...};
   }
 
+  // The coordinates are the binomial coefficients multiplied by 1, 2 and -3.
+  template<typename Tuple, int n, std::size_t... k>
+  Tuple MakeBinomialVectorTuple(std::index_sequence<k...>) {
+    return {Binomial(n, k) *
+            Displacement<World>(R3Element<double>(1, 2, -3) * Metre) /
+            Pow<k>(Second)...};
+  }
+
   // This test builds the binomial polynomial (1 + x)^degree and evaluates it
   // using the |Evaluator| and directly using |std::pow|.
   template<template<typename Value, typename Argument, int degree>
@@ -34,6 +62,73 @@ class PolynomialEvaluatorTest : public ::testing::Test {
                 degree * std::pow(argument + 1, degree - 1))
           << argument << " " << degree;
     }
+
+    // The overloads taking spans give the same results.
+    std::vector<double> arguments;
+    for (int argument = -degree; argument <= degree; ++argument) {
+      arguments.push_back(argument);
+    }
+    std::vector<double> values(arguments.size());
+    std::vector<double> derivatives(arguments.size());
+    E::Evaluate(binomial_coefficients, arguments, absl::MakeSpan(values));
+    E::EvaluateDerivative(
+        binomial_coefficients, arguments, absl::MakeSpan(derivatives));
+    for (int i = 0; i < arguments.size(); ++i) {
+      EXPECT_EQ(E::Evaluate(binomial_coefficients, arguments[i]), values[i])
+          << arguments[i] << " " << degree;
+      EXPECT_EQ(E::EvaluateDerivative(binomial_coefficients, arguments[i]),
+                derivatives[i])
+          << arguments[i] << " " << degree;
+    }
+  }
+
+  // Same as above for |Displacement| values, which use the specializations for
+  // 3-vectors.
+  template<template<typename Value, typename Argument, int degree>
+           class Evaluator,
+           int degree>
+  void VectorTest() {
+    using E = Evaluator<Displacement<World>, Time, degree>;
+    auto const binomial_coefficients =
+        MakeBinomialVectorTuple<typename E::Coefficients, degree>(
+            std::make_index_sequence<degree + 1>());
+    for (int argument = -degree; argument <= degree; ++argument) {
+      Time const t = argument * Second;
+      Displacement<World> const expected_value(
+          std::pow(argument + 1, degree) * R3Element<double>(1, 2, -3) *
+          Metre);
+      auto const expected_derivative =
+          degree * std::pow(argument + 1, degree - 1) *
+          Displacement<World>(R3Element<double>(1, 2, -3) * Metre) / Second;
+      EXPECT_EQ(expected_value, E::Evaluate(binomial_coefficients, t))
+          << argument << " " << degree;
+      EXPECT_EQ(expected_derivative,
+                E::EvaluateDerivative(binomial_coefficients, t))
+          << argument << " " << degree;
+      Displacement<World> value;
+      Derivative<Displacement<World>, Time> derivative;
+      E::EvaluateWithDerivative(binomial_coefficients, t, value, derivative);
+      EXPECT_EQ(expected_value, value) << argument << " " << degree;
+      EXPECT_EQ(expected_derivative, derivative) << argument << " " << degree;
+    }
+
+    std::vector<Time> arguments;
+    for (int argument = -degree; argument <= degree; ++argument) {
+      arguments.push_back(argument * Second);
+    }
+    std::vector<Displacement<World>> values(arguments.size());
+    std::vector<Derivative<Displacement<World>, Time>> derivatives(
+        arguments.size());
+    E::Evaluate(binomial_coefficients, arguments, absl::MakeSpan(values));
+    E::EvaluateDerivative(
+        binomial_coefficients, arguments, absl::MakeSpan(derivatives));
+    for (int i = 0; i < arguments.size(); ++i) {
+      EXPECT_EQ(E::Evaluate(binomial_coefficients, arguments[i]), values[i])
+          << arguments[i] << " " << degree;
+      EXPECT_EQ(E::EvaluateDerivative(binomial_coefficients, arguments[i]),
+                derivatives[i])
+          << arguments[i] << " " << degree;
+    }
   }
 };
 
@@ -71,5 +166,18 @@ TEST_F(PolynomialEvaluatorTest, Horner) {
   Test<HornerEvaluator, 14>();
 }
 
+TEST_F(PolynomialEvaluatorTest, Vector) {
+  VectorTest<EstrinEvaluator, 0>();
+  VectorTest<EstrinEvaluator, 1>();
+  VectorTest<EstrinEvaluator, 2>();
+  VectorTest<EstrinEvaluator, 7>();
+  VectorTest<EstrinEvaluator, 10>();
+  VectorTest<HornerEvaluator, 0>();
+  VectorTest<HornerEvaluator, 1>();
+  VectorTest<HornerEvaluator, 2>();
+  VectorTest<HornerEvaluator, 7>();
+  VectorTest<HornerEvaluator, 10>();
+}
+
 }  // namespace numerics
 }  // namespace principia
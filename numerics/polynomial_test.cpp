@@ -133,12 +133,18 @@ TEST_F(PolynomialTest, Evaluate2A) {
   EXPECT_EQ(2, p.degree());
   Displacement<World> const d = p.Evaluate(t0 + 0.5 * Second);
   Velocity<World> const v = p.EvaluateDerivative(t0 + 0.5 * Second);
+  Vector<Acceleration, World> const a =
+      p.EvaluateSecondDerivative(t0 + 0.5 * Second);
   EXPECT_THAT(d, AlmostEquals(Displacement<World>({0.25 * Metre,
                                                    0.5 * Metre,
                                                    1 * Metre}), 0));
   EXPECT_THAT(v, AlmostEquals(Velocity<World>({1 * Metre / Second,
                                                1 * Metre / Second,
                                                0 * Metre / Second}), 0));
+  EXPECT_THAT(a, AlmostEquals(Vector<Acceleration, World>(
+                                  {2 * Metre / Second / Second,
+                                   0 * Metre / Second / Second,
+                                   0 * Metre / Second / Second}), 0));
 }
 
 // Check that a polynomial of high order may be declared.
@@ -242,6 +248,11 @@ TEST_F(PolynomialTest, Derivative) {
             p3.Derivative<2>().Evaluate(0 * Second));
   EXPECT_EQ(6 * Ampere / Second / Second / Second,
             p3.Derivative<3>().Evaluate(0 * Second));
+
+  EXPECT_EQ(-16 * Kelvin / Second / Second,
+            p2.EvaluateSecondDerivative(2 * Second));
+  EXPECT_EQ(18 * Ampere / Second / Second,
+            p3.EvaluateSecondDerivative(2 * Second));
 }
 
 TEST_F(PolynomialTest, EvaluateConstant) {
@@ -267,6 +278,8 @@ TEST_F(PolynomialTest, EvaluateLinear) {
   EXPECT_THAT(estrin_light.Evaluate(1729 * Second), Eq(1729 * light_second));
   EXPECT_THAT(horner_light.EvaluateDerivative(1729 * Second), Eq(SpeedOfLight));
   EXPECT_THAT(estrin_light.EvaluateDerivative(1729 * Second), Eq(SpeedOfLight));
+  EXPECT_THAT(horner_light.EvaluateSecondDerivative(1729 * Second),
+              Eq(0 * Metre / Second / Second));
 }
 
 // Check that polynomials may be serialized.
@@ -0,0 +1,62 @@
+﻿
+#pragma once
+
+#include <immintrin.h>
+
+#include "base/macros.hpp"
+#include "geometry/r3_element.hpp"
+
+namespace principia {
+namespace numerics {
+namespace internal_r3_element_lanes {
+
+using geometry::R3Element;
+
+// The SIMD representation of 3-vectors used by the evaluators of polynomials
+// and Чебышёв series.  |Lanes| holds the three coordinates of a vector,
+// |Broadcast| holds copies of a scalar.  The operations mirror those of
+// |R3Element| so that the results are bitwise identical when FMA is not used.
+// The intrinsic types are wrapped in structs because their alignment attributes
+// are dropped when they are used as template arguments, e.g., of |std::array|.
+#if PRINCIPIA_USE_AVX_INTRINSICS
+struct Lanes {
+  __m256d xyzt;
+};
+struct Broadcast {
+  __m256d x;
+};
+#else
+struct Lanes {
+  __m128d xy;
+  __m128d zt;
+};
+struct Broadcast {
+  __m128d x;
+};
+#endif
+
+template<typename Scalar>
+Lanes Load(R3Element<Scalar> const& r3_element);
+
+template<typename Scalar>
+R3Element<Scalar> Store(Lanes lanes);
+
+Lanes Zero();
+
+Broadcast MakeBroadcast(double x);
+
+// Returns a + b and a - b.
+Lanes Add(Lanes a, Lanes b);
+Lanes Subtract(Lanes a, Lanes b);
+
+// Returns a * x.
+Lanes Multiply(Lanes a, Broadcast x);
+
+// Returns a * x + b.
+Lanes MultiplyAdd(Lanes a, Broadcast x, Lanes b);
+
+}  // namespace internal_r3_element_lanes
+}  // namespace numerics
+}  // namespace principia
+
+#include "numerics/r3_element_lanes_body.hpp"
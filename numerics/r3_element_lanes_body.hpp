@@ -0,0 +1,92 @@
+﻿
+#pragma once
+
+#include "numerics/r3_element_lanes.hpp"
+
+namespace principia {
+namespace numerics {
+namespace internal_r3_element_lanes {
+
+#if PRINCIPIA_USE_AVX_INTRINSICS
+template<typename Scalar>
+FORCE_INLINE(inline) Lanes Load(R3Element<Scalar> const& r3_element) {
+  return {_mm256_set_m128d(r3_element.zt, r3_element.xy)};
+}
+
+template<typename Scalar>
+FORCE_INLINE(inline) R3Element<Scalar> Store(Lanes const lanes) {
+  return R3Element<Scalar>(_mm256_castpd256_pd128(lanes.xyzt),
+                           _mm256_extractf128_pd(lanes.xyzt, 1));
+}
+
+FORCE_INLINE(inline) Lanes Zero() {
+  return {_mm256_setzero_pd()};
+}
+
+FORCE_INLINE(inline) Broadcast MakeBroadcast(double const x) {
+  return {_mm256_set1_pd(x)};
+}
+
+FORCE_INLINE(inline) Lanes Add(Lanes const a, Lanes const b) {
+  return {_mm256_add_pd(a.xyzt, b.xyzt)};
+}
+
+FORCE_INLINE(inline) Lanes Subtract(Lanes const a, Lanes const b) {
+  return {_mm256_sub_pd(a.xyzt, b.xyzt)};
+}
+
+FORCE_INLINE(inline) Lanes Multiply(Lanes const a, Broadcast const x) {
+  return {_mm256_mul_pd(a.xyzt, x.x)};
+}
+
+FORCE_INLINE(inline) Lanes MultiplyAdd(Lanes const a,
+                                       Broadcast const x,
+                                       Lanes const b) {
+#if PRINCIPIA_USE_FMA_INTRINSICS
+  return {_mm256_fmadd_pd(a.xyzt, x.x, b.xyzt)};
+#else
+  return {_mm256_add_pd(_mm256_mul_pd(a.xyzt, x.x), b.xyzt)};
+#endif
+}
+#else
+template<typename Scalar>
+FORCE_INLINE(inline) Lanes Load(R3Element<Scalar> const& r3_element) {
+  return {r3_element.xy, r3_element.zt};
+}
+
+template<typename Scalar>
+FORCE_INLINE(inline) R3Element<Scalar> Store(Lanes const lanes) {
+  return R3Element<Scalar>(lanes.xy, lanes.zt);
+}
+
+FORCE_INLINE(inline) Lanes Zero() {
+  return {_mm_setzero_pd(), _mm_setzero_pd()};
+}
+
+FORCE_INLINE(inline) Broadcast MakeBroadcast(double const x) {
+  return {_mm_set1_pd(x)};
+}
+
+FORCE_INLINE(inline) Lanes Add(Lanes const a, Lanes const b) {
+  return {_mm_add_pd(a.xy, b.xy), _mm_add_sd(a.zt, b.zt)};
+}
+
+FORCE_INLINE(inline) Lanes Subtract(Lanes const a, Lanes const b) {
+  return {_mm_sub_pd(a.xy, b.xy), _mm_sub_sd(a.zt, b.zt)};
+}
+
+FORCE_INLINE(inline) Lanes Multiply(Lanes const a, Broadcast const x) {
+  return {_mm_mul_pd(a.xy, x.x), _mm_mul_sd(a.zt, x.x)};
+}
+
+FORCE_INLINE(inline) Lanes MultiplyAdd(Lanes const a,
+                                       Broadcast const x,
+                                       Lanes const b) {
+  return {_mm_add_pd(_mm_mul_pd(a.xy, x.x), b.xy),
+          _mm_add_sd(_mm_mul_sd(a.zt, x.x), b.zt)};
+}
+#endif
+
+}  // namespace internal_r3_element_lanes
+}  // namespace numerics
+}  // namespace principia
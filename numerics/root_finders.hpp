@@ -23,6 +23,28 @@ Argument Bisect(Function f,
                 Argument const& lower_bound,
                 Argument const& upper_bound);
 
+// Approximates a root of |f| between |lower_bound| and |upper_bound| using
+// Brent's method, which combines inverse quadratic interpolation, the secant
+// method and bisection.  For a smooth function it converges superlinearly, and
+// it is never much slower than |Bisect|.  The result is within a few ULPs of a
+// root.  The same conditions as for |Bisect| apply to |f|.
+template<typename Argument, typename Function>
+Argument Brent(Function f,
+               Argument const& lower_bound,
+               Argument const& upper_bound);
+
+// Same as |Brent|, but uses Chandrupatla's method, which only uses inverse
+// quadratic interpolation when the last three iterates indicate that it is
+// well-behaved, and falls back to bisection otherwise.  It typically needs a
+// few evaluations less than |Brent| for functions that are nearly linear on
+// the bracket.  See Chandrupatla (1997), A new hybrid quadratic/bisection
+// algorithm for finding the zero of a nonlinear function without using
+// derivatives.
+template<typename Argument, typename Function>
+Argument Chandrupatla(Function f,
+                      Argument const& lower_bound,
+                      Argument const& upper_bound);
+
 // Returns the solutions of the quadratic equation:
 //   a2 * (x - origin)^2 + a1 * (x - origin) + a0 == 0
 // The result may have 0, 1 or 2 values and is sorted.
@@ -33,9 +55,25 @@ BoundedArray<Argument, 2> SolveQuadraticEquation(
     Derivative<Value, Argument> const& a1,
     Derivative<Derivative<Value, Argument>, Argument> const& a2);
 
+// Returns the real solutions of the cubic equation:
+//   a3 * (x - origin)^3 + a2 * (x - origin)^2 + a1 * (x - origin) + a0 == 0
+// The result may have 0 (only if |a3| is zero), 1, 2 or 3 values and is
+// sorted.  Multiple roots are only returned once.
+template<typename Argument, typename Value>
+BoundedArray<Argument, 3> SolveCubicEquation(
+    Argument const& origin,
+    Value const& a0,
+    Derivative<Value, Argument> const& a1,
+    Derivative<Derivative<Value, Argument>, Argument> const& a2,
+    Derivative<Derivative<Derivative<Value, Argument>, Argument>,
+               Argument> const& a3);
+
 }  // namespace internal_root_finders
 
 using internal_root_finders::Bisect;
+using internal_root_finders::Brent;
+using internal_root_finders::Chandrupatla;
+using internal_root_finders::SolveCubicEquation;
 using internal_root_finders::SolveQuadraticEquation;
 
 }  // namespace numerics
@@ -3,12 +3,17 @@
 
 #include "root_finders.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include "geometry/barycentre_calculator.hpp"
 #include "geometry/sign.hpp"
 #include "glog/logging.h"
 #include "numerics/double_precision.hpp"
+#include "quantities/elementary_functions.hpp"
+#include "quantities/numbers.hpp"
 
 namespace principia {
 namespace numerics {
@@ -16,9 +21,25 @@ namespace internal_root_finders {
 
 using geometry::Barycentre;
 using geometry::Sign;
+using quantities::Abs;
+using quantities::Cbrt;
+using quantities::Cube;
+using quantities::Difference;
+using quantities::Pow;
+using quantities::SIUnit;
 using quantities::Square;
 using quantities::Sqrt;
 
+// Returns a length of the order of the ULP of |x|.  A step shorter than this
+// doesn't make progress.
+template<typename Argument>
+Difference<Argument> Tolerance(Argument const& x) {
+  Argument const zero{};
+  return 2 * std::numeric_limits<double>::epsilon() * Abs(x - zero) +
+         std::numeric_limits<double>::denorm_min() *
+             SIUnit<Difference<Argument>>();
+}
+
 template<typename Argument, typename Function>
 Argument Bisect(Function f,
                 Argument const& lower_bound,
@@ -56,6 +77,173 @@ Argument Bisect(Function f,
   }
 }
 
+template<typename Argument, typename Function>
+Argument Brent(Function f,
+               Argument const& lower_bound,
+               Argument const& upper_bound) {
+  using Value = decltype(f(lower_bound));
+  Value const zero{};
+  Value f_upper = f(upper_bound);
+  Value f_lower = f(lower_bound);
+  if (f_upper == zero) {
+    return upper_bound;
+  }
+  if (f_lower == zero) {
+    return lower_bound;
+  }
+  CHECK(f_lower > zero && zero > f_upper || f_lower < zero && zero < f_upper)
+      << "\nlower: " << lower_bound << " :-> " << f_lower << ", "
+      << "\nupper: " << upper_bound << " :-> " << f_upper;
+
+  // This algorithm is after Brent (1973), Algorithms for Minimization without
+  // Derivatives, chapter 4.  |b| is the best approximation of the root so far,
+  // |c| is such that the root is between |b| and |c|, and |a| is the previous
+  // value of |b|.  |d| is the last step and |e| the one before.
+  Argument a = lower_bound;
+  Argument b = upper_bound;
+  Argument c = a;
+  Value f_a = f_lower;
+  Value f_b = f_upper;
+  Value f_c = f_a;
+  Difference<Argument> d = b - a;
+  Difference<Argument> e = d;
+  for (;;) {
+    if (Sign(f_b) == Sign(f_c)) {
+      c = a;
+      f_c = f_a;
+      d = b - a;
+      e = d;
+    }
+    if (Abs(f_c) < Abs(f_b)) {
+      a = b;
+      b = c;
+      c = a;
+      f_a = f_b;
+      f_b = f_c;
+      f_c = f_a;
+    }
+
+    Difference<Argument> const tolerance = Tolerance(b);
+    Difference<Argument> const m = 0.5 * (c - b);
+    if (f_b == zero || Abs(m) <= tolerance) {
+      return b;
+    }
+
+    if (Abs(e) >= tolerance && Abs(f_a) > Abs(f_b)) {
+      // Attempt an interpolation.
+      double const s = f_b / f_a;
+      Difference<Argument> p;
+      double q;
+      if (a == c) {
+        // Secant method.
+        p = 2 * m * s;
+        q = 1 - s;
+      } else {
+        // Inverse quadratic interpolation.
+        double const q_ac = f_a / f_c;
+        double const r = f_b / f_c;
+        p = s * (2 * m * q_ac * (q_ac - r) - (b - a) * (r - 1));
+        q = (q_ac - 1) * (r - 1) * (s - 1);
+      }
+      if (p > Difference<Argument>{}) {
+        q = -q;
+      } else {
+        p = -p;
+      }
+      // Only accept the interpolation if it falls within the bracket and
+      // converges fast enough.
+      if (2 * p < std::min(3 * m * q - Abs(tolerance * q), Abs(e * q))) {
+        e = d;
+        d = p / q;
+      } else {
+        d = m;
+        e = m;
+      }
+    } else {
+      // Bisection.
+      d = m;
+      e = m;
+    }
+    a = b;
+    f_a = f_b;
+    if (Abs(d) > tolerance) {
+      b += d;
+    } else if (m > Difference<Argument>{}) {
+      b += tolerance;
+    } else {
+      b -= tolerance;
+    }
+    f_b = f(b);
+  }
+}
+
+template<typename Argument, typename Function>
+Argument Chandrupatla(Function f,
+                      Argument const& lower_bound,
+                      Argument const& upper_bound) {
+  using Value = decltype(f(lower_bound));
+  Value const zero{};
+  Value f_upper = f(upper_bound);
+  Value f_lower = f(lower_bound);
+  if (f_upper == zero) {
+    return upper_bound;
+  }
+  if (f_lower == zero) {
+    return lower_bound;
+  }
+  CHECK(f_lower > zero && zero > f_upper || f_lower < zero && zero < f_upper)
+      << "\nlower: " << lower_bound << " :-> " << f_lower << ", "
+      << "\nupper: " << upper_bound << " :-> " << f_upper;
+
+  // The root is between |x1| and |x2|; |x1| is the last iterate and |x3| the
+  // point that was discarded from the bracket.  The next iterate is
+  // x1 + t (x2 - x1).
+  Argument x1 = upper_bound;
+  Argument x2 = lower_bound;
+  Argument x3;
+  Value f1 = f_upper;
+  Value f2 = f_lower;
+  Value f3;
+  double t = 0.5;
+  for (;;) {
+    Argument const xt = x1 + t * (x2 - x1);
+    Value const ft = f(xt);
+    if (Sign(ft) == Sign(f1)) {
+      x3 = x1;
+      f3 = f1;
+    } else {
+      x3 = x2;
+      x2 = x1;
+      f3 = f2;
+      f2 = f1;
+    }
+    x1 = xt;
+    f1 = ft;
+
+    Argument const& x_best = Abs(f1) < Abs(f2) ? x1 : x2;
+    if (ft == zero) {
+      return xt;
+    }
+    double const t_min = Tolerance(x_best) / Abs(x2 - x1);
+    if (t_min > 0.5) {
+      return x_best;
+    }
+
+    // Use inverse quadratic interpolation if the three points are such that
+    // the interpolating parabola is monotonic on the bracket, bisection
+    // otherwise.
+    double const ξ = (x1 - x2) / (x3 - x2);
+    double const φ = (f1 - f2) / (f3 - f2);
+    if (1 - std::sqrt(1 - ξ) < φ && φ < std::sqrt(ξ)) {
+      t = f1 / (f2 - f1) * f3 / (f2 - f3) +
+          (x3 - x1) / (x2 - x1) * f1 / (f3 - f1) * f2 / (f3 - f2);
+    } else {
+      t = 0.5;
+    }
+    t = std::clamp(t, t_min, 1 - t_min);
+  }
+}
+
 template<typename Argument, typename Value>
 BoundedArray<Argument, 2> SolveQuadraticEquation(
     Argument const& origin,
@@ -103,6 +291,95 @@ BoundedArray<Argument, 2> SolveQuadraticEquation(
   }
 }
 
+template<typename Argument, typename Value>
+BoundedArray<Argument, 3> SolveCubicEquation(
+    Argument const& origin,
+    Value const& a0,
+    Derivative<Value, Argument> const& a1,
+    Derivative<Derivative<Value, Argument>, Argument> const& a2,
+    Derivative<Derivative<Derivative<Value, Argument>, Argument>,
+               Argument> const& a3) {
+  using Derivative3 =
+      Derivative<Derivative<Derivative<Value, Argument>, Argument>, Argument>;
+  using Δ = Difference<Argument>;
+
+  BoundedArray<Argument, 3> result;
+  if (a3 == Derivative3{}) {
+    for (Argument const& x : SolveQuadraticEquation(origin, a0, a1, a2)) {
+      result.push_back(x);
+    }
+    return result;
+  }
+
+  // We first compute the root of largest magnitude of the normalized equation
+  // Δx³ + b Δx² + c Δx + d == 0, where Δx = x - origin, after section 5.6 of
+  // Numerical Recipes, Third Edition, Press et al., ISBN 978-0-521-88068-8.
+  // The other roots, which may be poorly determined by the normalized equation
+  // if |a3| is small, are obtained by deflation.
+  Δ const b = a2 / a3;
+  Square<Δ> const c = a1 / a3;
+  Cube<Δ> const d = a0 / a3;
+  Square<Δ> const Q = (b * b - 3 * c) / 9;
+  Cube<Δ> const R = (2 * b * b * b - 9 * b * c + 27 * d) / 54;
+  auto const R² = R * R;
+  auto const Q³ = Q * Q * Q;
+
+  Δ Δx₁;
+  if (R² < Q³) {
+    // Three real roots.
+    double const θ = std::acos(R / Sqrt(Q³));
+    Δ const sqrt_Q = Sqrt(Q);
+    for (int k = 0; k < 3; ++k) {
+      Δ const Δx = -2 * sqrt_Q * std::cos((θ + 2 * k * π) / 3) - b / 3;
+      if (k == 0 || Abs(Δx) > Abs(Δx₁)) {
+        Δx₁ = Δx;
+      }
+    }
+  } else {
+    Δ A = Cbrt(Abs(R) + Sqrt(R² - Q³));
+    if (R > Cube<Δ>{}) {
+      A = -A;
+    }
+    Δ const B = A == Δ{} ? Δ{} : Q / A;
+    Δx₁ = A + B - b / 3;
+  }
+
+  // Polishes |Δx| with a step of Newton's method on the original polynomial.
+  auto const polish = [&a0, &a1, &a2, &a3](Δ const& Δx) {
+    Value const p = ((a3 * Δx + a2) * Δx + a1) * Δx + a0;
+    auto const pʹ = (3 * a3 * Δx + 2 * a2) * Δx + a1;
+    return pʹ == decltype(pʹ){} ? Δx : Δx - p / pʹ;
+  };
+  Δx₁ = polish(Δx₁);
+
+  // Divide by (Δx - Δx₁) to obtain a quadratic q2 Δx² + q1 Δx + q0.  The
+  // division proceeds from the constant term, which is stable for the root of
+  // largest magnitude.
+  BoundedArray<Δ, 3> Δxs = {Δx₁};
+  BoundedArray<Argument, 2> quadratic_roots;
+  if (Δx₁ == Δ{}) {
+    quadratic_roots = SolveQuadraticEquation(origin, a1, a2, a3);
+  } else {
+    Derivative<Value, Argument> const q0 = -a0 / Δx₁;
+    Derivative<Derivative<Value, Argument>, Argument> const q1 =
+        (q0 - a1) / Δx₁;
+    Derivative3 const q2 = (q1 - a2) / Δx₁;
+    quadratic_roots = SolveQuadraticEquation(origin, q0, q1, q2);
+  }
+  for (Argument const& x : quadratic_roots) {
+    Δxs.push_back(polish(x - origin));
+  }
+
+  std::sort(Δxs.begin(), Δxs.end());
+  for (Δ const& Δx : Δxs) {
+    Argument const x = origin + Δx;
+    if (result.empty() || result.back() != x) {
+      result.push_back(x);
+    }
+  }
+  return result;
+}
+
 }  // namespace internal_root_finders
 }  // namespace numerics
 }  // namespace principia
@@ -6,6 +6,7 @@
 #include "geometry/named_quantities.hpp"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "quantities/numbers.hpp"
 #include "quantities/quantities.hpp"
 #include "quantities/si.hpp"
 #include "testing_utilities/almost_equals.hpp"
@@ -50,9 +51,48 @@ TEST_F(RootFindersTest, SquareRoots) {
     } else {
       EXPECT_THAT(evaluations, AllOf(Ge(49), Le(58)));
     }
+
+    evaluations = 0;
+    EXPECT_THAT(Brent(equation, t_0, t_max) - t_0,
+                AlmostEquals(Sqrt(n / SIUnit<Acceleration>()), 0, 2));
+    EXPECT_THAT(evaluations, AllOf(Ge(7), Le(14)));
+    evaluations = 0;
+    EXPECT_THAT(Chandrupatla(equation, t_0, t_max) - t_0,
+                AlmostEquals(Sqrt(n / SIUnit<Acceleration>()), 0, 2));
+    if (n == 25 * Metre) {
+      EXPECT_EQ(3, evaluations);
+    } else {
+      EXPECT_THAT(evaluations, AllOf(Ge(8), Le(12)));
+    }
   }
 }
 
+// A transcendental equation with a root far from the origin of the arguments:
+// Kepler's equation for an eccentric orbit, in seconds since J2000.
+TEST_F(RootFindersTest, KeplerEquation) {
+  Instant const t_0 = Instant() + 1e9 * Second;
+  Time const period = 1e4 * Second;
+  double const eccentricity = 0.7;
+  double const mean_anomaly = 1.0;
+  double const eccentric_anomaly = 1.694638912091841;
+  int evaluations = 0;
+  auto const kepler_equation = [=, &evaluations](Instant const& t) {
+    ++evaluations;
+    double const E = 2 * π * ((t - t_0) / period);
+    return E - eccentricity * std::sin(E) - mean_anomaly;
+  };
+  Instant const expected = t_0 + eccentric_anomaly / (2 * π) * period;
+
+  EXPECT_EQ(expected, Bisect(kepler_equation, t_0, t_0 + period / 2));
+  EXPECT_EQ(37, evaluations);
+  evaluations = 0;
+  EXPECT_EQ(expected, Brent(kepler_equation, t_0, t_0 + period / 2));
+  EXPECT_EQ(10, evaluations);
+  evaluations = 0;
+  EXPECT_EQ(expected, Chandrupatla(kepler_equation, t_0, t_0 + period / 2));
+  EXPECT_EQ(9, evaluations);
+}
+
 TEST_F(RootFindersTest, QuadraticEquations) {
   // Golden ratio.
   auto const s1 = SolveQuadraticEquation(0.0, -1.0, -1.0, 1.0);
@@ -85,5 +125,44 @@ TEST_F(RootFindersTest, QuadraticEquations) {
   EXPECT_THAT(s5, ElementsAre(t0 - 1.0 * Second));
 }
 
+TEST_F(RootFindersTest, CubicEquations) {
+  // Three real roots: (x - 1) (x - 2) (x - 3).
+  auto const s1 = SolveCubicEquation(0.0, -6.0, 11.0, -6.0, 1.0);
+  EXPECT_THAT(s1, ElementsAre(AlmostEquals(1, 0),
+                              AlmostEquals(2, 0),
+                              AlmostEquals(3, 0)));
+
+  // One real root: (x - 1) (x² + 1).
+  auto const s2 = SolveCubicEquation(0.0, -1.0, 1.0, -1.0, 1.0);
+  EXPECT_THAT(s2, ElementsAre(AlmostEquals(1, 0)));
+
+  // A double root: (x - 1)² (x + 2).
+  auto const s3 = SolveCubicEquation(0.0, 2.0, -3.0, 0.0, 1.0);
+  EXPECT_THAT(s3, ElementsAre(AlmostEquals(-2, 0), AlmostEquals(1, 0)));
+
+  // Degenerates to a quadratic.
+  auto const s4 = SolveCubicEquation(0.0, -1.0, -1.0, 1.0, 0.0);
+  EXPECT_THAT(s4,
+              ElementsAre(AlmostEquals((1 - sqrt(5)) / 2, 1),
+                          AlmostEquals((1 + sqrt(5)) / 2, 0)));
+
+  // A nearly quadratic equation, where the normalization is ill-conditioned.
+  auto const s5 = SolveCubicEquation(0.0, -6.0, 1.0, 1.0, 1e-12);
+  EXPECT_THAT(s5, ElementsAre(AlmostEquals(-999999999999.0, 0),
+                              AlmostEquals(-3.0000000000054, 0),
+                              AlmostEquals(1.9999999999984, 1)));
+
+  // A typed system: (t - 1 s) (t - 2 s) (t - 4 s).
+  Instant const t0;
+  auto const s6 = SolveCubicEquation(t0,
+                                     -8.0 * Metre,
+                                     14.0 * Metre / Second,
+                                     -7.0 * Metre / Pow<2>(Second),
+                                     1.0 * Metre / Pow<3>(Second));
+  EXPECT_THAT(s6, ElementsAre(AlmostEquals(t0 + 1 * Second, 0),
+                              AlmostEquals(t0 + 2 * Second, 0),
+                              AlmostEquals(t0 + 4 * Second, 0)));
+}
+
 }  // namespace numerics
 }  // namespace principia
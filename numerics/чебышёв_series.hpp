@@ -3,6 +3,7 @@
 
 #include <vector>
 
+#include "absl/types/span.h"
 #include "geometry/named_quantities.hpp"
 #include "quantities/quantities.hpp"
 #include "serialization/numerics.pb.h"
@@ -32,6 +33,8 @@ class EvaluationHelper final {
   EvaluationHelper& operator=(EvaluationHelper&& other) = default;
 
   Vector EvaluateImplementation(double scaled_t) const;
+  void EvaluateImplementation(absl::Span<double const> scaled_ts,
+                              absl::Span<Vector> values) const;
 
   Vector coefficients(int index) const;
   int degree() const;
@@ -69,6 +72,13 @@ class ЧебышёвSeries final {
   Vector Evaluate(Instant const& t) const;
   Variation<Vector> EvaluateDerivative(Instant const& t) const;
 
+  // Evaluates the series at each element of |times| and stores the results in
+  // the corresponding elements of |values|, which must have the same size.
+  // Faster than calling |Evaluate| repeatedly because the recurrences for
+  // different times are interleaved.
+  void Evaluate(absl::Span<Instant const> times,
+                absl::Span<Vector> values) const;
+
   void WriteToMessage(not_null<serialization::ЧебышёвSeries*> message) const;
   static ЧебышёвSeries ReadFromMessage(
       serialization::ЧебышёвSeries const& message);
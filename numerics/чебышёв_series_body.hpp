@@ -1,14 +1,17 @@
 ﻿
 #include "numerics/чебышёв_series.hpp"
 
+#include <algorithm>
 #include <vector>
 
+#include "base/macros.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/r3_element.hpp"
 #include "geometry/serialization.hpp"
 #include "glog/logging.h"
 #include "numerics/fixed_arrays.hpp"
 #include "numerics/newhall.mathematica.h"
+#include "numerics/r3_element_lanes.hpp"
 
 namespace principia {
 namespace numerics {
@@ -17,10 +20,18 @@ namespace internal_чебышёв_series {
 using geometry::DoubleOrQuantityOrMultivectorSerializer;
 using geometry::Multivector;
 using geometry::R3Element;
+using internal_r3_element_lanes::Lanes;
+using internal_r3_element_lanes::Load;
+using internal_r3_element_lanes::MakeBroadcast;
+using internal_r3_element_lanes::MultiplyAdd;
+using internal_r3_element_lanes::Store;
+using internal_r3_element_lanes::Subtract;
+using internal_r3_element_lanes::Zero;
 using quantities::SIUnit;
 
 // The compiler does a much better job on an |R3Element<double>| than on a
-// |Vector<Quantity>| so we specialize this case.
+// |Vector<Quantity>| so we specialize this case.  The recurrence is run for the
+// three coordinates in parallel in SIMD registers.
 template<typename Scalar, typename Frame, int rank>
 class EvaluationHelper<Multivector<Scalar, Frame, rank>> final {
  public:
@@ -32,6 +43,9 @@ class EvaluationHelper<Multivector<Scalar, Frame, rank>> final {
 
   Multivector<Scalar, Frame, rank> EvaluateImplementation(
       double const scaled_t) const;
+  void EvaluateImplementation(
+      absl::Span<double const> scaled_ts,
+      absl::Span<Multivector<Scalar, Frame, rank>> values) const;
 
   Multivector<Scalar, Frame, rank> coefficients(int const index) const;
   int degree() const;
@@ -41,6 +55,14 @@ class EvaluationHelper<Multivector<Scalar, Frame, rank>> final {
   int degree_;
 };
 
+// Returns c + t * b₁ - b₂.
+FORCE_INLINE(inline) Lanes ClenshawStep(Lanes const c,
+                                        double const t,
+                                        Lanes const b₁,
+                                        Lanes const b₂) {
+  return Subtract(MultiplyAdd(b₁, MakeBroadcast(t), c), b₂);
+}
+
 template<typename Vector>
 EvaluationHelper<Vector>::EvaluationHelper(
     std::vector<Vector> const& coefficients,
@@ -80,6 +102,16 @@ Vector EvaluationHelper<Vector>::EvaluateImplementation(
   }
 }
 
+template<typename Vector>
+void EvaluationHelper<Vector>::EvaluateImplementation(
+    absl::Span<double const> const scaled_ts,
+    absl::Span<Vector> const values) const {
+  CHECK_EQ(scaled_ts.size(), values.size());
+  for (std::size_t i = 0; i < scaled_ts.size(); ++i) {
+    values[i] = EvaluateImplementation(scaled_ts[i]);
+  }
+}
+
 template<typename Vector>
 Vector EvaluationHelper<Vector>::coefficients(int const index) const {
   return coefficients_[index];
@@ -104,43 +136,60 @@ Multivector<Scalar, Frame, rank>
 EvaluationHelper<Multivector<Scalar, Frame, rank>>::EvaluateImplementation(
     double const scaled_t) const {
   double const two_scaled_t = scaled_t + scaled_t;
-  R3Element<double> const c_0 = coefficients_[0];
-  switch (degree_) {
-    case 0:
-      return Multivector<double, Frame, rank>(c_0) * SIUnit<Scalar>();
-    case 1:
-      return Multivector<double, Frame, rank>(
-                 c_0 + scaled_t * coefficients_[1]) * SIUnit<Scalar>();
-    default:
-      // b_degree   = c_degree.
-      R3Element<double> b_i = coefficients_[degree_];
-      // b_degree-1 = c_degree-1 + 2 t b_degree.
-      R3Element<double> b_j = coefficients_[degree_ - 1] + two_scaled_t * b_i;
-      int k = degree_ - 3;
-      for (; k >= 1; k -= 2) {
-        // b_k+1 = c_k+1 + 2 t b_k+2 - b_k+3.
-        R3Element<double> const c_kplus1 = coefficients_[k + 1];
-        b_i.x = c_kplus1.x + two_scaled_t * b_j.x - b_i.x;
-        b_i.y = c_kplus1.y + two_scaled_t * b_j.y - b_i.y;
-        b_i.z = c_kplus1.z + two_scaled_t * b_j.z - b_i.z;
-        // b_k   = c_k   + 2 t b_k+1 - b_k+2.
-        R3Element<double> const c_k = coefficients_[k];
-        b_j.x = c_k.x + two_scaled_t * b_i.x - b_j.x;
-        b_j.y = c_k.y + two_scaled_t * b_i.y - b_j.y;
-        b_j.z = c_k.z + two_scaled_t * b_i.z - b_j.z;
-      }
-      if (k == 0) {
-        // b_1 = c_1 + 2 t b_2 - b_3.
-        b_i = coefficients_[1] + two_scaled_t * b_j - b_i;
-        // c_0 + t b_1 - b_2.
-        return Multivector<double, Frame, rank>(
-                   c_0 + scaled_t * b_i - b_j) * SIUnit<Scalar>();
-      } else {
-        // c_0 + t b_1 - b_2.
-        return Multivector<double, Frame, rank>(
-                   c_0 + scaled_t * b_j - b_i) * SIUnit<Scalar>();
-      }
+  // b_k = c_k + 2 t b_k+1 - b_k+2, with b_degree+1 = b_degree+2 = 0.
+  Lanes b_kplus2 = Zero();
+  Lanes b_kplus1 = Zero();
+  for (int k = degree_; k >= 1; --k) {
+    Lanes const b_k =
+        ClenshawStep(Load(coefficients_[k]), two_scaled_t, b_kplus1, b_kplus2);
+    b_kplus2 = b_kplus1;
+    b_kplus1 = b_k;
+  }
+  // c_0 + t b_1 - b_2.
+  return Multivector<double, Frame, rank>(Store<double>(ClenshawStep(
+             Load(coefficients_[0]), scaled_t, b_kplus1, b_kplus2))) *
+         SIUnit<Scalar>();
+}
+
+template<typename Scalar, typename Frame, int rank>
+void EvaluationHelper<Multivector<Scalar, Frame, rank>>::EvaluateImplementation(
+    absl::Span<double const> const scaled_ts,
+    absl::Span<Multivector<Scalar, Frame, rank>> const values) const {
+  CHECK_EQ(scaled_ts.size(), values.size());
+  std::size_t i = 0;
+  // The recurrence is a long dependency chain, so we run it for two times at
+  // once to keep the SIMD units busy.
+  for (; i + 2 <= scaled_ts.size(); i += 2) {
+    double const scaled_t1 = scaled_ts[i];
+    double const scaled_t2 = scaled_ts[i + 1];
+    double const two_scaled_t1 = scaled_t1 + scaled_t1;
+    double const two_scaled_t2 = scaled_t2 + scaled_t2;
+    Lanes b1_kplus2 = Zero();
+    Lanes b1_kplus1 = Zero();
+    Lanes b2_kplus2 = Zero();
+    Lanes b2_kplus1 = Zero();
+    for (int k = degree_; k >= 1; --k) {
+      Lanes const c_k = Load(coefficients_[k]);
+      Lanes const b1_k = ClenshawStep(c_k, two_scaled_t1, b1_kplus1, b1_kplus2);
+      Lanes const b2_k = ClenshawStep(c_k, two_scaled_t2, b2_kplus1, b2_kplus2);
+      b1_kplus2 = b1_kplus1;
+      b1_kplus1 = b1_k;
+      b2_kplus2 = b2_kplus1;
+      b2_kplus1 = b2_k;
     }
+    Lanes const c_0 = Load(coefficients_[0]);
+    values[i] =
+        Multivector<double, Frame, rank>(Store<double>(
+            ClenshawStep(c_0, scaled_t1, b1_kplus1, b1_kplus2))) *
+        SIUnit<Scalar>();
+    values[i + 1] =
+        Multivector<double, Frame, rank>(Store<double>(
+            ClenshawStep(c_0, scaled_t2, b2_kplus1, b2_kplus2))) *
+        SIUnit<Scalar>();
+  }
+  if (i < scaled_ts.size()) {
+    values[i] = EvaluateImplementation(scaled_ts[i]);
+  }
 }
 
 template<typename Scalar, typename Frame, int rank>
@@ -250,6 +299,24 @@ Variation<Vector> ЧебышёвSeries<Vector>::EvaluateDerivative(
              (one_over_duration_ + one_over_duration_);
 }
 
+template<typename Vector>
+void ЧебышёвSeries<Vector>::Evaluate(absl::Span<Instant const> const times,
+                                     absl::Span<Vector> const values) const {
+  CHECK_EQ(times.size(), values.size());
+  std::vector<double> scaled_ts;
+  scaled_ts.reserve(times.size());
+  for (Instant const& t : times) {
+    // See comments above.
+    double const scaled_t = ((t - t_max_) + (t - t_min_)) * one_over_duration_;
+#ifdef _DEBUG
+    CHECK_LE(scaled_t, 1.1);
+    CHECK_GE(scaled_t, -1.1);
+#endif
+    scaled_ts.push_back(scaled_t);
+  }
+  helper_.EvaluateImplementation(scaled_ts, values);
+}
+
 template<typename Vector>
 void ЧебышёвSeries<Vector>::WriteToMessage(
     not_null<serialization::ЧебышёвSeries*> const message) const {
@@ -1,6 +1,8 @@
 ﻿
 #include "numerics/чебышёв_series.hpp"
 
+#include <vector>
+
 #include "astronomy/frames.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/named_quantities.hpp"
@@ -133,6 +135,40 @@ TEST_F(ЧебышёвSeriesTest, X6Vector) {
             x6.Evaluate(t0_ + 3 * Second));
 }
 
+TEST_F(ЧебышёвSeriesTest, X6VectorBatch) {
+  using V = Vector<Length, ICRS>;
+  // {T3, X5, X6}, as above.
+  V const c0 = V({0.0 * Metre, 0.0 * Metre, 10.0 / 32.0 * Metre});
+  V const c1 = V({0.0 * Metre, 10.0 / 16.0 * Metre, 0.0 * Metre});
+  V const c2 = V({0.0 * Metre, 0.0 * Metre, 15.0 / 32.0 * Metre});
+  V const c3 = V({1.0 * Metre, 5.0 / 16.0 * Metre, 0.0 * Metre});
+  V const c4 = V({0.0 * Metre, 0.0 * Metre, 6.0 / 32.0 * Metre});
+  V const c5 = V({0.0 * Metre, 1.0 / 16.0 * Metre, 0 * Metre});
+  V const c6 = V({0.0 * Metre, 0.0 * Metre, 1.0 / 32.0 * Metre});
+  ЧебышёвSeries<Vector<Length, ICRS>> x6({c0, c1, c2, c3, c4, c5, c6},
+                                         t_min_, t_max_);
+  // An odd number of times, to exercise the remainder of the batch.
+  std::vector<Instant> times;
+  for (int i = 0; i <= 16; ++i) {
+    times.push_back(t_min_ + i * 0.25 * Second);
+  }
+  std::vector<V> values(times.size());
+  x6.Evaluate(times, absl::MakeSpan(values));
+  for (int i = 0; i < times.size(); ++i) {
+    EXPECT_EQ(x6.Evaluate(times[i]), values[i]) << i;
+  }
+  EXPECT_EQ(V({-1 * Metre, -1 * Metre, 1 * Metre}), values[0]);
+  EXPECT_EQ(V({-1 * Metre, 1.0 / 32.0 * Metre, 1 / 64.0 * Metre}), values[12]);
+  EXPECT_EQ(V({1 * Metre, 1 * Metre, 1 * Metre}), values[16]);
+
+  ЧебышёвSeries<Length> t2({0 * Metre, 0 * Metre, 1 * Metre}, t_min_, t_max_);
+  std::vector<Length> lengths(times.size());
+  t2.Evaluate(times, absl::MakeSpan(lengths));
+  for (int i = 0; i < times.size(); ++i) {
+    EXPECT_EQ(t2.Evaluate(times[i]), lengths[i]) << i;
+  }
+}
+
 TEST_F(ЧебышёвSeriesDeathTest, SerializationError) {
   ЧебышёвSeries<Speed> v({1 * Metre / Second,
                           -2 * Metre / Second,
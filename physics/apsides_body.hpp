@@ -18,7 +18,6 @@ using geometry::Barycentre;
 using geometry::Instant;
 using geometry::Position;
 using geometry::Sign;
-using numerics::Bisect;
 using numerics::Hermite3;
 using quantities::Length;
 using quantities::Speed;
@@ -156,35 +155,33 @@ void ComputeNodes(typename DiscreteTrajectory<Frame>::Iterator begin,
           {*previous_z, z},
           {*previous_z_speed, z_speed});
 
-      Instant node_time;
-      if (Sign(z_approximation.Evaluate(*previous_time)) ==
-          Sign(z_approximation.Evaluate(time))) {
+      // Look at the roots and pick the first one in the required time
+      // interval.  There is normally exactly one, but there may be none due to
+      // ill-conditioning.
+      std::optional<Instant> node_time;
+      for (Instant const& root : z_approximation.FindRoots()) {
+        if (root >= *previous_time && root <= time) {
+          node_time = root;
+          break;
+        }
+      }
+      if (!node_time) {
         // The Hermite approximation is poorly conditioned, let's use a linear
-        // approximation
+        // approximation.
         node_time = Barycentre<Instant, Length>({*previous_time, time},
                                                 {z, -*previous_z});
-      } else {
-        // The normal case, find the intersection with z = 0 using bisection.
-        // TODO(egg): Bisection on a polynomial seems daft; we should have
-        // Newton's method.
-        node_time = Bisect(
-            [&z_approximation](Instant const& t) {
-              return z_approximation.Evaluate(t);
-            },
-            *previous_time,
-            time);
       }
 
       DegreesOfFreedom<Frame> const node_degrees_of_freedom =
-          begin.trajectory()->EvaluateDegreesOfFreedom(node_time);
+          begin.trajectory()->EvaluateDegreesOfFreedom(*node_time);
       if (predicate(node_degrees_of_freedom)) {
         if (Sign(InnerProduct(north, Vector<double, Frame>({0, 0, 1}))) ==
             Sign(z_speed)) {
           // |north| is up and we are going up, or |north| is down and we are
           // going down.
-          ascending.Append(node_time, node_degrees_of_freedom);
+          ascending.Append(*node_time, node_degrees_of_freedom);
         } else {
-          descending.Append(node_time, node_degrees_of_freedom);
+          descending.Append(*node_time, node_degrees_of_freedom);
         }
         if (ascending.Size() >= max_points && descending.Size() >= max_points) {
           break;
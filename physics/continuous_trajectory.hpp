@@ -7,13 +7,17 @@
 #include <vector>
 
 #include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
 #include "base/not_null.hpp"
 #include "base/status.hpp"
 #include "geometry/named_quantities.hpp"
+#include "numerics/inline_polynomial.hpp"
 #include "numerics/polynomial.hpp"
+#include "numerics/polynomial_evaluators.hpp"
 #include "physics/checkpointer.hpp"
 #include "physics/degrees_of_freedom.hpp"
 #include "physics/trajectory.hpp"
+#include "quantities/named_quantities.hpp"
 #include "quantities/quantities.hpp"
 #include "serialization/physics.pb.h"
 
@@ -26,9 +30,13 @@ using base::Status;
 using geometry::Displacement;
 using geometry::Instant;
 using geometry::Position;
+using geometry::Vector;
 using geometry::Velocity;
+using quantities::Acceleration;
 using quantities::Length;
 using quantities::Time;
+using numerics::EstrinEvaluator;
+using numerics::InlinePolynomial;
 using numerics::Polynomial;
 
 template<typename Frame>
@@ -89,6 +97,17 @@ class ContinuousTrajectory : public Trajectory<Frame> {
 
   // End of the implementation of the interface.
 
+  // The second derivative of the fitted polynomials.  It differs from the
+  // acceleration given by the equations of motion by the error of the fit.
+  Vector<Acceleration, Frame> EvaluateAcceleration(Instant const& time) const
+      EXCLUDES(lock_);
+
+  // Equivalent to calling |EvaluatePosition| for each element of |times|, but
+  // faster because consecutive times that use the same polynomial are
+  // evaluated in a single call.  Most efficient if |times| is sorted.
+  std::vector<Position<Frame>> EvaluatePositions(
+      absl::Span<Instant const> times) const EXCLUDES(lock_);
+
   void WriteToMessage(not_null<serialization::ContinuousTrajectory*> message)
       const EXCLUDES(lock_);
   template<typename F = Frame,
@@ -111,19 +130,26 @@ class ContinuousTrajectory : public Trajectory<Frame> {
   ContinuousTrajectory();
 
  private:
+  // The degrees of the Newhall approximations.
+  static constexpr int min_degree = 3;
+  static constexpr int max_degree = 17;
+
+  // The polynomials are stored inline to avoid a virtual call and an
+  // indirection on each evaluation.
+  using DisplacementPolynomial = InlinePolynomial<Displacement<Frame>,
+                                                  Instant,
+                                                  max_degree,
+                                                  EstrinEvaluator>;
+
   // Each polynomial is valid over an interval [t_min, t_max].  Polynomials are
   // stored in this vector sorted by their |t_max|, as it turns out that we
   // never need to extract their |t_min|.  Logically, the |t_min| for a
   // polynomial is the |t_max| of the previous one.  The first polynomial has a
   // |t_min| which is |*first_time_|.
   struct InstantPolynomialPair {
-    InstantPolynomialPair(
-        Instant t_max,
-        not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
-            polynomial);
+    InstantPolynomialPair(Instant t_max, DisplacementPolynomial polynomial);
     Instant t_max;
-    not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
-        polynomial;
+    DisplacementPolynomial polynomial;
   };
   using InstantPolynomialPairs = std::vector<InstantPolynomialPair>;
 
@@ -131,8 +157,7 @@ class ContinuousTrajectory : public Trajectory<Frame> {
   Instant t_max_locked() const REQUIRES_SHARED(lock_);
 
   // Really a static method, but may be overridden for testing.
-  virtual not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
-  NewhallApproximationInMonomialBasis(
+  virtual DisplacementPolynomial NewhallApproximationInMonomialBasis(
       int degree,
       std::vector<Displacement<Frame>> const& q,
       std::vector<Velocity<Frame>> const& v,
@@ -24,7 +24,6 @@ namespace internal_continuous_trajectory {
 
 using base::Error;
 using base::make_not_null_unique;
-using numerics::EstrinEvaluator;
 using numerics::ULPDistance;
 using numerics::ЧебышёвSeries;
 using quantities::DebugString;
@@ -32,8 +31,6 @@ using quantities::SIUnit;
 using quantities::si::Metre;
 using quantities::si::Second;
 
-int const max_degree = 17;
-int const min_degree = 3;
 int const max_degree_age = 100;
 
 // Only supports 8 divisions for now.
@@ -83,7 +80,7 @@ double ContinuousTrajectory<Frame>::average_degree() const {
   } else {
     double total = 0;
     for (auto const& pair : polynomials_) {
-      total += pair.polynomial->degree();
+      total += pair.polynomial.degree();
     }
     return total / polynomials_.size();
   }
@@ -183,7 +180,7 @@ Position<Frame> ContinuousTrajectory<Frame>::EvaluatePosition(
   auto const it = FindPolynomialForInstant(time);
   CHECK(it != polynomials_.end());
   auto const& polynomial = it->polynomial;
-  return polynomial->Evaluate(time) + Frame::origin;
+  return polynomial.Evaluate(time) + Frame::origin;
 }
 
 template<typename Frame>
@@ -195,7 +192,19 @@ Velocity<Frame> ContinuousTrajectory<Frame>::EvaluateVelocity(
   auto const it = FindPolynomialForInstant(time);
   CHECK(it != polynomials_.end());
   auto const& polynomial = it->polynomial;
-  return polynomial->EvaluateDerivative(time);
+  return polynomial.EvaluateDerivative(time);
+}
+
+template<typename Frame>
+Vector<Acceleration, Frame> ContinuousTrajectory<Frame>::EvaluateAcceleration(
+    Instant const& time) const {
+  absl::ReaderMutexLock l(&lock_);
+  CHECK_LE(t_min_locked(), time);
+  CHECK_GE(t_max_locked(), time);
+  auto const it = FindPolynomialForInstant(time);
+  CHECK(it != polynomials_.end());
+  auto const& polynomial = it->polynomial;
+  return polynomial.EvaluateSecondDerivative(time);
 }
 
 template<typename Frame>
@@ -207,8 +216,39 @@ DegreesOfFreedom<Frame> ContinuousTrajectory<Frame>::EvaluateDegreesOfFreedom(
   auto const it = FindPolynomialForInstant(time);
   CHECK(it != polynomials_.end());
   auto const& polynomial = it->polynomial;
-  return DegreesOfFreedom<Frame>(polynomial->Evaluate(time) + Frame::origin,
-                                 polynomial->EvaluateDerivative(time));
+  Displacement<Frame> displacement;
+  Velocity<Frame> velocity;
+  polynomial.EvaluateWithDerivative(time, displacement, velocity);
+  return DegreesOfFreedom<Frame>(displacement + Frame::origin, velocity);
+}
+
+template<typename Frame>
+std::vector<Position<Frame>> ContinuousTrajectory<Frame>::EvaluatePositions(
+    absl::Span<Instant const> const times) const {
+  absl::ReaderMutexLock l(&lock_);
+  std::vector<Displacement<Frame>> displacements(times.size());
+  std::size_t i = 0;
+  while (i < times.size()) {
+    CHECK_LE(t_min_locked(), times[i]);
+    CHECK_GE(t_max_locked(), times[i]);
+    auto const it = FindPolynomialForInstant(times[i]);
+    CHECK(it != polynomials_.end());
+    // The times in [i, j[ are covered by the polynomial at |it|.
+    std::size_t j = i + 1;
+    while (j < times.size() && times[j] <= it->t_max &&
+           (it == polynomials_.begin() || std::prev(it)->t_max < times[j])) {
+      ++j;
+    }
+    it->polynomial.Evaluate(times.subspan(i, j - i),
+                            absl::MakeSpan(displacements).subspan(i, j - i));
+    i = j;
+  }
+  std::vector<Position<Frame>> positions;
+  positions.reserve(times.size());
+  for (auto const& displacement : displacements) {
+    positions.push_back(displacement + Frame::origin);
+  }
+  return positions;
 }
 
 template<typename Frame>
@@ -225,7 +265,7 @@ void ContinuousTrajectory<Frame>::WriteToMessage(
     if (t_max <= checkpoint_time) {
       auto* const pair = message->add_instant_polynomial_pair();
       t_max.WriteToMessage(pair->mutable_t_max());
-      polynomial->WriteToMessage(pair->mutable_polynomial());
+      polynomial.WriteToMessage(pair->mutable_polynomial());
     } else {
       break;
     }
@@ -255,12 +295,14 @@ ContinuousTrajectory<Frame>::ReadFromMessage(
           ЧебышёвSeries<Displacement<Frame>>::ReadFromMessage(s);
       Time const step = (series.t_max() - series.t_min()) / divisions;
       Instant t = series.t_min();
-      std::vector<Displacement<Frame>> q;
+      std::vector<Instant> times;
       std::vector<Velocity<Frame>> v;
       for (int i = 0; i <= divisions; t += step, ++i) {
-        q.push_back(series.Evaluate(t));
+        times.push_back(t);
         v.push_back(series.EvaluateDerivative(t));
       }
+      std::vector<Displacement<Frame>> q(times.size());
+      series.Evaluate(times, absl::MakeSpan(q));
       Displacement<Frame> error_estimate;  // Should we do something with this?
       continuous_trajectory->polynomials_.emplace_back(
           series.t_max(),
@@ -274,8 +316,7 @@ ContinuousTrajectory<Frame>::ReadFromMessage(
     for (auto const& pair : message.instant_polynomial_pair()) {
       continuous_trajectory->polynomials_.emplace_back(
           Instant::ReadFromMessage(pair.t_max()),
-          Polynomial<Displacement<Frame>, Instant>::template ReadFromMessage<
-              EstrinEvaluator>(pair.polynomial()));
+          DisplacementPolynomial::ReadFromMessage(pair.polynomial()));
     }
   }
   if (message.has_first_time()) {
@@ -348,8 +389,7 @@ ContinuousTrajectory<Frame>::ContinuousTrajectory()
 template<typename Frame>
 ContinuousTrajectory<Frame>::InstantPolynomialPair::InstantPolynomialPair(
     Instant const t_max,
-    not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
-        polynomial)
+    DisplacementPolynomial polynomial)
     : t_max(t_max),
       polynomial(std::move(polynomial)) {}
 
@@ -375,8 +415,15 @@ Instant ContinuousTrajectory<Frame>::t_max_locked() const {
   return polynomials_.crbegin()->t_max;
 }
 
+#define PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(degree) \
+  case (degree):                                                       \
+    return DisplacementPolynomial(                                     \
+        numerics::NewhallApproximationInMonomialBasis<                 \
+            Displacement<Frame>, (degree), EstrinEvaluator>(           \
+            q, v, t_min, t_max, error_estimate))
+
 template<typename Frame>
-not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
+typename ContinuousTrajectory<Frame>::DisplacementPolynomial
 ContinuousTrajectory<Frame>::NewhallApproximationInMonomialBasis(
     int degree,
     std::vector<Displacement<Frame>> const& q,
@@ -384,13 +431,31 @@ ContinuousTrajectory<Frame>::NewhallApproximationInMonomialBasis(
     Instant const& t_min,
     Instant const& t_max,
     Displacement<Frame>& error_estimate) const {
-  return numerics::NewhallApproximationInMonomialBasis<
-            Displacement<Frame>, EstrinEvaluator>(degree,
-                                                  q, v,
-                                                  t_min, t_max,
-                                                  error_estimate);
+  // Construct the polynomial of the right type directly, to avoid allocating.
+  switch (degree) {
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(3);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(4);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(5);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(6);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(7);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(8);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(9);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(10);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(11);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(12);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(13);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(14);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(15);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(16);
+    PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE(17);
+    default:
+      LOG(FATAL) << "Unexpected degree " << degree;
+      break;
+  }
 }
 
+#undef PRINCIPIA_NEWHALL_APPROXIMATION_IN_MONOMIAL_BASIS_CASE
+
 template<typename Frame>
 Status ContinuousTrajectory<Frame>::ComputeBestNewhallApproximation(
     Instant const& time,
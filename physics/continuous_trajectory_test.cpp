@@ -5,6 +5,7 @@
 #include <deque>
 #include <functional>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "geometry/frame.hpp"
@@ -34,10 +35,12 @@ using geometry::Displacement;
 using geometry::Frame;
 using geometry::Handedness;
 using geometry::Inertial;
+using geometry::Vector;
 using geometry::Velocity;
 using numerics::Polynomial;
 using numerics::PolynomialInMonomialBasis;
 using numerics::HornerEvaluator;
+using quantities::Acceleration;
 using quantities::Angle;
 using quantities::AngularFrequency;
 using quantities::Cos;
@@ -65,9 +68,10 @@ class TestableContinuousTrajectory : public ContinuousTrajectory<Frame> {
  public:
   using ContinuousTrajectory<Frame>::ContinuousTrajectory;
 
+  using typename ContinuousTrajectory<Frame>::DisplacementPolynomial;
+
   // Mock the Newhall factory.
-  not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
-  NewhallApproximationInMonomialBasis(
+  DisplacementPolynomial NewhallApproximationInMonomialBasis(
       int degree,
       std::vector<Displacement<Frame>> const& q,
       std::vector<Velocity<Frame>> const& v,
@@ -99,7 +103,7 @@ class TestableContinuousTrajectory : public ContinuousTrajectory<Frame> {
 };
 
 template<typename Frame>
-not_null<std::unique_ptr<Polynomial<Displacement<Frame>, Instant>>>
+typename TestableContinuousTrajectory<Frame>::DisplacementPolynomial
 TestableContinuousTrajectory<Frame>::NewhallApproximationInMonomialBasis(
     int degree,
     std::vector<Displacement<Frame>> const& q,
@@ -118,7 +122,7 @@ TestableContinuousTrajectory<Frame>::NewhallApproximationInMonomialBasis(
                                           t_min, t_max,
                                           error_estimate,
                                           polynomial);
-  return polynomial;
+  return DisplacementPolynomial(std::move(polynomial));
 }
 
 template<typename Frame>
@@ -479,6 +483,24 @@ TEST_F(ContinuousTrajectoryTest, Io) {
             io_ω * jupiter_io_distance * Cos(io_angle)) / Radian,
         0 * Metre / Second});
   };
+  auto acceleration_function = [this,
+                                sun_jupiter_distance,
+                                jupiter_io_distance,
+                                jupiter_period,
+                                io_period](Instant const t) {
+    AngularFrequency const jupiter_ω = 2 * π * Radian / jupiter_period;
+    AngularFrequency const io_ω = 2 * π * Radian / io_period;
+    Angle const jupiter_angle = jupiter_ω *(t - t0_);
+    Angle const io_angle = io_ω *(t - t0_);
+    return Vector<Acceleration, World>({
+        (-jupiter_ω * jupiter_ω * sun_jupiter_distance * Cos(jupiter_angle) -
+            io_ω * io_ω * jupiter_io_distance * Cos(io_angle)) /
+            (Radian * Radian),
+        (-jupiter_ω * jupiter_ω * sun_jupiter_distance * Sin(jupiter_angle) -
+            io_ω * io_ω * jupiter_io_distance * Sin(io_angle)) /
+            (Radian * Radian),
+        0 * Metre / Second / Second});
+  };
 
   auto const trajectory = std::make_unique<ContinuousTrajectory<World>>(
                               step,
@@ -498,6 +520,7 @@ TEST_F(ContinuousTrajectoryTest, Io) {
 
   Length max_position_absolute_error;
   Speed max_velocity_absolute_error;
+  Acceleration max_acceleration_absolute_error;
   for (Instant time = trajectory->t_min();
        time <= trajectory->t_max();
        time += step / number_of_substeps) {
@@ -506,15 +529,42 @@ TEST_F(ContinuousTrajectoryTest, Io) {
     Velocity<World> const actual_velocity =
         trajectory->EvaluateVelocity(time);
     Velocity<World> const expected_velocity = velocity_function(time);
+    Vector<Acceleration, World> const actual_acceleration =
+        trajectory->EvaluateAcceleration(time);
+    Vector<Acceleration, World> const expected_acceleration =
+        acceleration_function(time);
     max_position_absolute_error =
         std::max(max_position_absolute_error,
                  AbsoluteError(expected_position, actual_position));
     max_velocity_absolute_error =
         std::max(max_velocity_absolute_error,
                  AbsoluteError(expected_velocity, actual_velocity));
+    max_acceleration_absolute_error =
+        std::max(max_acceleration_absolute_error,
+                 AbsoluteError(expected_acceleration, actual_acceleration));
   }
   EXPECT_THAT(max_position_absolute_error, IsNear(31_⑴ * Milli(Metre)));
   EXPECT_THAT(max_velocity_absolute_error, IsNear(1.40e-5_⑴ * Metre / Second));
+  EXPECT_THAT(max_acceleration_absolute_error,
+              IsNear(6.1e-9_⑴ * Metre / Second / Second));
+
+  // The batch evaluation agrees with the evaluation at each time, whether or
+  // not the times are sorted.
+  std::vector<Instant> times;
+  for (Instant time = trajectory->t_min();
+       time <= trajectory->t_max();
+       time += step / number_of_substeps) {
+    times.push_back(time);
+  }
+  for (int i = 0; i < 2; ++i) {
+    std::vector<Position<World>> const positions =
+        trajectory->EvaluatePositions(times);
+    ASSERT_EQ(times.size(), positions.size());
+    for (int j = 0; j < times.size(); ++j) {
+      EXPECT_EQ(trajectory->EvaluatePosition(times[j]), positions[j]);
+    }
+    std::reverse(times.begin(), times.end());
+  }
 
   trajectory->ForgetBefore(trajectory->t_min() - step);
 
@@ -120,6 +120,11 @@ class BarycentreCalculator<physics::DegreesOfFreedom<Frame>, Weight> final {
 
   void Add(physics::DegreesOfFreedom<Frame> const& degrees_of_freedom,
            Weight const& weight);
+  // Equivalent to calling |Add| for each element, but the sums are computed
+  // by |PairwiseSum|.
+  void Add(
+      absl::Span<physics::DegreesOfFreedom<Frame> const> degrees_of_freedom,
+      absl::Span<Weight const> weights);
   physics::DegreesOfFreedom<Frame> Get() const;
 
   Weight const& weight() const;
@@ -113,6 +113,14 @@ void BarycentreCalculator<physics::DegreesOfFreedom<Frame>, Weight>::Add(
   implementation_.Add(degrees_of_freedom, weight);
 }
 
+template<typename Frame, typename Weight>
+void BarycentreCalculator<physics::DegreesOfFreedom<Frame>, Weight>::Add(
+    absl::Span<physics::DegreesOfFreedom<Frame> const> const
+        degrees_of_freedom,
+    absl::Span<Weight const> const weights) {
+  implementation_.Add(degrees_of_freedom, weights);
+}
+
 template<typename Frame, typename Weight>
 physics::DegreesOfFreedom<Frame>
 BarycentreCalculator<physics::DegreesOfFreedom<Frame>, Weight>::Get() const {
@@ -119,6 +119,24 @@ TEST_F(DegreesOfFreedomTest, Barycentre) {
                                       -50.0 * SIUnit<Speed>()}))));
 }
 
+TEST_F(DegreesOfFreedomTest, BulkBarycentreCalculator) {
+  BarycentreCalculator<DegreesOfFreedom<World>, double> calculator;
+  calculator.Add(d1_, 3);
+  std::vector<DegreesOfFreedom<World>> const degrees_of_freedom = {d2_, d3_};
+  std::vector<double> const weights = {4, 5};
+  calculator.Add(degrees_of_freedom, weights);
+  EXPECT_THAT(calculator.weight(), Eq(12));
+  EXPECT_THAT(calculator.Get(),
+              Componentwise(
+                  Eq(origin_ +
+                     Displacement<World>({(-4.0 / 3.0) * SIUnit<Length>(),
+                                          (13.0 / 6.0) * SIUnit<Length>(),
+                                          -1.0 * SIUnit<Length>()})),
+                  Eq(Velocity<World>({(-40.0 / 3.0) * SIUnit<Speed>(),
+                                      (-35.0 / 3.0) * SIUnit<Speed>(),
+                                      -50.0 * SIUnit<Speed>()}))));
+}
+
 TEST_F(DegreesOfFreedomTest, BarycentreCalculator) {
   BarycentreCalculator<DegreesOfFreedom<World>, double> calculator;
   calculator.Add(d1_, 3);
@@ -192,6 +192,9 @@ class DiscreteTrajectory : public Forkable<DiscreteTrajectory<Frame>,
  private:
   class Downsampling {
    public:
+    using DenseIterator =
+        typename std::vector<TimelineConstIterator>::const_iterator;
+
     Downsampling(std::int64_t max_dense_intervals,
                  Length tolerance,
                  TimelineConstIterator start_of_dense_timeline,
@@ -219,6 +222,11 @@ class DiscreteTrajectory : public Forkable<DiscreteTrajectory<Frame>,
 
     Length tolerance() const;
 
+    // Storage used by |Append| to downsample the dense timeline.  It is cleared
+    // before each use, and kept to reuse its capacity.
+    std::vector<TimelineConstIterator>& dense_iterators();
+    std::vector<DenseIterator>& right_endpoints();
+
     void WriteToMessage(
         not_null<serialization::DiscreteTrajectory::Downsampling*> message,
         Timeline const& timeline) const;
@@ -240,6 +248,8 @@ class DiscreteTrajectory : public Forkable<DiscreteTrajectory<Frame>,
     // an optimization for |Append| as it can be maintained by incrementing,
     // whereas |std::distance| is linear in the value of the result.
     std::int64_t dense_intervals_;
+    std::vector<TimelineConstIterator> dense_iterators_;
+    std::vector<DenseIterator> right_endpoints_;
   };
 
   // This trajectory need not be a root.
@@ -191,7 +191,8 @@ void DiscreteTrajectory<Frame>::Append(
       this->CheckNoForksBefore(this->back().time);
       downsampling_->increment_dense_intervals(timeline_);
       if (downsampling_->reached_max_dense_intervals()) {
-        std::vector<TimelineConstIterator> dense_iterators;
+        auto& dense_iterators = downsampling_->dense_iterators();
+        dense_iterators.clear();
         // This contains points, hence one more than intervals.
         dense_iterators.reserve(downsampling_->max_dense_intervals() + 1);
         for (TimelineConstIterator it =
@@ -200,12 +201,15 @@ void DiscreteTrajectory<Frame>::Append(
              ++it) {
           dense_iterators.push_back(it);
         }
-        auto right_endpoints = FitHermiteSpline<Instant, Position<Frame>>(
+        // |FitHermiteSpline| clears this vector.
+        auto& right_endpoints = downsampling_->right_endpoints();
+        FitHermiteSpline<Instant, Position<Frame>>(
             dense_iterators,
             [](auto&& it) -> auto&& { return it->first; },
             [](auto&& it) -> auto&& { return it->second.position(); },
             [](auto&& it) -> auto&& { return it->second.velocity(); },
-            downsampling_->tolerance());
+            downsampling_->tolerance(),
+            right_endpoints);
         if (right_endpoints.empty()) {
           right_endpoints.push_back(dense_iterators.end() - 1);
         }
@@ -456,6 +460,18 @@ Length DiscreteTrajectory<Frame>::Downsampling::tolerance() const {
   return tolerance_;
 }
 
+template<typename Frame>
+std::vector<typename DiscreteTrajectory<Frame>::TimelineConstIterator>&
+DiscreteTrajectory<Frame>::Downsampling::dense_iterators() {
+  return dense_iterators_;
+}
+
+template<typename Frame>
+std::vector<typename DiscreteTrajectory<Frame>::Downsampling::DenseIterator>&
+DiscreteTrajectory<Frame>::Downsampling::right_endpoints() {
+  return right_endpoints_;
+}
+
 template<typename Frame>
 void DiscreteTrajectory<Frame>::Downsampling::WriteToMessage(
     not_null<serialization::DiscreteTrajectory::Downsampling*> message,
@@ -1,10 +1,13 @@
 ﻿
 #pragma once
 
+#include <array>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "absl/synchronization/mutex.h"
@@ -12,6 +15,7 @@
 #include "base/status.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/named_quantities.hpp"
+#include "geometry/symmetric_bilinear_form.hpp"
 #include "google/protobuf/repeated_field.h"
 #include "integrators/integrators.hpp"
 #include "integrators/ordinary_differential_equations.hpp"
@@ -23,6 +27,7 @@
 #include "physics/massive_body.hpp"
 #include "physics/oblate_body.hpp"
 #include "physics/protector.hpp"
+#include "physics/state_transition_matrix.hpp"
 #include "serialization/ksp_plugin.pb.h"
 #include "serialization/numerics.pb.h"
 #include "serialization/physics.pb.h"
@@ -36,6 +41,7 @@ using base::not_null;
 using base::Status;
 using geometry::Instant;
 using geometry::Position;
+using geometry::SymmetricBilinearForm;
 using geometry::Vector;
 using integrators::AdaptiveStepSizeIntegrator;
 using integrators::ExplicitSecondOrderOrdinaryDifferentialEquation;
@@ -43,11 +49,20 @@ using integrators::FixedStepSizeIntegrator;
 using integrators::IntegrationProblem;
 using integrators::Integrator;
 using integrators::SpecialSecondOrderDifferentialEquation;
+using integrators::StepSizeController;
 using quantities::Acceleration;
+using quantities::Inverse;
 using quantities::Length;
 using quantities::Speed;
+using quantities::Square;
 using quantities::Time;
 
+// The numbers of massive bodies for which the equations of motion are
+// specialized at compile time, see |Ephemeris::has_fixed_size_specialization|.
+// Each number costs one instantiation per frame for a gain of about 1%, so only
+// the stock KSP system (17 bodies) is listed.
+using FixedSizeBodyCounts = std::index_sequence<17>;
+
 // Note on thread-safety: the integration functions (Prolong, FlowWithFixedStep,
 // FlowWithAdaptiveStep) can be called concurrently as long as their parameters
 // designated distinct objects.  No guarantee is offered for the other
@@ -71,12 +86,16 @@ class Ephemeris {
     std::int64_t max_steps() const;
     Length length_integration_tolerance() const;
     Speed speed_integration_tolerance() const;
+    StepSizeController const& step_size_controller() const;
 
     void set_max_steps(std::int64_t max_steps);
     void set_length_integration_tolerance(
         Length const& length_integration_tolerance);
     void set_speed_integration_tolerance(
         Speed const& speed_integration_tolerance);
+    // The default controller is elementary.
+    void set_step_size_controller(
+        StepSizeController const& step_size_controller);
 
     void WriteToMessage(
         not_null<serialization::Ephemeris::AdaptiveStepParameters*> const
@@ -90,6 +109,8 @@ class Ephemeris {
     std::int64_t max_steps_;
     Length length_integration_tolerance_;
     Speed speed_integration_tolerance_;
+    StepSizeController step_size_controller_ =
+        StepSizeController::Elementary();
     friend class Ephemeris<Frame>;
   };
 
@@ -97,6 +118,8 @@ class Ephemeris {
   using IntrinsicAcceleration =
       std::function<Vector<Acceleration, Frame>(Instant const& time)>;
   static std::nullptr_t constexpr NoIntrinsicAcceleration = nullptr;
+  using GravityGradient =
+      SymmetricBilinearForm<Inverse<Square<Time>>, Frame, Vector>;
   using GeneralizedIntrinsicAcceleration =
       std::function<Vector<Acceleration, Frame>(
           Instant const& time,
@@ -155,6 +178,26 @@ class Ephemeris {
     friend class Ephemeris<Frame>;
   };
 
+  // Parameters for the regularization of close approaches, see the overload
+  // of |FlowWithAdaptiveStep| that takes them.
+  class RegularizationParameters final {
+   public:
+    // The regularization is used within |radius_factor| times the mean radius
+    // of a body.  |integrator| is used in the regularized regions, with the
+    // other |AdaptiveStepParameters|.
+    RegularizationParameters(
+        AdaptiveStepSizeIntegrator<GeneralizedNewtonianMotionEquation> const&
+            integrator,
+        double radius_factor);
+
+   private:
+    // This will refer to a static object returned by a factory.
+    not_null<AdaptiveStepSizeIntegrator<
+        GeneralizedNewtonianMotionEquation> const*> integrator_;
+    double radius_factor_;
+    friend class Ephemeris<Frame>;
+  };
+
   // Constructs an Ephemeris that owns the |bodies|.  The elements of vectors
   // |bodies| and |initial_state| correspond to one another.
   Ephemeris(std::vector<not_null<std::unique_ptr<MassiveBody const>>>&& bodies,
@@ -183,8 +226,23 @@ class Ephemeris {
   virtual FixedStepSizeIntegrator<NewtonianMotionEquation> const&
   planetary_integrator() const;
 
+  // The step by which the ephemeris is prolonged.
+  virtual Time const& planetary_integrator_step() const;
+
   virtual Status last_severe_integration_status() const;
 
+  // True if the accelerations between the massive bodies are computed by code
+  // specialized for their number, which is the case if their number is in
+  // |FixedSizeBodyCounts| and none of them is oblate.  The
+  // specialization uses |std::array|s, which lets the compiler unroll the loop
+  // over the pairs of bodies.  It yields the same results as the generic code.
+  bool has_fixed_size_specialization() const;
+
+  // Forces the use of the generic code for the accelerations between the
+  // massive bodies.  Only useful for benchmarking or analyzing performance.  Do
+  // not use in real code.
+  void DisableFixedSizeSpecialization();
+
   // If the time |t| is not protected by a |Guard|, calls |ForgetBefore| on all
   // trajectories and returns true, after which |t_min() == t|.  If the time |t|
   // is protected by a |Guard|, returns false; the actual action is delayed
@@ -224,6 +282,54 @@ class Ephemeris {
       GeneralizedAdaptiveStepParameters const& parameters,
       std::int64_t max_ephemeris_steps) EXCLUDES(lock_);
 
+  // Same as the first overload, but also integrates the variational equations
+  // of the massless body.  On return, |*state_transition_matrix| holds the
+  // partial derivatives of the degrees of freedom at the end of |trajectory|
+  // with respect to those at its end on entry.  The |intrinsic_acceleration|
+  // only depends on time and therefore doesn't contribute to the variational
+  // equations.  The variational equations do not take part in step size
+  // control.
+  virtual Status FlowWithAdaptiveStep(
+      not_null<DiscreteTrajectory<Frame>*> trajectory,
+      IntrinsicAcceleration intrinsic_acceleration,
+      Instant const& t,
+      AdaptiveStepParameters const& parameters,
+      std::int64_t max_ephemeris_steps,
+      not_null<StateTransitionMatrix<Frame>*> state_transition_matrix)
+      EXCLUDES(lock_);
+
+  // Same as the first overload, but the motion near a massive body is
+  // regularized using a Sundman transformation dt = (r / r₀) ds, where r is the
+  // distance to the body and r₀ the radius within which the regularization is
+  // used.  The integrator then takes steps of nearly uniform length in the
+  // fictitious time s, which are short in physical time near periapsis, so
+  // close approaches don't require tiny steps or repeated step rejections.
+  // The formulation is switched in and out automatically; the |trajectory| is
+  // always in physical time.
+  virtual Status FlowWithAdaptiveStep(
+      not_null<DiscreteTrajectory<Frame>*> trajectory,
+      IntrinsicAcceleration intrinsic_acceleration,
+      Instant const& t,
+      AdaptiveStepParameters const& parameters,
+      RegularizationParameters const& regularization_parameters,
+      std::int64_t max_ephemeris_steps) EXCLUDES(lock_);
+
+  // Same as the first overload of |FlowWithAdaptiveStep|, but uses Encke's
+  // method: the integrator only sees the deviation of the trajectory from an
+  // osculating Keplerian orbit about the body whose attraction dominates at
+  // the beginning of the flow.  The reference orbit is rectified, and the
+  // dominant body selected anew, when the deviation becomes large compared to
+  // the distance to that body.  This is much cheaper than the first overload
+  // for a trajectory that is close to a conic, e.g., a vessel in a parking
+  // orbit, because the step size is then limited by the perturbations instead
+  // of by the Keplerian motion.
+  virtual Status FlowWithAdaptiveStepUsingEnckeMethod(
+      not_null<DiscreteTrajectory<Frame>*> trajectory,
+      IntrinsicAcceleration intrinsic_acceleration,
+      Instant const& t,
+      AdaptiveStepParameters const& parameters,
+      std::int64_t max_ephemeris_steps) EXCLUDES(lock_);
+
   // Integrates, until at most |t|, the trajectories followed by massless
   // bodies in the gravitational potential described by |*this|.  If
   // |t > t_max()|, calls |Prolong(t)| beforehand.  The trajectories and
@@ -248,6 +354,13 @@ class Ephemeris {
       not_null<DiscreteTrajectory<Frame>*> trajectory,
       Instant const& t) const EXCLUDES(lock_);
 
+  // Returns the gravity-gradient tensor, i.e., the gradient of the
+  // gravitational acceleration with respect to position, at the given
+  // |position| at time |t|.
+  virtual GravityGradient ComputeGravityGradientOnMasslessBody(
+      Position<Frame> const& position,
+      Instant const& t) const EXCLUDES(lock_);
+
   // Returns the gravitational acceleration on the massive |body| at time |t|.
   // |body| must be one of the bodies of this object.
   virtual Vector<Acceleration, Frame>
@@ -365,6 +478,17 @@ class Ephemeris {
       std::vector<Vector<Acceleration, Frame>>& accelerations) const
       REQUIRES_SHARED(lock_);
 
+  // Adds to |gravity_gradient| the gravity-gradient tensor at |position| due
+  // to |body1| (with index |b1| in the |bodies_| and |trajectories_| arrays).
+  template<bool body1_is_oblate>
+  void ComputeGravityGradientByMassiveBodyOnMasslessBody(
+      Instant const& t,
+      MassiveBody const& body1,
+      std::size_t const b1,
+      Position<Frame> const& position,
+      GravityGradient& gravity_gradient) const
+      REQUIRES_SHARED(lock_);
+
   // Computes the accelerations between all the massive bodies in |bodies_|.
   void ComputeMassiveBodiesGravitationalAccelerations(
       Instant const& t,
@@ -372,6 +496,33 @@ class Ephemeris {
       std::vector<Vector<Acceleration, Frame>>& accelerations) const
       REQUIRES_SHARED(lock_);
 
+  // Same as above, but specialized for |size| spherical bodies.  The state is
+  // copied to |std::array|s so that all the loops have constant bounds.
+  template<std::size_t size>
+  void ComputeSphericalMassiveBodiesGravitationalAccelerations(
+      Instant const& t,
+      std::vector<Position<Frame>> const& positions,
+      std::vector<Vector<Acceleration, Frame>>& accelerations) const
+      REQUIRES_SHARED(lock_);
+
+  using MassiveBodiesGravitationalAccelerationsComputation =
+      void (Ephemeris::*)(
+          Instant const& t,
+          std::vector<Position<Frame>> const& positions,
+          std::vector<Vector<Acceleration, Frame>>& accelerations) const;
+
+  // Returns the specializations above for the given numbers of bodies, each
+  // paired with its number of bodies.
+  template<std::size_t... sizes>
+  static constexpr std::array<
+      std::pair<int, MassiveBodiesGravitationalAccelerationsComputation>,
+      sizeof...(sizes)>
+  MakeFixedSizeSpecializations(std::index_sequence<sizes...>);
+
+  // Sets |compute_massive_bodies_gravitational_accelerations_| based on the
+  // bodies.  Must be called once |bodies_| has been filled.
+  void SelectMassiveBodiesGravitationalAccelerationsComputation();
+
   // Computes the acceleration exerted by the massive bodies in |bodies_| on
   // massless bodies.  The massless bodies are at the given |positions|.
   // Returns false iff a collision occurred, i.e., the massless body is inside
@@ -382,6 +533,20 @@ class Ephemeris {
       std::vector<Vector<Acceleration, Frame>>& accelerations) const
       EXCLUDES(lock_);
 
+  // Returns the index in |bodies_| of the body closest to |position| at time
+  // |t|, relative to its regularization radius, i.e., |radius_factor| times its
+  // mean radius.  Returns nullopt if |position| is outside of all the
+  // regularization radii.
+  std::optional<int> RegularizingBodyIndex(Position<Frame> const& position,
+                                           Instant const& t,
+                                           double radius_factor) const
+      EXCLUDES(lock_);
+
+  // Returns the index in |bodies_| of the body whose point-mass attraction on a
+  // massless body located at |position| is the strongest at time |t|.
+  int DominantBodyIndex(Position<Frame> const& position,
+                        Instant const& t) const EXCLUDES(lock_);
+
   // Flows the given ODE with an adaptive step integrator.
   template<typename ODE>
   Status FlowODEWithAdaptiveStep(
@@ -391,6 +556,19 @@ class Ephemeris {
       ODEAdaptiveStepParameters<ODE> const& parameters,
       std::int64_t max_ephemeris_steps) EXCLUDES(lock_);
 
+  // Prolongs the ephemeris so that a trajectory whose last point is at
+  // |trajectory_last_time| may be flowed towards |t|.  Returns the time at
+  // which the flow must stop.
+  Instant ProlongForFlow(Instant const& trajectory_last_time,
+                         Instant const& t,
+                         std::int64_t max_ephemeris_steps) EXCLUDES(lock_);
+
+  // Returns the status of a flow requested until |t| that stopped at |t_final|
+  // with the given |status|.
+  static Status FlowStatus(Status status,
+                           Instant const& t_final,
+                           Instant const& t);
+
   // Computes an estimate of the ratio |tolerance / error|.
   static double ToleranceToErrorRatio(
       Length const& length_integration_tolerance,
@@ -424,6 +602,12 @@ class Ephemeris {
   int number_of_oblate_bodies_ = 0;
   int number_of_spherical_bodies_ = 0;
 
+  // The function used by |instance_| to compute the accelerations between the
+  // massive bodies.
+  MassiveBodiesGravitationalAccelerationsComputation
+      compute_massive_bodies_gravitational_accelerations_ =
+          &Ephemeris::ComputeMassiveBodiesGravitationalAccelerations;
+
   not_null<
       std::unique_ptr<Checkpointer<serialization::Ephemeris>>> checkpointer_;
   not_null<std::unique_ptr<Protector>> protector_;
@@ -4,10 +4,13 @@
 #include "physics/ephemeris.hpp"
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <limits>
 #include <optional>
 #include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "astronomy/epoch.hpp"
@@ -16,10 +19,14 @@
 #include "base/not_null.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/r3_element.hpp"
+#include "geometry/r3x3_matrix.hpp"
+#include "geometry/symmetric_bilinear_form.hpp"
 #include "integrators/integrators.hpp"
 #include "integrators/ordinary_differential_equations.hpp"
 #include "numerics/hermite3.hpp"
 #include "physics/continuous_trajectory.hpp"
+#include "physics/kepler_orbit.hpp"
+#include "physics/massless_body.hpp"
 #include "quantities/elementary_functions.hpp"
 #include "quantities/named_quantities.hpp"
 #include "quantities/quantities.hpp"
@@ -30,6 +37,7 @@ namespace physics {
 namespace internal_ephemeris {
 
 using astronomy::J2000;
+using base::check_not_null;
 using base::dynamic_cast_not_null;
 using base::Error;
 using base::FindOrDie;
@@ -37,21 +45,27 @@ using base::make_not_null_unique;
 using geometry::Barycentre;
 using geometry::Displacement;
 using geometry::InnerProduct;
+using geometry::InnerProductForm;
 using geometry::Position;
 using geometry::R3Element;
+using geometry::R3x3Matrix;
 using geometry::Sign;
+using geometry::SymmetricProduct;
 using geometry::Velocity;
 using integrators::EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator;
 using integrators::ExplicitSecondOrderOrdinaryDifferentialEquation;
 using integrators::IntegrationProblem;
 using integrators::Integrator;
 using integrators::methods::Fine1987RKNG34;
-using numerics::Bisect;
+using integrators::termination_condition::ReachedMaximalStepCount;
+using numerics::Brent;
 using numerics::DoublePrecision;
 using numerics::Hermite3;
 using quantities::Abs;
 using quantities::Exponentiation;
+using quantities::Frequency;
 using quantities::GravitationalParameter;
+using quantities::Pow;
 using quantities::Quotient;
 using quantities::Sqrt;
 using quantities::Square;
@@ -71,6 +85,14 @@ constexpr Time max_time_between_checkpoints = 180 * Day;
 // Below this threshold detect a collision to prevent the integrator and the
 // downsampling from going postal.
 constexpr double min_radius_tolerance = 0.99;
+// The flows that change their formulation during the integration (Encke's
+// method, regularization) may only do so between calls to |Solve|, since the
+// integrators cannot be interrupted.  They check whether they need to do so
+// every |steps_between_reformulation_checks| steps.
+constexpr std::int64_t steps_between_reformulation_checks = 16;
+// In Encke's method, the reference orbit is rectified when the deviation
+// exceeds this fraction of the distance to the dominant body.
+constexpr double encke_rectification_threshold = 1e-3;
 
 inline Status const CollisionDetected() {
   return Status(Error::OUT_OF_RANGE, "Collision detected");
@@ -120,6 +142,13 @@ speed_integration_tolerance() const {
   return speed_integration_tolerance_;
 }
 
+template<typename Frame>
+template<typename ODE>
+StepSizeController const&
+Ephemeris<Frame>::ODEAdaptiveStepParameters<ODE>::step_size_controller() const {
+  return step_size_controller_;
+}
+
 template<typename Frame>
 template<typename ODE>
 void Ephemeris<Frame>::ODEAdaptiveStepParameters<ODE>::set_max_steps(
@@ -142,6 +171,13 @@ set_speed_integration_tolerance(Speed const& speed_integration_tolerance) {
   speed_integration_tolerance_ = speed_integration_tolerance;
 }
 
+template<typename Frame>
+template<typename ODE>
+void Ephemeris<Frame>::ODEAdaptiveStepParameters<ODE>::
+set_step_size_controller(StepSizeController const& step_size_controller) {
+  step_size_controller_ = step_size_controller;
+}
+
 template<typename Frame>
 template<typename ODE>
 void Ephemeris<Frame>::ODEAdaptiveStepParameters<ODE>::WriteToMessage(
@@ -153,6 +189,8 @@ void Ephemeris<Frame>::ODEAdaptiveStepParameters<ODE>::WriteToMessage(
       message->mutable_length_integration_tolerance());
   speed_integration_tolerance_.WriteToMessage(
       message->mutable_speed_integration_tolerance());
+  step_size_controller_.WriteToMessage(
+      message->mutable_step_size_controller());
 }
 
 template<typename Frame>
@@ -160,11 +198,17 @@ template<typename ODE>
 typename Ephemeris<Frame>::template ODEAdaptiveStepParameters<ODE>
 Ephemeris<Frame>::ODEAdaptiveStepParameters<ODE>::ReadFromMessage(
     serialization::Ephemeris::AdaptiveStepParameters const& message) {
-  return ODEAdaptiveStepParameters(
+  bool const is_pre_frenet = !message.has_step_size_controller();
+  ODEAdaptiveStepParameters result(
       AdaptiveStepSizeIntegrator<ODE>::ReadFromMessage(message.integrator()),
       message.max_steps(),
       Length::ReadFromMessage(message.length_integration_tolerance()),
       Speed::ReadFromMessage(message.speed_integration_tolerance()));
+  if (!is_pre_frenet) {
+    result.set_step_size_controller(
+        StepSizeController::ReadFromMessage(message.step_size_controller()));
+  }
+  return result;
 }
 
 template<typename Frame>
@@ -223,6 +267,16 @@ Ephemeris<Frame>::FixedStepParameters::ReadFromMessage(
       Time::ReadFromMessage(message.step()));
 }
 
+template<typename Frame>
+Ephemeris<Frame>::RegularizationParameters::RegularizationParameters(
+    AdaptiveStepSizeIntegrator<GeneralizedNewtonianMotionEquation> const&
+        integrator,
+    double const radius_factor)
+    : integrator_(&integrator),
+      radius_factor_(radius_factor) {
+  CHECK_LT(0, radius_factor);
+}
+
 template<typename Frame>
 Ephemeris<Frame>::Ephemeris(
     std::vector<not_null<std::unique_ptr<MassiveBody const>>>&& bodies,
@@ -248,9 +302,8 @@ Ephemeris<Frame>::Ephemeris(
       Instant const& t,
       std::vector<Position<Frame>> const& positions,
       std::vector<Vector<Acceleration, Frame>>& accelerations) {
-    ComputeMassiveBodiesGravitationalAccelerations(t,
-                                                   positions,
-                                                   accelerations);
+    (this->*compute_massive_bodies_gravitational_accelerations_)(
+        t, positions, accelerations);
     return Status::OK;
   };
 
@@ -296,6 +349,8 @@ Ephemeris<Frame>::Ephemeris(
     }
   }
 
+  SelectMassiveBodiesGravitationalAccelerationsComputation();
+
   absl::ReaderMutexLock l(&lock_);  // For locking checks.
   instance_ = fixed_step_parameters_.integrator_->NewInstance(
       problem,
@@ -348,12 +403,29 @@ Ephemeris<Frame>::planetary_integrator() const {
   return *fixed_step_parameters_.integrator_;
 }
 
+template<typename Frame>
+Time const& Ephemeris<Frame>::planetary_integrator_step() const {
+  return fixed_step_parameters_.step_;
+}
+
 template<typename Frame>
 Status Ephemeris<Frame>::last_severe_integration_status() const {
   absl::ReaderMutexLock l(&lock_);
   return last_severe_integration_status_;
 }
 
+template<typename Frame>
+bool Ephemeris<Frame>::has_fixed_size_specialization() const {
+  return compute_massive_bodies_gravitational_accelerations_ !=
+         &Ephemeris::ComputeMassiveBodiesGravitationalAccelerations;
+}
+
+template<typename Frame>
+void Ephemeris<Frame>::DisableFixedSizeSpecialization() {
+  compute_massive_bodies_gravitational_accelerations_ =
+      &Ephemeris::ComputeMassiveBodiesGravitationalAccelerations;
+}
+
 template<typename Frame>
 bool Ephemeris<Frame>::EventuallyForgetBefore(Instant const& t) {
   auto forget_before_t = [this, t]() {
@@ -511,6 +583,624 @@ Status Ephemeris<Frame>::FlowWithAdaptiveStep(
              max_ephemeris_steps);
 }
 
+template<typename Frame>
+Status Ephemeris<Frame>::FlowWithAdaptiveStep(
+    not_null<DiscreteTrajectory<Frame>*> const trajectory,
+    IntrinsicAcceleration intrinsic_acceleration,
+    Instant const& t,
+    AdaptiveStepParameters const& parameters,
+    std::int64_t const max_ephemeris_steps,
+    not_null<StateTransitionMatrix<Frame>*> const state_transition_matrix) {
+  *state_transition_matrix = StateTransitionMatrix<Frame>();
+  Instant const& trajectory_last_time = trajectory->back().time;
+  if (trajectory_last_time == t) {
+    return Status::OK;
+  }
+
+  std::vector<not_null<DiscreteTrajectory<Frame>*>> const trajectories =
+      {trajectory};
+  Instant const t_final =
+      ProlongForFlow(trajectory_last_time, t, max_ephemeris_steps);
+
+  // The variational equations δq″ = ∇g(q) δq are linear, so we integrate them
+  // for 6 unit variations of the initial degrees of freedom, namely 1 m along
+  // each axis of |Frame| for the position and 1 m/s along each axis for the
+  // velocity.  The variations are represented as positions relative to the
+  // origin of |Frame| and follow the body in the system state, so that the
+  // integrator computes them in lockstep with the trajectory.
+  constexpr int variations = 6;
+  Length const unit_length = 1 * Metre;
+  Speed const unit_speed = 1 * Metre / Second;
+  std::array<Vector<double, Frame>, 3> const basis = {
+      Vector<double, Frame>({1, 0, 0}),
+      Vector<double, Frame>({0, 1, 0}),
+      Vector<double, Frame>({0, 0, 1})};
+
+  IntegrationProblem<NewtonianMotionEquation> problem;
+  auto const trajectory_back = trajectory->back();
+  auto const last_degrees_of_freedom = trajectory_back.degrees_of_freedom;
+  std::vector<Position<Frame>> initial_positions = {
+      last_degrees_of_freedom.position()};
+  std::vector<Velocity<Frame>> initial_velocities = {
+      last_degrees_of_freedom.velocity()};
+  for (auto const& e : basis) {
+    initial_positions.push_back(Frame::origin + unit_length * e);
+    initial_velocities.push_back(Velocity<Frame>());
+  }
+  for (int i = 0; i < 3; ++i) {
+    initial_positions.push_back(Frame::origin);
+    initial_velocities.push_back(unit_speed * basis[i]);
+  }
+  problem.initial_state = {
+      initial_positions, initial_velocities, trajectory_back.time};
+
+  // Buffers for the acceleration of the body alone, since the variations must
+  // not be subjected to gravity.
+  std::vector<Position<Frame>> body_positions(1);
+  std::vector<Vector<Acceleration, Frame>> body_accelerations(1);
+  problem.equation.compute_acceleration =
+      [this, &intrinsic_acceleration, &body_positions, &body_accelerations](
+          Instant const& t,
+          std::vector<Position<Frame>> const& positions,
+          std::vector<Vector<Acceleration, Frame>>& accelerations) {
+        body_positions[0] = positions[0];
+        Error const error =
+            ComputeMasslessBodiesGravitationalAccelerations(
+                t, body_positions, body_accelerations);
+        accelerations[0] = body_accelerations[0];
+        if (intrinsic_acceleration != nullptr) {
+          accelerations[0] += intrinsic_acceleration(t);
+        }
+        GravityGradient const gravity_gradient =
+            ComputeGravityGradientOnMasslessBody(positions[0], t);
+        for (int i = 1; i < positions.size(); ++i) {
+          accelerations[i] = gravity_gradient * (positions[i] - Frame::origin);
+        }
+        return error == Error::OK ? Status::OK : CollisionDetected();
+      };
+
+  typename AdaptiveStepSizeIntegrator<NewtonianMotionEquation>::Parameters const
+      integrator_parameters(
+          /*first_time_step=*/t_final - problem.initial_state.time.value,
+          /*safety_factor=*/0.9,
+          parameters.max_steps_,
+          /*last_step_is_exact=*/true,
+          parameters.step_size_controller_);
+  CHECK_GT(integrator_parameters.first_time_step, 0 * Second)
+      << "Flow back to the future: " << t_final
+      << " <= " << problem.initial_state.time.value;
+
+  // Only the body takes part in the step size control: the variations are
+  // computed with the steps that achieve the desired accuracy on the
+  // trajectory.
+  auto const tolerance_to_error_ratio =
+      [&parameters](
+          Time const& current_step_size,
+          typename NewtonianMotionEquation::SystemStateError const& error) {
+        return std::min(parameters.length_integration_tolerance_ /
+                            error.position_error[0].Norm(),
+                        parameters.speed_integration_tolerance_ /
+                            error.velocity_error[0].Norm());
+      };
+
+  // The last state appended is the state at the end of the flow.
+  std::vector<Displacement<Frame>> final_position_variations(variations);
+  std::vector<Velocity<Frame>> final_velocity_variations(variations);
+  auto const append_state =
+      [&trajectories, &final_position_variations, &final_velocity_variations](
+          typename NewtonianMotionEquation::SystemState const& state) {
+        AppendMasslessBodiesState(state, trajectories);
+        for (int i = 0; i < final_position_variations.size(); ++i) {
+          final_position_variations[i] =
+              state.positions[i + 1].value - Frame::origin;
+          final_velocity_variations[i] = state.velocities[i + 1].value;
+        }
+      };
+
+  auto const instance =
+      parameters.integrator_->NewInstance(problem,
+                                          append_state,
+                                          tolerance_to_error_ratio,
+                                          integrator_parameters);
+  Status const status = instance->Solve(t_final);
+
+  // Column j of each block is the response to the unit variation along the
+  // j-th axis.
+  R3x3Matrix<double> position_wrt_position;
+  R3x3Matrix<Time> position_wrt_velocity;
+  R3x3Matrix<Frequency> velocity_wrt_position;
+  R3x3Matrix<double> velocity_wrt_velocity;
+  for (int j = 0; j < 3; ++j) {
+    auto const δq_δq₀ =
+        final_position_variations[j].coordinates() / unit_length;
+    auto const δq_δv₀ =
+        final_position_variations[j + 3].coordinates() / unit_speed;
+    auto const δv_δq₀ =
+        final_velocity_variations[j].coordinates() / unit_length;
+    auto const δv_δv₀ =
+        final_velocity_variations[j + 3].coordinates() / unit_speed;
+    for (int i = 0; i < 3; ++i) {
+      position_wrt_position(i, j) = δq_δq₀[i];
+      position_wrt_velocity(i, j) = δq_δv₀[i];
+      velocity_wrt_position(i, j) = δv_δq₀[i];
+      velocity_wrt_velocity(i, j) = δv_δv₀[i];
+    }
+  }
+  *state_transition_matrix =
+      StateTransitionMatrix<Frame>(position_wrt_position,
+                                   position_wrt_velocity,
+                                   velocity_wrt_position,
+                                   velocity_wrt_velocity);
+
+  return FlowStatus(status, t_final, t);
+}
+
+template<typename Frame>
+Status Ephemeris<Frame>::FlowWithAdaptiveStep(
+    not_null<DiscreteTrajectory<Frame>*> const trajectory,
+    IntrinsicAcceleration intrinsic_acceleration,
+    Instant const& t,
+    AdaptiveStepParameters const& parameters,
+    RegularizationParameters const& regularization_parameters,
+    std::int64_t const max_ephemeris_steps) {
+  Instant const& trajectory_last_time = trajectory->back().time;
+  if (trajectory_last_time == t) {
+    return Status::OK;
+  }
+
+  std::vector<not_null<DiscreteTrajectory<Frame>*>> const trajectories =
+      {trajectory};
+  Instant const t_final =
+      ProlongForFlow(trajectory_last_time, t, max_ephemeris_steps);
+
+  auto const tolerance_to_error_ratio =
+      std::bind(&Ephemeris<Frame>::ToleranceToErrorRatio,
+                std::cref(parameters.length_integration_tolerance_),
+                std::cref(parameters.speed_integration_tolerance_),
+                _1, _2);
+
+  // The number of steps taken so far, and the physical time of the point
+  // before the last one, which gives the step size to use when switching
+  // formulations.
+  std::int64_t steps = 0;
+  Instant penultimate_time = trajectory_last_time;
+
+  // The unregularized equation, as in the first overload.
+  std::vector<Position<Frame>> body_positions(1);
+  std::vector<Vector<Acceleration, Frame>> body_accelerations(1);
+  auto const compute_acceleration =
+      [this, &intrinsic_acceleration](
+          Instant const& t,
+          std::vector<Position<Frame>> const& positions,
+          std::vector<Vector<Acceleration, Frame>>& accelerations) {
+        Error const error =
+            ComputeMasslessBodiesGravitationalAccelerations(t,
+                                                            positions,
+                                                            accelerations);
+        if (intrinsic_acceleration != nullptr) {
+          accelerations[0] += intrinsic_acceleration(t);
+        }
+        return error == Error::OK ? Status::OK : CollisionDetected();
+      };
+  auto const append_state =
+      [&trajectories, &steps, &penultimate_time](
+          typename NewtonianMotionEquation::SystemState const& state) {
+        ++steps;
+        penultimate_time = trajectories[0]->back().time;
+        AppendMasslessBodiesState(state, trajectories);
+      };
+
+  // The regularized equation.  The independent variable is the fictitious
+  // time s, which coincides with the physical time at the beginning of a
+  // regularized segment.  The first entry of the state is the position ρ of
+  // the massless body relative to the regularizing body, represented as a
+  // position relative to the origin of |Frame|, and its derivative
+  // ρʹ = (r / r₀) ρ̇.  The equation of motion is
+  //   ρʺ = (r / r₀)² (γ - γᴮ) + (rʹ / r) ρʹ,
+  // where γ and γᴮ are the physical accelerations of the massless body and of
+  // the regularizing body, and rʹ = ρ · ρʹ / r.  The second entry carries the
+  // physical time t, as a position τ = c (t - t₀) along the first axis of
+  // |Frame|, so that it takes part in the step size control; τʺ = c rʹ / r₀.
+  // We choose for c the speed that the massless body would reach at the
+  // surface of the body on a Keplerian orbit, so that an error on τ translates
+  // into an error of at most the same magnitude on the position.
+  MassiveBody const* regularizing_body = nullptr;
+  ContinuousTrajectory<Frame> const* regularizing_body_trajectory = nullptr;
+  Length r₀;
+  Speed c;
+  Instant t₀;
+  // Set when the regularized integration goes past |t_final|, in which case it
+  // stops, and the end of the flow, which is shorter than one step, is
+  // integrated without regularization.
+  bool overshot = false;
+  auto const physical_time = [&c, &t₀](Position<Frame> const& τ) {
+    return t₀ + (τ - Frame::origin).coordinates().x / c;
+  };
+  auto const compute_regularized_acceleration =
+      [this,
+       &intrinsic_acceleration,
+       &body_positions,
+       &body_accelerations,
+       &regularizing_body_trajectory,
+       t_final,
+       &r₀,
+       &c,
+       &overshot,
+       &physical_time](
+          Instant const& s,
+          std::vector<Position<Frame>> const& positions,
+          std::vector<Velocity<Frame>> const& velocities,
+          std::vector<Vector<Acceleration, Frame>>& accelerations) {
+        Instant const t = physical_time(positions[1]);
+        if (t > t_final) {
+          // The ephemeris may not be known past |t_final|.  The regularized
+          // integration stops after this step and drops its point, so it
+          // doesn't matter what accelerations we use for it.
+          overshot = true;
+          accelerations[0] = Vector<Acceleration, Frame>();
+          accelerations[1] = Vector<Acceleration, Frame>();
+          return Status::OK;
+        }
+        Displacement<Frame> const ρ = positions[0] - Frame::origin;
+        Velocity<Frame> const& ρʹ = velocities[0];
+        Length const r = ρ.Norm();
+        Speed const rʹ = InnerProduct(ρ, ρʹ) / r;
+        body_positions[0] =
+            regularizing_body_trajectory->EvaluatePosition(t) + ρ;
+        Error const error =
+            ComputeMasslessBodiesGravitationalAccelerations(
+                t, body_positions, body_accelerations);
+        // As in |FlowWithAdaptiveStepUsingEnckeMethod|, the acceleration of the
+        // regularizing body is taken from its fitted trajectory, like its
+        // position.
+        Vector<Acceleration, Frame> γ =
+            body_accelerations[0] -
+            regularizing_body_trajectory->EvaluateAcceleration(t);
+        if (intrinsic_acceleration != nullptr) {
+          γ += intrinsic_acceleration(t);
+        }
+        double const r_over_r₀ = r / r₀;
+        accelerations[0] = r_over_r₀ * r_over_r₀ * γ + (rʹ / r) * ρʹ;
+        accelerations[1] = Vector<Acceleration, Frame>(
+            {c * rʹ / r₀, Acceleration(), Acceleration()});
+        return error == Error::OK ? Status::OK : CollisionDetected();
+      };
+  auto const append_regularized_state =
+      [trajectory,
+       t_final,
+       &steps,
+       &penultimate_time,
+       &regularizing_body_trajectory,
+       &r₀,
+       &overshot,
+       &physical_time](
+          typename GeneralizedNewtonianMotionEquation::SystemState const&
+              state) {
+        ++steps;
+        Instant const t = physical_time(state.positions[1].value);
+        if (overshot || t > t_final) {
+          overshot = true;
+          return;
+        }
+        Displacement<Frame> const ρ = state.positions[0].value - Frame::origin;
+        Length const r = ρ.Norm();
+        penultimate_time = trajectory->back().time;
+        trajectory->Append(
+            t,
+            regularizing_body_trajectory->EvaluateDegreesOfFreedom(t) +
+                RelativeDegreesOfFreedom<Frame>(
+                    ρ, (r₀ / r) * state.velocities[0].value));
+      };
+
+  // The step size and the controller history with which to continue an
+  // unregularized integration that stopped to check whether to regularize.
+  std::optional<Time> unregularized_time_step;
+  StepSizeController unregularized_step_size_controller =
+      parameters.step_size_controller_;
+
+  for (;;) {
+    auto const trajectory_back = trajectory->back();
+    Instant const& t_initial = trajectory_back.time;
+    if (t_initial == t_final) {
+      return FlowStatus(Status::OK, t_final, t);
+    }
+    if (steps == parameters.max_steps_) {
+      return Status(ReachedMaximalStepCount,
+                    "Reached maximum step count " +
+                        std::to_string(parameters.max_steps_) +
+                        " at time " + DebugString(t_initial) +
+                        "; requested t_final is " + DebugString(t_final) +
+                        ".");
+    }
+    Time const last_step = t_initial == trajectory_last_time
+                               ? t_final - t_initial
+                               : t_initial - penultimate_time;
+
+    std::optional<int> const b =
+        overshot ? std::nullopt
+                 : RegularizingBodyIndex(
+                       trajectory_back.degrees_of_freedom.position(),
+                       t_initial,
+                       regularization_parameters.radius_factor_);
+    if (!b.has_value()) {
+      IntegrationProblem<NewtonianMotionEquation> problem;
+      problem.equation.compute_acceleration = compute_acceleration;
+      problem.initial_state = {{trajectory_back.degrees_of_freedom.position()},
+                               {trajectory_back.degrees_of_freedom.velocity()},
+                               t_initial};
+      typename AdaptiveStepSizeIntegrator<
+          NewtonianMotionEquation>::Parameters const
+          integrator_parameters(
+              /*first_time_step=*/unregularized_time_step.value_or(
+                  std::min(last_step, t_final - t_initial)),
+              /*safety_factor=*/0.9,
+              /*max_steps=*/std::min(parameters.max_steps_ - steps,
+                                     steps_between_reformulation_checks),
+              /*last_step_is_exact=*/true,
+              unregularized_step_size_controller);
+      auto const instance =
+          parameters.integrator_->NewInstance(problem,
+                                              append_state,
+                                              tolerance_to_error_ratio,
+                                              integrator_parameters);
+      Status const status = instance->Solve(t_final);
+      if (status.error() != ReachedMaximalStepCount) {
+        return FlowStatus(status, t_final, t);
+      }
+      auto const& adaptive_instance = dynamic_cast<
+          typename AdaptiveStepSizeIntegrator<NewtonianMotionEquation>::
+              Instance const&>(*instance);
+      unregularized_time_step = adaptive_instance.time_step();
+      unregularized_step_size_controller =
+          adaptive_instance.step_size_controller();
+    } else {
+      unregularized_time_step.reset();
+      unregularized_step_size_controller = parameters.step_size_controller_;
+
+      regularizing_body = bodies_[*b].get();
+      regularizing_body_trajectory = trajectories_[*b];
+      r₀ = regularization_parameters.radius_factor_ *
+           regularizing_body->mean_radius();
+      t₀ = t_initial;
+      RelativeDegreesOfFreedom<Frame> const relative_degrees_of_freedom =
+          trajectory_back.degrees_of_freedom -
+          regularizing_body_trajectory->EvaluateDegreesOfFreedom(t_initial);
+      Displacement<Frame> const& ρ =
+          relative_degrees_of_freedom.displacement();
+      Velocity<Frame> const& ρ̇ = relative_degrees_of_freedom.velocity();
+      Length const r = ρ.Norm();
+      Length const R = regularizing_body->min_radius();
+      GravitationalParameter const& μ =
+          regularizing_body->gravitational_parameter();
+      c = Sqrt(ρ̇.Norm²() +
+               2 * μ * std::max(1 / R - 1 / r, Inverse<Length>()));
+
+      // When entering the regularized formulation at the beginning of the
+      // flow we don't have a step size to start with.  The integrator would
+      // try to cover the entire flow in one step, which leads to an overflow
+      // in the fictitious time, so we start with the time it takes to cover one
+      // radian of a circular orbit.
+      Time const first_time_step =
+          std::min({last_step,
+                    t_final - t_initial,
+                    Sqrt(Pow<3>(r) / μ)});
+
+      IntegrationProblem<GeneralizedNewtonianMotionEquation> problem;
+      problem.equation.compute_acceleration = compute_regularized_acceleration;
+      problem.initial_state = {
+          {Frame::origin + ρ, Frame::origin},
+          {(r / r₀) * ρ̇,
+           Velocity<Frame>({c * r / r₀, Speed(), Speed()})},
+          t_initial};
+      // Since ds = (r₀ / r) dt and the body doesn't go below its minimal
+      // radius, |t_final| is reached before |s_final|.
+      Instant const s_final = t_initial + (t_final - t_initial) * (r₀ / R);
+      // The instance takes one step per call to |Solve|, so that we stop as
+      // soon as the physical time goes past |t_final|, and so that the
+      // reformulation checks don't restart the step size control.  It may not
+      // be reused with an exact last step, but |s_final| is only a bound
+      // anyway.
+      typename AdaptiveStepSizeIntegrator<
+          GeneralizedNewtonianMotionEquation>::Parameters const
+          integrator_parameters(
+              /*first_time_step=*/(r₀ / r) * first_time_step,
+              /*safety_factor=*/0.9,
+              /*max_steps=*/1,
+              /*last_step_is_exact=*/false,
+              parameters.step_size_controller_);
+      auto const instance =
+          regularization_parameters.integrator_->NewInstance(
+              problem,
+              append_regularized_state,
+              tolerance_to_error_ratio,
+              integrator_parameters);
+      for (std::int64_t segment_steps = 1;
+           !overshot && steps < parameters.max_steps_;
+           ++segment_steps) {
+        Status const status = instance->Solve(s_final);
+        if (status.ok()) {
+          break;
+        } else if (status.error() != ReachedMaximalStepCount) {
+          return FlowStatus(status, trajectory->back().time, t);
+        }
+        if (segment_steps % steps_between_reformulation_checks == 0) {
+          auto const& [time, degrees_of_freedom] = trajectory->back();
+          if (RegularizingBodyIndex(degrees_of_freedom.position(),
+                                    time,
+                                    regularization_parameters.radius_factor_) !=
+              b) {
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+template<typename Frame>
+Status Ephemeris<Frame>::FlowWithAdaptiveStepUsingEnckeMethod(
+    not_null<DiscreteTrajectory<Frame>*> const trajectory,
+    IntrinsicAcceleration intrinsic_acceleration,
+    Instant const& t,
+    AdaptiveStepParameters const& parameters,
+    std::int64_t const max_ephemeris_steps) {
+  Instant const& trajectory_last_time = trajectory->back().time;
+  if (trajectory_last_time == t) {
+    return Status::OK;
+  }
+
+  Instant const t_final =
+      ProlongForFlow(trajectory_last_time, t, max_ephemeris_steps);
+
+  // The state of the integrator is the deviation δ from the reference orbit,
+  // represented as a position relative to the origin of |Frame|.  The position
+  // of the massless body is qᴮ + ρ + δ, where qᴮ is the position of the
+  // dominant body and ρ the position on the reference orbit relative to it.
+  // Since ρ″ = -μ ρ / |ρ|³, the deviation satisfies
+  //   δ″ = γ(qᴮ + ρ + δ) - qᴮ″ + μ ρ / |ρ|³,
+  // where γ is the total acceleration of the massless body.  We don't need
+  // Battin's formulation here: the cancellation happens between accelerations
+  // that are computed with the same absolute accuracy as in the first overload
+  // of |FlowWithAdaptiveStep|, and the step size control only sees δ.
+  // Both qᴮ and qᴮ″ are taken from the fitted trajectory of the dominant body:
+  // since the position of the massless body is reconstructed from the fitted
+  // qᴮ, using the acceleration given by the equations of motion for qᴮ″ would
+  // make δ absorb the error of the fit.
+  MasslessBody const massless_body;
+  MassiveBody const* primary = nullptr;
+  ContinuousTrajectory<Frame> const* primary_trajectory = nullptr;
+  std::optional<KeplerOrbit<Frame>> reference_orbit;
+
+  std::vector<Position<Frame>> body_positions(1);
+  std::vector<Vector<Acceleration, Frame>> body_accelerations(1);
+  auto const compute_acceleration =
+      [this,
+       &intrinsic_acceleration,
+       &primary,
+       &primary_trajectory,
+       &reference_orbit,
+       &body_positions,
+       &body_accelerations](
+          Instant const& t,
+          std::vector<Position<Frame>> const& positions,
+          std::vector<Vector<Acceleration, Frame>>& accelerations) {
+        Displacement<Frame> const ρ =
+            reference_orbit->StateVectors(t).displacement();
+        Length const r = ρ.Norm();
+        body_positions[0] = primary_trajectory->EvaluatePosition(t) + ρ +
+                            (positions[0] - Frame::origin);
+        Error const error =
+            ComputeMasslessBodiesGravitationalAccelerations(
+                t, body_positions, body_accelerations);
+        accelerations[0] =
+            body_accelerations[0] -
+            primary_trajectory->EvaluateAcceleration(t) +
+            primary->gravitational_parameter() * ρ / (r * r * r);
+        if (intrinsic_acceleration != nullptr) {
+          accelerations[0] += intrinsic_acceleration(t);
+        }
+        return error == Error::OK ? Status::OK : CollisionDetected();
+      };
+
+  // Reconstructs the degrees of freedom of the massless body.
+  auto const append_state =
+      [trajectory,
+       &primary_trajectory,
+       &reference_orbit](
+          typename NewtonianMotionEquation::SystemState const& state) {
+        Instant const& t = state.time.value;
+        trajectory->Append(
+            t,
+            primary_trajectory->EvaluateDegreesOfFreedom(t) +
+                reference_orbit->StateVectors(t) +
+                RelativeDegreesOfFreedom<Frame>(
+                    state.positions[0].value - Frame::origin,
+                    state.velocities[0].value));
+      };
+
+  // Each integration continues with the step size and the controller history
+  // of the previous one, including across rectifications, so that splitting
+  // the flow into several integrations doesn't affect the step size control.
+  Time first_time_step = t_final - trajectory_last_time;
+  StepSizeController step_size_controller = parameters.step_size_controller_;
+  std::int64_t remaining_steps = parameters.max_steps_;
+  std::optional<typename NewtonianMotionEquation::SystemState> initial_state;
+  for (;;) {
+    auto const trajectory_back = trajectory->back();
+    Instant const& t_initial = trajectory_back.time;
+    if (!initial_state.has_value()) {
+      // Rectification.
+      int const b = DominantBodyIndex(
+          trajectory_back.degrees_of_freedom.position(), t_initial);
+      primary = bodies_[b].get();
+      primary_trajectory = trajectories_[b];
+      reference_orbit.emplace(
+          *primary,
+          massless_body,
+          trajectory_back.degrees_of_freedom -
+              primary_trajectory->EvaluateDegreesOfFreedom(t_initial),
+          t_initial);
+      initial_state.emplace(std::vector<Position<Frame>>{Frame::origin},
+                            std::vector<Velocity<Frame>>{Velocity<Frame>()},
+                            t_initial);
+    }
+
+    IntegrationProblem<NewtonianMotionEquation> problem;
+    problem.equation.compute_acceleration = compute_acceleration;
+    problem.initial_state = *initial_state;
+
+    std::int64_t const max_steps =
+        std::min(remaining_steps, steps_between_reformulation_checks);
+    typename AdaptiveStepSizeIntegrator<
+        NewtonianMotionEquation>::Parameters const
+        integrator_parameters(first_time_step,
+                              /*safety_factor=*/0.9,
+                              max_steps,
+                              /*last_step_is_exact=*/true,
+                              step_size_controller);
+    CHECK_GT(integrator_parameters.first_time_step, 0 * Second)
+        << "Flow back to the future: " << t_final << " <= " << t_initial;
+    auto const tolerance_to_error_ratio =
+        std::bind(&Ephemeris<Frame>::ToleranceToErrorRatio,
+                  std::cref(parameters.length_integration_tolerance_),
+                  std::cref(parameters.speed_integration_tolerance_),
+                  _1, _2);
+
+    auto const instance =
+        parameters.integrator_->NewInstance(problem,
+                                            append_state,
+                                            tolerance_to_error_ratio,
+                                            integrator_parameters);
+    Status const status = instance->Solve(t_final);
+    if (status.error() != ReachedMaximalStepCount) {
+      return FlowStatus(status, t_final, t);
+    }
+    remaining_steps -= max_steps;
+    if (remaining_steps == 0) {
+      return Status(ReachedMaximalStepCount,
+                    "Reached maximum step count " +
+                        std::to_string(parameters.max_steps_) +
+                        " at time " + DebugString(trajectory->back().time) +
+                        "; requested t_final is " + DebugString(t_final) +
+                        ".");
+    }
+
+    auto const& adaptive_instance = dynamic_cast<
+        typename AdaptiveStepSizeIntegrator<NewtonianMotionEquation>::
+            Instance const&>(*instance);
+    first_time_step = adaptive_instance.time_step();
+    step_size_controller = adaptive_instance.step_size_controller();
+    initial_state = instance->state();
+    Length const deviation =
+        (initial_state->positions[0].value - Frame::origin).Norm();
+    Length const distance = reference_orbit->StateVectors(
+        initial_state->time.value).displacement().Norm();
+    if (deviation > encke_rectification_threshold * distance) {
+      initial_state.reset();
+    }
+  }
+}
+
 template<typename Frame>
 Status Ephemeris<Frame>::FlowWithFixedStep(
     Instant const& t,
@@ -544,6 +1234,30 @@ Ephemeris<Frame>::ComputeGravitationalAccelerationOnMasslessBody(
              degrees_of_freedom.position(), t);
 }
 
+template<typename Frame>
+typename Ephemeris<Frame>::GravityGradient
+Ephemeris<Frame>::ComputeGravityGradientOnMasslessBody(
+    Position<Frame> const& position,
+    Instant const& t) const {
+  GravityGradient gravity_gradient;
+
+  // Locking ensures that we see a consistent state of all the trajectories.
+  absl::ReaderMutexLock l(&lock_);
+  for (std::size_t b1 = 0; b1 < number_of_oblate_bodies_; ++b1) {
+    ComputeGravityGradientByMassiveBodyOnMasslessBody<
+        /*body1_is_oblate=*/true>(
+        t, *bodies_[b1], b1, position, gravity_gradient);
+  }
+  for (std::size_t b1 = number_of_oblate_bodies_;
+       b1 < number_of_oblate_bodies_ + number_of_spherical_bodies_;
+       ++b1) {
+    ComputeGravityGradientByMassiveBodyOnMasslessBody<
+        /*body1_is_oblate=*/false>(
+        t, *bodies_[b1], b1, position, gravity_gradient);
+  }
+  return gravity_gradient;
+}
+
 template<typename Frame>
 Vector<Acceleration, Frame>
 Ephemeris<Frame>::ComputeGravitationalAccelerationOnMassiveBody(
@@ -665,12 +1379,12 @@ void Ephemeris<Frame>::ComputeApsides(not_null<MassiveBody const*> const body1,
             Sign(*previous_squared_distance_derivative)) {
       CHECK(previous_time);
 
-      // The derivative of |squared_distance| changed sign.  Find its zero by
-      // bisection, this is the time of the apsis.  Then compute the apsis and
-      // append it to one of the output trajectories.
-      Instant const apsis_time = Bisect(evaluate_square_distance_derivative,
-                                        *previous_time,
-                                        time);
+      // The derivative of |squared_distance| changed sign.  Find its zero
+      // using Brent's method, this is the time of the apsis.  Then compute the
+      // apsis and append it to one of the output trajectories.
+      Instant const apsis_time = Brent(evaluate_square_distance_derivative,
+                                       *previous_time,
+                                       time);
       DegreesOfFreedom<Frame> const apsis1_degrees_of_freedom =
           body1_trajectory->EvaluateDegreesOfFreedom(apsis_time);
       DegreesOfFreedom<Frame> const apsis2_degrees_of_freedom =
@@ -873,9 +1587,8 @@ bool Ephemeris<Frame>::ReadFromCheckpoint(
       Instant const& t,
       std::vector<Position<Frame>> const& positions,
       std::vector<Vector<Acceleration, Frame>>& accelerations) {
-    ComputeMassiveBodiesGravitationalAccelerations(t,
-                                                    positions,
-                                                    accelerations);
+    (this->*compute_massive_bodies_gravitational_accelerations_)(
+        t, positions, accelerations);
     return Status::OK;
   };
 
@@ -1074,6 +1787,38 @@ ComputeGravitationalAccelerationByMassiveBodyOnMasslessBodies(
   return error;
 }
 
+template<typename Frame>
+template<bool body1_is_oblate>
+void Ephemeris<Frame>::ComputeGravityGradientByMassiveBodyOnMasslessBody(
+    Instant const& t,
+    MassiveBody const& body1,
+    std::size_t const b1,
+    Position<Frame> const& position,
+    GravityGradient& gravity_gradient) const {
+  lock_.AssertReaderHeld();
+  GravitationalParameter const& μ1 = body1.gravitational_parameter();
+  Position<Frame> const position1 = trajectories_[b1]->EvaluatePosition(t);
+
+  // A vector from the massless body to the center of |b1|.
+  Displacement<Frame> const Δq = position1 - position;
+
+  Square<Length> const Δq² = Δq.Norm²();
+  Length const Δq_norm = Sqrt(Δq²);
+  Exponentiation<Length, -3> const one_over_Δq³ = Δq_norm / (Δq² * Δq²);
+  Exponentiation<Length, -5> const one_over_Δq⁵ = one_over_Δq³ / Δq²;
+
+  // The gradient of μ Δq / ‖Δq‖³ with respect to the position of the massless
+  // body is μ (3 Δq ⊗ Δq / ‖Δq‖⁵ - 1 / ‖Δq‖³).
+  gravity_gradient +=
+      μ1 * (3 * one_over_Δq⁵ * SymmetricProduct(Δq, Δq) -
+            one_over_Δq³ * InnerProductForm<Frame, Vector>());
+
+  if (body1_is_oblate) {
+    gravity_gradient +=
+        μ1 * geopotentials_[b1].GeneralSphericalHarmonicsGradient(t, -Δq);
+  }
+}
+
 template<typename Frame>
 void Ephemeris<Frame>::ComputeMassiveBodiesGravitationalAccelerations(
     Instant const& t,
@@ -1120,6 +1865,80 @@ void Ephemeris<Frame>::ComputeMassiveBodiesGravitationalAccelerations(
   }
 }
 
+template<typename Frame>
+template<std::size_t size>
+void Ephemeris<Frame>::ComputeSphericalMassiveBodiesGravitationalAccelerations(
+    Instant const& t,
+    std::vector<Position<Frame>> const& positions,
+    std::vector<Vector<Acceleration, Frame>>& accelerations) const {
+  lock_.AssertReaderHeld();
+  DCHECK_EQ(0, number_of_oblate_bodies_);
+  DCHECK_EQ(size, number_of_spherical_bodies_);
+  std::array<GravitationalParameter, size> μ;
+  std::array<Position<Frame>, size> q;
+  std::array<Vector<Acceleration, Frame>, size> a;
+  for (std::size_t b = 0; b < size; ++b) {
+    μ[b] = bodies_[b]->gravitational_parameter();
+    q[b] = positions[b];
+  }
+
+  // Same computation and same order of operations as
+  // |ComputeGravitationalAccelerationByMassiveBodyOnMassiveBodies|, so that
+  // the results are identical.
+  for (std::size_t b1 = 0; b1 < size; ++b1) {
+    for (std::size_t b2 = b1 + 1; b2 < size; ++b2) {
+      Displacement<Frame> const Δq = q[b1] - q[b2];
+
+      Square<Length> const Δq² = Δq.Norm²();
+      Length const Δq_norm = Sqrt(Δq²);
+      Exponentiation<Length, -3> const one_over_Δq³ = Δq_norm / (Δq² * Δq²);
+
+      auto const μ1_over_Δq³ = μ[b1] * one_over_Δq³;
+      a[b2] += Δq * μ1_over_Δq³;
+
+      auto const μ2_over_Δq³ = μ[b2] * one_over_Δq³;
+      a[b1] -= Δq * μ2_over_Δq³;
+    }
+  }
+
+  std::copy(a.cbegin(), a.cend(), accelerations.begin());
+}
+
+template<typename Frame>
+template<std::size_t... sizes>
+constexpr std::array<
+    std::pair<int,
+              typename Ephemeris<Frame>::
+                  MassiveBodiesGravitationalAccelerationsComputation>,
+    sizeof...(sizes)>
+Ephemeris<Frame>::MakeFixedSizeSpecializations(
+    std::index_sequence<sizes...>) {
+  static_assert(((sizes > 0) && ...), "Cannot specialize for no bodies");
+  return {{{sizes,
+            &Ephemeris::
+                ComputeSphericalMassiveBodiesGravitationalAccelerations<
+                    sizes>}...}};
+}
+
+template<typename Frame>
+void Ephemeris<Frame>::
+SelectMassiveBodiesGravitationalAccelerationsComputation() {
+  static constexpr auto fixed_size_specializations =
+      MakeFixedSizeSpecializations(FixedSizeBodyCounts());
+  compute_massive_bodies_gravitational_accelerations_ =
+      &Ephemeris::ComputeMassiveBodiesGravitationalAccelerations;
+  if (number_of_oblate_bodies_ > 0) {
+    return;
+  }
+  // Any other number of bodies, including 0, uses the generic code.
+  for (auto const& [size, computation] : fixed_size_specializations) {
+    if (size == number_of_spherical_bodies_) {
+      compute_massive_bodies_gravitational_accelerations_ = computation;
+      return;
+    }
+  }
+}
+
 template<typename Frame>
 Error Ephemeris<Frame>::ComputeMasslessBodiesGravitationalAccelerations(
     Instant const& t,
@@ -1155,6 +1974,46 @@ Error Ephemeris<Frame>::ComputeMasslessBodiesGravitationalAccelerations(
   return error;
 }
 
+template<typename Frame>
+std::optional<int> Ephemeris<Frame>::RegularizingBodyIndex(
+    Position<Frame> const& position,
+    Instant const& t,
+    double const radius_factor) const {
+  // Locking ensures that we see a consistent state of all the trajectories.
+  absl::ReaderMutexLock l(&lock_);
+  std::optional<int> regularizing_body_index;
+  double min_ratio = 1;
+  for (int b = 0; b < bodies_.size(); ++b) {
+    double const ratio =
+        (position - trajectories_[b]->EvaluatePosition(t)).Norm() /
+        (radius_factor * bodies_[b]->mean_radius());
+    if (ratio < min_ratio) {
+      regularizing_body_index = b;
+      min_ratio = ratio;
+    }
+  }
+  return regularizing_body_index;
+}
+
+template<typename Frame>
+int Ephemeris<Frame>::DominantBodyIndex(Position<Frame> const& position,
+                                        Instant const& t) const {
+  // Locking ensures that we see a consistent state of all the trajectories.
+  absl::ReaderMutexLock l(&lock_);
+  int dominant_body_index = 0;
+  Acceleration max_acceleration;
+  for (int b = 0; b < bodies_.size(); ++b) {
+    Acceleration const acceleration =
+        bodies_[b]->gravitational_parameter() /
+        (position - trajectories_[b]->EvaluatePosition(t)).Norm²();
+    if (acceleration > max_acceleration) {
+      dominant_body_index = b;
+      max_acceleration = acceleration;
+    }
+  }
+  return dominant_body_index;
+}
+
 template<typename Frame>
 template<typename ODE>
 Status Ephemeris<Frame>::FlowODEWithAdaptiveStep(
@@ -1170,16 +2029,8 @@ Status Ephemeris<Frame>::FlowODEWithAdaptiveStep(
 
   std::vector<not_null<DiscreteTrajectory<Frame>*>> const trajectories =
       {trajectory};
-  // The |min| is here to prevent us from spending too much time computing the
-  // ephemeris.  The |max| is here to ensure that we always try to integrate
-  // forward.  We use |last_state_.time.value| because this is always finite,
-  // contrary to |t_max()|, which is -∞ when |empty()|.
   Instant const t_final =
-      std::min(std::max(instance_time() +
-                            max_ephemeris_steps * fixed_step_parameters_.step(),
-                        trajectory_last_time + fixed_step_parameters_.step()),
-               t);
-  Prolong(t_final);
+      ProlongForFlow(trajectory_last_time, t, max_ephemeris_steps);
 
   IntegrationProblem<ODE> problem;
   problem.equation.compute_acceleration = std::move(compute_acceleration);
@@ -1195,7 +2046,8 @@ Status Ephemeris<Frame>::FlowODEWithAdaptiveStep(
           /*first_time_step=*/t_final - problem.initial_state.time.value,
           /*safety_factor=*/0.9,
           parameters.max_steps_,
-          /*last_step_is_exact=*/true);
+          /*last_step_is_exact=*/true,
+          parameters.step_size_controller_);
   CHECK_GT(integrator_parameters.first_time_step, 0 * Second)
       << "Flow back to the future: " << t_final
       << " <= " << problem.initial_state.time.value;
@@ -1214,8 +2066,31 @@ Status Ephemeris<Frame>::FlowODEWithAdaptiveStep(
                                           append_state,
                                           tolerance_to_error_ratio,
                                           integrator_parameters);
-  auto status = instance->Solve(t_final);
+  return FlowStatus(instance->Solve(t_final), t_final, t);
+}
 
+template<typename Frame>
+Instant Ephemeris<Frame>::ProlongForFlow(
+    Instant const& trajectory_last_time,
+    Instant const& t,
+    std::int64_t const max_ephemeris_steps) {
+  // The |min| is here to prevent us from spending too much time computing the
+  // ephemeris.  The |max| is here to ensure that we always try to integrate
+  // forward.  We use |last_state_.time.value| because this is always finite,
+  // contrary to |t_max()|, which is -∞ when |empty()|.
+  Instant const t_final =
+      std::min(std::max(instance_time() +
+                            max_ephemeris_steps * fixed_step_parameters_.step(),
+                        trajectory_last_time + fixed_step_parameters_.step()),
+               t);
+  Prolong(t_final);
+  return t_final;
+}
+
+template<typename Frame>
+Status Ephemeris<Frame>::FlowStatus(Status status,
+                                    Instant const& t_final,
+                                    Instant const& t) {
   // We probably don't care if the vessel gets too close to the singularity, as
   // we only use this integrator for the future.  So we swallow the error.  Note
   // that a collision in the prediction or the flight plan (for which this path
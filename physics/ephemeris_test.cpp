@@ -71,6 +71,7 @@ using quantities::astronomy::JulianYear;
 using quantities::astronomy::SolarGravitationalParameter;
 using quantities::astronomy::TerrestrialEquatorialRadius;
 using quantities::astronomy::TerrestrialPolarRadius;
+using quantities::si::Day;
 using quantities::si::Hour;
 using quantities::si::Kilo;
 using quantities::si::Kilogram;
@@ -1057,6 +1058,372 @@ TEST_P(EphemerisTest, ComputeApsidesContinuousTrajectory) {
   }
 }
 
+// The gravity-gradient tensor must agree with the differences of the
+// accelerations, and must be traceless outside of the bodies.
+TEST_P(EphemerisTest, ComputeGravityGradientOnMasslessBody) {
+  auto const ephemeris = solar_system_.MakeEphemeris(
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), 10 * Minute));
+  Instant const t = t0_ + 1 * Day;
+  ephemeris->Prolong(t);
+
+  Position<ICRS> const earth_position =
+      solar_system_.trajectory(*ephemeris, "Earth").EvaluatePosition(t);
+  Position<ICRS> const position =
+      earth_position +
+      Displacement<ICRS>({3000 * Kilo(Metre),
+                          -5000 * Kilo(Metre),
+                          4000 * Kilo(Metre)});
+  auto const gravity_gradient =
+      ephemeris->ComputeGravityGradientOnMasslessBody(position, t);
+
+  EXPECT_THAT(Abs(gravity_gradient.coordinates().Trace()),
+              Lt(1e-11 * Pow<-2>(Second)));
+  for (auto const& δq : {Displacement<ICRS>({1 * Kilo(Metre),
+                                             0 * Metre,
+                                             0 * Metre}),
+                         Displacement<ICRS>({0 * Metre,
+                                             1 * Kilo(Metre),
+                                             0 * Metre}),
+                         Displacement<ICRS>({0 * Metre,
+                                             0 * Metre,
+                                             1 * Kilo(Metre)}),
+                         Displacement<ICRS>({300 * Metre,
+                                             -400 * Metre,
+                                             1200 * Metre})}) {
+    Vector<Acceleration, ICRS> const expected =
+        (ephemeris->ComputeGravitationalAccelerationOnMasslessBody(
+             position + δq, t) -
+         ephemeris->ComputeGravitationalAccelerationOnMasslessBody(
+             position - δq, t)) / 2;
+    EXPECT_THAT(RelativeError(expected, gravity_gradient * δq), Lt(1e-7));
+  }
+}
+
+// The state transition matrix must predict the effect of small variations of
+// the initial degrees of freedom.
+TEST_P(EphemerisTest, StateTransitionMatrix) {
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+
+  MassiveBody const* const earth = bodies[0].get();
+  Position<ICRS> const earth_position = initial_state[0].position();
+  Velocity<ICRS> const earth_velocity = initial_state[0].velocity();
+
+  Ephemeris<ICRS> ephemeris(
+      std::move(bodies),
+      initial_state,
+      t0_,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), period / 100));
+
+  // An eccentric orbit around the Earth.
+  Length const distance = 7000 * Kilo(Metre);
+  Speed const speed = 1.2 * Sqrt(earth->gravitational_parameter() / distance);
+  DegreesOfFreedom<ICRS> const probe_degrees_of_freedom(
+      earth_position + Displacement<ICRS>({distance, 0 * Metre, 0 * Metre}),
+      earth_velocity + Velocity<ICRS>({0 * Metre / Second,
+                                       speed,
+                                       0.1 * speed}));
+  Ephemeris<ICRS>::AdaptiveStepParameters const parameters(
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<
+          DormandالمكاوىPrince1986RKN434FM,
+          Position<ICRS>>(),
+      max_steps,
+      1e-9 * Metre,
+      1e-12 * Metre / Second);
+  Instant const t = t0_ + 3 * Hour;
+
+  DiscreteTrajectory<ICRS> trajectory;
+  trajectory.Append(t0_, probe_degrees_of_freedom);
+  StateTransitionMatrix<ICRS> state_transition_matrix;
+  EXPECT_OK(ephemeris.FlowWithAdaptiveStep(
+      &trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t,
+      parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps,
+      &state_transition_matrix));
+  EXPECT_EQ(t, trajectory.back().time);
+
+  // The same flow without the variational equations yields the same
+  // trajectory.
+  DiscreteTrajectory<ICRS> reference_trajectory;
+  reference_trajectory.Append(t0_, probe_degrees_of_freedom);
+  EXPECT_OK(ephemeris.FlowWithAdaptiveStep(
+      &reference_trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t,
+      parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  EXPECT_EQ(reference_trajectory.back().degrees_of_freedom,
+            trajectory.back().degrees_of_freedom);
+
+  for (RelativeDegreesOfFreedom<ICRS> const& δ :
+       {RelativeDegreesOfFreedom<ICRS>(
+            Displacement<ICRS>({1 * Metre, 0 * Metre, 0 * Metre}),
+            Velocity<ICRS>()),
+        RelativeDegreesOfFreedom<ICRS>(
+            Displacement<ICRS>({0 * Metre, -0.5 * Metre, 0.7 * Metre}),
+            Velocity<ICRS>()),
+        RelativeDegreesOfFreedom<ICRS>(
+            Displacement<ICRS>(),
+            Velocity<ICRS>({1 * Milli(Metre) / Second,
+                            0 * Metre / Second,
+                            0 * Metre / Second})),
+        RelativeDegreesOfFreedom<ICRS>(
+            Displacement<ICRS>(),
+            Velocity<ICRS>({0 * Metre / Second,
+                            -1 * Milli(Metre) / Second,
+                            2 * Milli(Metre) / Second}))}) {
+    DiscreteTrajectory<ICRS> perturbed_trajectory;
+    perturbed_trajectory.Append(t0_, probe_degrees_of_freedom + δ);
+    EXPECT_OK(ephemeris.FlowWithAdaptiveStep(
+        &perturbed_trajectory,
+        Ephemeris<ICRS>::NoIntrinsicAcceleration,
+        t,
+        parameters,
+        Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+    RelativeDegreesOfFreedom<ICRS> const actual =
+        perturbed_trajectory.back().degrees_of_freedom -
+        trajectory.back().degrees_of_freedom;
+    RelativeDegreesOfFreedom<ICRS> const predicted =
+        state_transition_matrix(δ);
+    // The residual is dominated by the second-order terms in δ.
+    EXPECT_THAT(RelativeError(actual.displacement(), predicted.displacement()),
+                Lt(3e-6));
+    EXPECT_THAT(RelativeError(actual.velocity(), predicted.velocity()),
+                Lt(3e-6));
+  }
+}
+
+// Encke's method must give the same trajectory as Cowell's method with far
+// fewer steps for an orbit perturbed by the geopotential of the Earth, the
+// Moon, and the Sun.
+TEST_P(EphemerisTest, EnckeMethod) {
+  auto const ephemeris = solar_system_.MakeEphemeris(
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(),
+                                           /*step=*/10 * Minute));
+  DegreesOfFreedom<ICRS> const earth_degrees_of_freedom =
+      solar_system_.degrees_of_freedom("Earth");
+  Length const distance = 7000 * Kilo(Metre);
+  Speed const speed =
+      1.1 * Sqrt(solar_system_.gravitational_parameter("Earth") / distance);
+  DegreesOfFreedom<ICRS> const probe_degrees_of_freedom(
+      earth_degrees_of_freedom.position() +
+          Displacement<ICRS>({distance, 0 * Metre, 0 * Metre}),
+      earth_degrees_of_freedom.velocity() +
+          Velocity<ICRS>({0 * Metre / Second, 0.8 * speed, 0.6 * speed}));
+  Ephemeris<ICRS>::AdaptiveStepParameters const parameters(
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<
+          DormandالمكاوىPrince1986RKN434FM,
+          Position<ICRS>>(),
+      max_steps,
+      1 * Milli(Metre),
+      1 * Milli(Metre) / Second);
+  Instant const t = t0_ + 1 * Day;
+
+  DiscreteTrajectory<ICRS> cowell_trajectory;
+  cowell_trajectory.Append(t0_, probe_degrees_of_freedom);
+  EXPECT_OK(ephemeris->FlowWithAdaptiveStep(
+      &cowell_trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t,
+      parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  EXPECT_EQ(t, cowell_trajectory.back().time);
+
+  DiscreteTrajectory<ICRS> encke_trajectory;
+  encke_trajectory.Append(t0_, probe_degrees_of_freedom);
+  EXPECT_OK(ephemeris->FlowWithAdaptiveStepUsingEnckeMethod(
+      &encke_trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t,
+      parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  EXPECT_EQ(t, encke_trajectory.back().time);
+
+  EXPECT_THAT(encke_trajectory.Size(), Lt(cowell_trajectory.Size() / 3));
+  EXPECT_THAT((encke_trajectory.back().degrees_of_freedom.position() -
+               cowell_trajectory.back().degrees_of_freedom.position()).Norm(),
+              Lt(1 * Metre));
+  EXPECT_THAT((encke_trajectory.back().degrees_of_freedom.velocity() -
+               cowell_trajectory.back().degrees_of_freedom.velocity()).Norm(),
+              Lt(1 * Milli(Metre) / Second));
+
+  // Flowing with a limited number of steps stops in the middle.
+  DiscreteTrajectory<ICRS> limited_trajectory;
+  limited_trajectory.Append(t0_, probe_degrees_of_freedom);
+  Ephemeris<ICRS>::AdaptiveStepParameters const limited_parameters(
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<
+          DormandالمكاوىPrince1986RKN434FM,
+          Position<ICRS>>(),
+      /*max_steps=*/20,
+      1 * Milli(Metre),
+      1 * Milli(Metre) / Second);
+  EXPECT_THAT(ephemeris->FlowWithAdaptiveStepUsingEnckeMethod(
+                  &limited_trajectory,
+                  Ephemeris<ICRS>::NoIntrinsicAcceleration,
+                  t,
+                  limited_parameters,
+                  Ephemeris<ICRS>::unlimited_max_ephemeris_steps),
+              StatusIs(integrators::termination_condition::
+                           ReachedMaximalStepCount));
+  EXPECT_EQ(21, limited_trajectory.Size());
+}
+
+// The regularized flow must give the same trajectory as the unregularized one
+// with fewer steps for a highly eccentric orbit with a low periapsis.
+TEST_P(EphemerisTest, Regularization) {
+  auto const ephemeris = solar_system_.MakeEphemeris(
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(),
+                                           /*step=*/10 * Minute));
+  DegreesOfFreedom<ICRS> const earth_degrees_of_freedom =
+      solar_system_.degrees_of_freedom("Earth");
+  GravitationalParameter const μ =
+      solar_system_.gravitational_parameter("Earth");
+  Length const periapsis_distance = 6578 * Kilo(Metre);
+  Length const apoapsis_distance = 100'000 * Kilo(Metre);
+  Length const semimajor_axis = (periapsis_distance + apoapsis_distance) / 2;
+  Speed const periapsis_speed =
+      Sqrt(μ * (2 / periapsis_distance - 1 / semimajor_axis));
+  Time const period = 2 * π * Sqrt(Pow<3>(semimajor_axis) / μ);
+  DegreesOfFreedom<ICRS> const probe_degrees_of_freedom(
+      earth_degrees_of_freedom.position() +
+          Displacement<ICRS>({periapsis_distance, 0 * Metre, 0 * Metre}),
+      earth_degrees_of_freedom.velocity() +
+          Velocity<ICRS>({0 * Metre / Second,
+                          0.6 * periapsis_speed,
+                          0.8 * periapsis_speed}));
+  Ephemeris<ICRS>::AdaptiveStepParameters const parameters(
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<
+          DormandالمكاوىPrince1986RKN434FM,
+          Position<ICRS>>(),
+      max_steps,
+      1 * Milli(Metre),
+      1 * Milli(Metre) / Second);
+  Ephemeris<ICRS>::RegularizationParameters const regularization_parameters(
+      EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator<
+          Fine1987RKNG34,
+          Position<ICRS>>(),
+      /*radius_factor=*/5);
+  // Two periapsis passages.
+  Instant const t = t0_ + 1.5 * period;
+
+  DiscreteTrajectory<ICRS> trajectory;
+  trajectory.Append(t0_, probe_degrees_of_freedom);
+  EXPECT_OK(ephemeris->FlowWithAdaptiveStep(
+      &trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t,
+      parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  EXPECT_EQ(t, trajectory.back().time);
+
+  DiscreteTrajectory<ICRS> regularized_trajectory;
+  regularized_trajectory.Append(t0_, probe_degrees_of_freedom);
+  EXPECT_OK(ephemeris->FlowWithAdaptiveStep(
+      &regularized_trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t,
+      parameters,
+      regularization_parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  EXPECT_EQ(t, regularized_trajectory.back().time);
+
+  EXPECT_THAT(regularized_trajectory.Size(), Lt(trajectory.Size() * 3 / 4));
+  EXPECT_THAT((regularized_trajectory.back().degrees_of_freedom.position() -
+               trajectory.back().degrees_of_freedom.position()).Norm(),
+              Lt(1 * Metre));
+  EXPECT_THAT((regularized_trajectory.back().degrees_of_freedom.velocity() -
+               trajectory.back().degrees_of_freedom.velocity()).Norm(),
+              Lt(1 * Milli(Metre) / Second));
+
+  // A flow that ends at periapsis, within the regularized region, stops the
+  // regularized integration as soon as it goes past the end of the flow, and
+  // completes it with one unregularized step.  Up to that point it takes the
+  // same steps as the longer flow.
+  Instant const t_periapsis = t0_ + period;
+  int regularized_steps_before_periapsis = 0;
+  for (auto const& [time, degrees_of_freedom] : regularized_trajectory) {
+    if (time < t_periapsis) {
+      ++regularized_steps_before_periapsis;
+    }
+  }
+  DiscreteTrajectory<ICRS> periapsis_trajectory;
+  periapsis_trajectory.Append(t0_, probe_degrees_of_freedom);
+  EXPECT_OK(ephemeris->FlowWithAdaptiveStep(
+      &periapsis_trajectory,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t_periapsis,
+      parameters,
+      regularization_parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  EXPECT_EQ(t_periapsis, periapsis_trajectory.back().time);
+  EXPECT_EQ(regularized_steps_before_periapsis + 1,
+            periapsis_trajectory.Size());
+  EXPECT_THAT((periapsis_trajectory.back().degrees_of_freedom.position() -
+               trajectory.EvaluatePosition(t_periapsis)).Norm(),
+              Lt(1 * Metre));
+}
+
+// The specialization for a fixed number of bodies must give the same results as
+// the generic code.
+TEST_P(EphemerisTest, FixedSizeSpecialization) {
+  SolarSystem<ICRS> kerbol(
+      SOLUTION_DIR / "astronomy" / "kerbol_gravity_model.proto.txt",
+      SOLUTION_DIR / "astronomy" / "kerbol_initial_state_0_0.proto.txt",
+      /*ignore_frame=*/true);
+  Ephemeris<ICRS>::AccuracyParameters const accuracy_parameters(
+      /*fitting_tolerance=*/5 * Milli(Metre),
+      /*geopotential_tolerance=*/0x1p-24);
+  Ephemeris<ICRS>::FixedStepParameters const fixed_step_parameters(
+      integrator(), /*step=*/35 * Minute);
+  auto const specialized =
+      kerbol.MakeEphemeris(accuracy_parameters, fixed_step_parameters);
+  auto const generic =
+      kerbol.MakeEphemeris(accuracy_parameters, fixed_step_parameters);
+  generic->DisableFixedSizeSpecialization();
+  EXPECT_TRUE(specialized->has_fixed_size_specialization());
+  EXPECT_FALSE(generic->has_fixed_size_specialization());
+
+  Instant const t = kerbol.epoch() + 30 * Day;
+  specialized->Prolong(t);
+  generic->Prolong(t);
+  for (auto const& name : kerbol.names()) {
+    EXPECT_EQ(kerbol.trajectory(*generic, name).EvaluateDegreesOfFreedom(t),
+              kerbol.trajectory(*specialized, name).EvaluateDegreesOfFreedom(t))
+        << name;
+  }
+
+  // The solar system has oblate bodies, so it is not specialized.
+  EXPECT_FALSE(solar_system_.MakeEphemeris(accuracy_parameters,
+                                           fixed_step_parameters)
+                   ->has_fixed_size_specialization());
+
+  // There is no specialization for two bodies.
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+  Ephemeris<ICRS> earth_moon(std::move(bodies),
+                             initial_state,
+                             t0_,
+                             accuracy_parameters,
+                             fixed_step_parameters);
+  EXPECT_FALSE(earth_moon.has_fixed_size_specialization());
+}
+
 INSTANTIATE_TEST_CASE_P(
     AllEphemerisTests,
     EphemerisTest,
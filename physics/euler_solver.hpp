@@ -2,7 +2,9 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
+#include "absl/types/span.h"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/named_quantities.hpp"
@@ -67,6 +69,17 @@ class EulerSolver {
       Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
       Instant const& time) const;
 
+  // Same as |AngularMomentumAt| and |AttitudeAt| for each element of |times|.
+  // The results are identical, but the elliptic functions and integrals are
+  // evaluated in batches, which is faster for many times.  |angular_momenta|
+  // must have the size of |times|.
+  std::vector<Bivector<AngularMomentum, PrincipalAxesFrame>> AngularMomentaAt(
+      absl::Span<Instant const> times) const;
+  std::vector<AttitudeRotation> AttitudesAt(
+      absl::Span<Bivector<AngularMomentum, PrincipalAxesFrame> const>
+          angular_momenta,
+      absl::Span<Instant const> times) const;
+
  private:
   using ℬₜ = Frame<enum class ℬₜTag>;
   using ℬʹ = Frame<enum class ℬʹTag>;
@@ -102,6 +115,28 @@ class EulerSolver {
   Rotation<PreferredPrincipalAxesFrame, ℬₜ> Compute𝒫ₜ(
       PreferredAngularMomentumBivector const& angular_momentum) const;
 
+  // The argument of the elliptic functions at |time|.
+  Angle ArgumentAt(Instant const& time) const;
+
+  // The parts of |AngularMomentumAt| and |AttitudeAt| that follow the
+  // evaluation of the elliptic functions and integrals of |ArgumentAt(time)|.
+  // The values |sn|, |cn|, |dn| and |elliptic_π| are only used for formulæ (i)
+  // and (ii).
+  Bivector<AngularMomentum, PrincipalAxesFrame> AngularMomentumFor(
+      Instant const& time,
+      double sn,
+      double cn,
+      double dn) const;
+  AttitudeRotation AttitudeFor(
+      Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
+      Instant const& time,
+      double sn,
+      double cn,
+      Angle const& elliptic_π) const;
+
+  // True if formula (i) or (ii) is used.
+  bool UsesEllipticFunctions() const;
+
   // Construction parameters.
   R3Element<MomentOfInertia> const moments_of_inertia_;
   Instant const initial_time_;
@@ -4,6 +4,8 @@
 #include "physics/euler_solver.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <vector>
 
 #include "geometry/grassmann.hpp"
 #include "geometry/quaternion.hpp"
@@ -34,6 +36,7 @@ using quantities::Cosh;
 using quantities::Energy;
 using quantities::Inverse;
 using quantities::IsFinite;
+using quantities::NaN;
 using quantities::Pow;
 using quantities::Quotient;
 using quantities::Sinh;
@@ -274,27 +277,184 @@ template<typename InertialFrame, typename PrincipalAxesFrame>
 Bivector<AngularMomentum, PrincipalAxesFrame>
 EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularMomentumAt(
     Instant const& time) const {
+  double sn = NaN<double>();
+  double cn = NaN<double>();
+  double dn = NaN<double>();
+  if (UsesEllipticFunctions()) {
+    JacobiSNCNDN(ArgumentAt(time), mc_, sn, cn, dn);
+  }
+  return AngularMomentumFor(time, sn, cn, dn);
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+AngularVelocity<PrincipalAxesFrame>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularVelocityFor(
+    Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum)
+    const {
+  auto const& m = angular_momentum;
+  auto const& m_coordinates = m.coordinates();
+
+  auto const& I₁ = moments_of_inertia_.x;
+  auto const& I₂ = moments_of_inertia_.y;
+  auto const& I₃ = moments_of_inertia_.z;
+  Bivector<Quotient<AngularMomentum, MomentOfInertia>, PrincipalAxesFrame> const
+      ω({m_coordinates.x / I₁, m_coordinates.y / I₂, m_coordinates.z / I₃});
+
+  return ω;
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+typename EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeRotation
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeAt(
+    Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
+    Instant const& time) const {
+  double sn = NaN<double>();
+  double cn = NaN<double>();
+  double dn = NaN<double>();
+  Angle elliptic_π = NaN<Angle>();
+  if (UsesEllipticFunctions()) {
+    Angle const u = ArgumentAt(time);
+    JacobiSNCNDN(u, mc_, sn, cn, dn);
+    Angle const φ = JacobiAmplitude(u, mc_);
+    elliptic_π = EllipticΠ(φ, n_, mc_);
+  }
+  return AttitudeFor(angular_momentum, time, sn, cn, elliptic_π);
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+std::vector<Bivector<AngularMomentum, PrincipalAxesFrame>>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularMomentaAt(
+    absl::Span<Instant const> const times) const {
+  std::vector<double> sn(times.size(), NaN<double>());
+  std::vector<double> cn(times.size(), NaN<double>());
+  std::vector<double> dn(times.size(), NaN<double>());
+  if (UsesEllipticFunctions()) {
+    std::vector<Angle> u;
+    u.reserve(times.size());
+    for (Instant const& time : times) {
+      u.push_back(ArgumentAt(time));
+    }
+    JacobiSNCNDN(u,
+                 mc_,
+                 absl::MakeSpan(sn),
+                 absl::MakeSpan(cn),
+                 absl::MakeSpan(dn));
+  }
+
+  std::vector<Bivector<AngularMomentum, PrincipalAxesFrame>> angular_momenta;
+  angular_momenta.reserve(times.size());
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    angular_momenta.push_back(
+        AngularMomentumFor(times[i], sn[i], cn[i], dn[i]));
+  }
+  return angular_momenta;
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+std::vector<
+    typename EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeRotation>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudesAt(
+    absl::Span<Bivector<AngularMomentum, PrincipalAxesFrame> const> const
+        angular_momenta,
+    absl::Span<Instant const> const times) const {
+  CHECK_EQ(angular_momenta.size(), times.size());
+  std::vector<double> sn(times.size(), NaN<double>());
+  std::vector<double> cn(times.size(), NaN<double>());
+  std::vector<double> dn(times.size(), NaN<double>());
+  std::vector<Angle> elliptic_π(times.size(), NaN<Angle>());
+  if (UsesEllipticFunctions()) {
+    std::vector<Angle> u;
+    u.reserve(times.size());
+    for (Instant const& time : times) {
+      u.push_back(ArgumentAt(time));
+    }
+    JacobiSNCNDN(u,
+                 mc_,
+                 absl::MakeSpan(sn),
+                 absl::MakeSpan(cn),
+                 absl::MakeSpan(dn));
+    std::vector<Angle> φ(times.size());
+    JacobiAmplitude(u, mc_, absl::MakeSpan(φ));
+    EllipticΠ(φ, n_, mc_, absl::MakeSpan(elliptic_π));
+  }
+
+  std::vector<AttitudeRotation> attitudes;
+  attitudes.reserve(times.size());
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    attitudes.push_back(AttitudeFor(
+        angular_momenta[i], times[i], sn[i], cn[i], elliptic_π[i]));
+  }
+  return attitudes;
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+Rotation<typename EulerSolver<InertialFrame,
+                              PrincipalAxesFrame>::PreferredPrincipalAxesFrame,
+         typename EulerSolver<InertialFrame, PrincipalAxesFrame>::ℬₜ>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::Compute𝒫ₜ(
+    PreferredAngularMomentumBivector const& angular_momentum) const {
+  auto const& m = angular_momentum;
+  auto m_coordinates = m.coordinates();
+
+  Quaternion pₜ;
+  switch (region_) {
+    case Region::e₁: {
+      double const real_part = Sqrt(0.5 * (1 + m_coordinates.x / G_));
+      AngularMomentum const denominator = 2 * G_ * real_part;
+      pₜ = Quaternion(real_part,
+                      {0,
+                        m_coordinates.z / denominator,
+                        -m_coordinates.y / denominator});
+      break;
+    }
+    case Region::e₃: {
+      double const real_part = Sqrt(0.5 * (1 + m_coordinates.z / G_));
+      AngularMomentum const denominator = 2 * G_ * real_part;
+      pₜ = Quaternion(real_part,
+                      {m_coordinates.y / denominator,
+                        -m_coordinates.x / denominator,
+                        0});
+      break;
+    }
+    case Region::Motionless: {
+      pₜ = Quaternion(1);
+      break;
+    }
+    default:
+      LOG(FATAL) << "Unexpected region " << static_cast<int>(region_);
+  }
+
+  Rotation<PreferredPrincipalAxesFrame, ℬₜ> const 𝒫ₜ(pₜ);
+
+  return 𝒫ₜ;
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+Angle EulerSolver<InertialFrame, PrincipalAxesFrame>::ArgumentAt(
+    Instant const& time) const {
   Time const Δt = time - initial_time_;
+  return λ_ * Δt - ν_;
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+Bivector<AngularMomentum, PrincipalAxesFrame>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularMomentumFor(
+    Instant const& time,
+    double const sn,
+    double const cn,
+    double const dn) const {
   PreferredAngularMomentumBivector m;
   switch (formula_) {
     case Formula::i: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
       m = PreferredAngularMomentumBivector({B₁₃_ * dn, -B₂₁_ * sn, B₃₁_ * cn});
       break;
     }
     case Formula::ii: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
       m = PreferredAngularMomentumBivector({B₁₃_ * cn, -B₂₃_ * sn, B₃₁_ * dn});
       break;
     }
     case Formula::iii: {
-      Angle const angle = λ_ * Δt - ν_;
+      Angle const angle = ArgumentAt(time);
       double const sech = 1.0 / Cosh(angle);
       m = PreferredAngularMomentumBivector(
           {B₁₃_ * sech, G_ * Tanh(angle), B₃₁_ * sech});
@@ -310,53 +470,23 @@ EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularMomentumAt(
   return 𝒮_.Inverse()(m);
 }
 
-template<typename InertialFrame, typename PrincipalAxesFrame>
-AngularVelocity<PrincipalAxesFrame>
-EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularVelocityFor(
-    Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum)
-    const {
-  auto const& m = angular_momentum;
-  auto const& m_coordinates = m.coordinates();
-
-  auto const& I₁ = moments_of_inertia_.x;
-  auto const& I₂ = moments_of_inertia_.y;
-  auto const& I₃ = moments_of_inertia_.z;
-  Bivector<Quotient<AngularMomentum, MomentOfInertia>, PrincipalAxesFrame> const
-      ω({m_coordinates.x / I₁, m_coordinates.y / I₂, m_coordinates.z / I₃});
-
-  return ω;
-}
-
 template<typename InertialFrame, typename PrincipalAxesFrame>
 typename EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeRotation
-EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeAt(
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeFor(
     Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
-    Instant const& time) const {
+    Instant const& time,
+    double const sn,
+    double const cn,
+    Angle const& elliptic_π) const {
   Rotation<PreferredPrincipalAxesFrame, ℬₜ> const 𝒫ₜ =
       Compute𝒫ₜ(𝒮_(angular_momentum));
 
   Time const Δt = time - initial_time_;
   Angle ψ = ψ_t_multiplier_ * Δt;
   switch (formula_) {
-    case Formula::i: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
-      Angle const φ = JacobiAmplitude(λ_ * Δt - ν_, mc_);
-      ψ += ψ_elliptic_pi_multiplier_ * EllipticΠ(φ, n_, mc_) +
-           ψ_arctan_multiplier_ *
-               ArcTan(ψ_sn_multiplier_ * sn, ψ_cn_multiplier_ * cn) -
-           ψ_offset_;
-      break;
-    }
+    case Formula::i:
     case Formula::ii: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
-      Angle const φ = JacobiAmplitude(λ_ * Δt - ν_, mc_);
-      ψ += ψ_elliptic_pi_multiplier_ * EllipticΠ(φ, n_, mc_) +
+      ψ += ψ_elliptic_pi_multiplier_ * elliptic_π +
            ψ_arctan_multiplier_ *
                ArcTan(ψ_sn_multiplier_ * sn, ψ_cn_multiplier_ * cn) -
            ψ_offset_;
@@ -398,45 +528,9 @@ EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeAt(
 }
 
 template<typename InertialFrame, typename PrincipalAxesFrame>
-Rotation<typename EulerSolver<InertialFrame,
-                              PrincipalAxesFrame>::PreferredPrincipalAxesFrame,
-         typename EulerSolver<InertialFrame, PrincipalAxesFrame>::ℬₜ>
-EulerSolver<InertialFrame, PrincipalAxesFrame>::Compute𝒫ₜ(
-    PreferredAngularMomentumBivector const& angular_momentum) const {
-  auto const& m = angular_momentum;
-  auto m_coordinates = m.coordinates();
-
-  Quaternion pₜ;
-  switch (region_) {
-    case Region::e₁: {
-      double const real_part = Sqrt(0.5 * (1 + m_coordinates.x / G_));
-      AngularMomentum const denominator = 2 * G_ * real_part;
-      pₜ = Quaternion(real_part,
-                      {0,
-                        m_coordinates.z / denominator,
-                        -m_coordinates.y / denominator});
-      break;
-    }
-    case Region::e₃: {
-      double const real_part = Sqrt(0.5 * (1 + m_coordinates.z / G_));
-      AngularMomentum const denominator = 2 * G_ * real_part;
-      pₜ = Quaternion(real_part,
-                      {m_coordinates.y / denominator,
-                        -m_coordinates.x / denominator,
-                        0});
-      break;
-    }
-    case Region::Motionless: {
-      pₜ = Quaternion(1);
-      break;
-    }
-    default:
-      LOG(FATAL) << "Unexpected region " << static_cast<int>(region_);
-  }
-
-  Rotation<PreferredPrincipalAxesFrame, ℬₜ> const 𝒫ₜ(pₜ);
-
-  return 𝒫ₜ;
+bool EulerSolver<InertialFrame, PrincipalAxesFrame>::UsesEllipticFunctions()
+    const {
+  return formula_ == Formula::i || formula_ == Formula::ii;
 }
 
 }  // namespace internal_euler_solver
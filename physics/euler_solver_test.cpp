@@ -1168,5 +1168,47 @@ TEST_F(EulerSolverTest, Toutatis) {
   }
 }
 
+TEST_F(EulerSolverTest, Batch) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> moment_of_inertia_distribution(0.0, 10.0);
+  std::uniform_real_distribution<> angular_momentum_distribution(-10.0, 10.0);
+  std::vector<Instant> times;
+  for (Time t = -100 * Second; t <= 100 * Second; t += 0.7 * Second) {
+    times.push_back(Instant() + t);
+  }
+  for (int i = 0; i < 100; ++i) {
+    std::array<double, 3> randoms{moment_of_inertia_distribution(random),
+                                  moment_of_inertia_distribution(random),
+                                  moment_of_inertia_distribution(random)};
+    std::sort(randoms.begin(), randoms.end());
+    R3Element<MomentOfInertia> const moments_of_inertia{
+        randoms[0] * SIUnit<MomentOfInertia>(),
+        randoms[1] * SIUnit<MomentOfInertia>(),
+        randoms[2] * SIUnit<MomentOfInertia>()};
+
+    Bivector<AngularMomentum, PrincipalAxes>
+        initial_angular_momentum(
+            {angular_momentum_distribution(random) * SIUnit<AngularMomentum>(),
+             angular_momentum_distribution(random) * SIUnit<AngularMomentum>(),
+             angular_momentum_distribution(random) *
+                 SIUnit<AngularMomentum>()});
+
+    Solver const solver(moments_of_inertia,
+                        identity_attitude_(initial_angular_momentum),
+                        identity_attitude_,
+                        Instant());
+    auto const angular_momenta = solver.AngularMomentaAt(times);
+    auto const attitudes = solver.AttitudesAt(angular_momenta, times);
+    ASSERT_EQ(times.size(), angular_momenta.size());
+    ASSERT_EQ(times.size(), attitudes.size());
+    for (int j = 0; j < times.size(); ++j) {
+      auto const angular_momentum = solver.AngularMomentumAt(times[j]);
+      EXPECT_EQ(angular_momentum, angular_momenta[j]) << times[j];
+      EXPECT_EQ(solver.AttitudeAt(angular_momentum, times[j]).quaternion(),
+                attitudes[j].quaternion()) << times[j];
+    }
+  }
+}
+
 }  // namespace physics
 }  // namespace principia
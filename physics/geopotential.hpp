@@ -6,6 +6,7 @@
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/named_quantities.hpp"
+#include "geometry/symmetric_bilinear_form.hpp"
 #include "numerics/polynomial.hpp"
 #include "numerics/polynomial_evaluators.hpp"
 #include "physics/oblate_body.hpp"
@@ -19,6 +20,7 @@ using base::not_null;
 using geometry::Displacement;
 using geometry::Frame;
 using geometry::Instant;
+using geometry::SymmetricBilinearForm;
 using geometry::Vector;
 using numerics::PolynomialInMonomialBasis;
 using quantities::Acceleration;
@@ -96,6 +98,15 @@ class Geopotential {
       Square<Length> const& r²,
       Exponentiation<Length, -3> const& one_over_r³) const;
 
+  // The gradient of |GeneralSphericalHarmonicsAcceleration| with respect to
+  // |r|.  Multiplied by the gravitational parameter, this is the contribution
+  // of the harmonics to the gravity-gradient tensor.  It is computed by central
+  // differences with a step of 2⁻¹⁷ ‖r‖, which balances the truncation and
+  // cancellation errors, and symmetrized.
+  SymmetricBilinearForm<Exponentiation<Length, -3>, Frame, Vector>
+  GeneralSphericalHarmonicsGradient(Instant const& t,
+                                    Displacement<Frame> const& r) const;
+
   std::vector<HarmonicDamping> const& degree_damping() const;
   HarmonicDamping const& sectoral_damping() const;
 
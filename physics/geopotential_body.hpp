@@ -3,6 +3,7 @@
 #include "physics/geopotential.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <queue>
 #include <vector>
@@ -10,6 +11,7 @@
 #include "base/tags.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/r3_element.hpp"
+#include "geometry/r3x3_matrix.hpp"
 #include "numerics/fixed_arrays.hpp"
 #include "numerics/legendre_normalization_factor.mathematica.h"
 #include "numerics/max_abs_normalized_associated_legendre_function.mathematica.h"
@@ -31,6 +33,7 @@ using numerics::MaxAbsNormalizedAssociatedLegendreFunction;
 using geometry::Bivector;
 using geometry::InnerProduct;
 using geometry::R3Element;
+using geometry::R3x3Matrix;
 using quantities::ArcTan;
 using quantities::Cos;
 using quantities::Derivative;
@@ -40,6 +43,7 @@ using quantities::Pow;
 using quantities::Sqrt;
 using quantities::Sin;
 using quantities::SIUnit;
+using quantities::si::Metre;
 
 // The notation in this file follows documentation/Geopotential.pdf.
 
@@ -675,6 +679,37 @@ Geopotential<Frame>::GeneralSphericalHarmonicsAcceleration(
 
 #undef PRINCIPIA_CASE_SPHERICAL_HARMONICS
 
+template<typename Frame>
+SymmetricBilinearForm<Exponentiation<Length, -3>, Frame, Vector>
+Geopotential<Frame>::GeneralSphericalHarmonicsGradient(
+    Instant const& t,
+    Displacement<Frame> const& r) const {
+  auto const acceleration = [this, &t](Displacement<Frame> const& r) {
+    Square<Length> const r² = r.Norm²();
+    Length const r_norm = Sqrt(r²);
+    Exponentiation<Length, -3> const one_over_r³ = r_norm / (r² * r²);
+    return GeneralSphericalHarmonicsAcceleration(
+        t, r, r_norm, r², one_over_r³);
+  };
+
+  // The step is a power of 2 times ‖r‖, so that 2 h is exact.
+  Length const h = r.Norm() * 0x1p-17;
+  std::array<Displacement<Frame>, 3> const steps = {
+      Displacement<Frame>({h, 0 * Metre, 0 * Metre}),
+      Displacement<Frame>({0 * Metre, h, 0 * Metre}),
+      Displacement<Frame>({0 * Metre, 0 * Metre, h})};
+  R3x3Matrix<Exponentiation<Length, -3>> jacobian;
+  for (int j = 0; j < 3; ++j) {
+    auto const column = ((acceleration(r + steps[j]) -
+                          acceleration(r - steps[j])) / (2 * h)).coordinates();
+    jacobian(0, j) = column.x;
+    jacobian(1, j) = column.y;
+    jacobian(2, j) = column.z;
+  }
+  return SymmetricBilinearForm<Exponentiation<Length, -3>, Frame, Vector>(
+      (jacobian + jacobian.Transpose()) / 2);
+}
+
 template<typename Frame>
 std::vector<HarmonicDamping> const& Geopotential<Frame>::degree_damping()
     const {
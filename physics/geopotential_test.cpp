@@ -204,6 +204,37 @@ TEST_F(GeopotentialTest, J2) {
   }
 }
 
+TEST_F(GeopotentialTest, Gradient) {
+  OblateBody<World> const body =
+      OblateBody<World>(massive_body_parameters_,
+                        rotating_body_parameters_,
+                        OblateBody<World>::Parameters(/*j2=*/6, 1 * Metre));
+  Geopotential<World> const geopotential(&body, /*tolerance=*/0);
+  Displacement<World> const r({6 * Metre, -4 * Metre, 5 * Metre});
+  auto const gradient =
+      geopotential.GeneralSphericalHarmonicsGradient(Instant(), r);
+
+  // The potential is harmonic outside of the body.
+  EXPECT_THAT(gradient.coordinates().Trace(),
+              VanishesBefore(1 * Pow<-3>(Metre), 0, 100'000));
+
+  // Compare with the differences of the accelerations for a step much larger
+  // than that used by the implementation.
+  for (auto const& δr : {Displacement<World>({1e-3 * Metre,
+                                              0 * Metre,
+                                              0 * Metre}),
+                         Displacement<World>({0 * Metre,
+                                              -1e-3 * Metre,
+                                              2e-3 * Metre})}) {
+    auto const expected =
+        (GeneralSphericalHarmonicsAcceleration(
+             geopotential, Instant(), r + δr) -
+         GeneralSphericalHarmonicsAcceleration(
+             geopotential, Instant(), r - δr)) / 2;
+    EXPECT_THAT(RelativeError(expected, gradient * δr), Lt(1e-6));
+  }
+}
+
 TEST_F(GeopotentialTest, C22S22) {
   serialization::OblateBody::Geopotential message;
   {
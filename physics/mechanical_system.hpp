@@ -62,10 +62,23 @@ class MechanicalSystem {
   // |SystemFrame|, i.e., the centre of mass of the system.
   InertiaTensor<SystemFrame> InertiaTensor() const;
 
+  struct Moments {
+    DegreesOfFreedom<InertialFrame> centre_of_mass;
+    Bivector<quantities::AngularMomentum, SystemFrame> angular_momentum;
+    geometry::InertiaTensor<SystemFrame> inertia_tensor;
+  };
+  // Returns the results of |centre_of_mass()|, |AngularMomentum()| and
+  // |InertiaTensor()|, computed in a single traversal of the bodies.  Prefer
+  // this to calling these functions separately when more than one of them is
+  // needed.
+  Moments ComputeMoments() const;
+
  private:
-  BarycentreCalculator<DegreesOfFreedom<InertialFrame>, Mass> centre_of_mass_;
-  std::vector<std::pair<DegreesOfFreedom<InertialFrame>, Mass>>
-      body_linear_motions_;
+  Mass mass_;
+  // The linear motions of the bodies, stored as parallel arrays so that they
+  // may be reduced in bulk.
+  std::vector<DegreesOfFreedom<InertialFrame>> body_degrees_of_freedom_;
+  std::vector<Mass> body_masses_;
   // The sum of the intrinsic angular momenta of the bodies, i.e., of the
   // angular momenta with respect to their individual centres of mass.  This is
   // not the total angular momentum, to which the linear motions of the bodies
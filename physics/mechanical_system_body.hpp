@@ -2,17 +2,23 @@
 
 #include "physics/mechanical_system.hpp"
 
+#include <cstdint>
+#include <tuple>
+
 namespace principia {
 namespace physics {
 namespace internal_mechanical_system {
 
 using geometry::Displacement;
 using geometry::OrthogonalMap;
+using geometry::PairwiseSum;
 using geometry::SymmetricProduct;
 using geometry::Vector;
 using geometry::Velocity;
 using geometry::Wedge;
+using quantities::Length;
 using quantities::Momentum;
+using quantities::Product;
 using quantities::si::Radian;
 
 template<typename InertialFrame, typename SystemFrame>
@@ -26,8 +32,9 @@ void MechanicalSystem<InertialFrame, SystemFrame>::AddRigidBody(
   SymmetricBilinearForm<MomentOfInertia, InertialFrame, Vector> const
       inertia_tensor_in_inertial_axes =
           motion.orthogonal_map()(inertia_tensor.AnticommutatorInverse());
-  centre_of_mass_.Add(degrees_of_freedom, mass);
-  body_linear_motions_.emplace_back(degrees_of_freedom, mass);
+  mass_ += mass;
+  body_degrees_of_freedom_.push_back(degrees_of_freedom);
+  body_masses_.push_back(mass);
   sum_of_inertia_tensors_ += inertia_tensor_in_inertial_axes;
   sum_of_intrinsic_angular_momenta_ +=
       Anticommutator(inertia_tensor_in_inertial_axes,
@@ -37,7 +44,7 @@ void MechanicalSystem<InertialFrame, SystemFrame>::AddRigidBody(
 template<typename InertialFrame, typename SystemFrame>
 RigidMotion<SystemFrame, InertialFrame>
 MechanicalSystem<InertialFrame, SystemFrame>::LinearMotion() const {
-  DegreesOfFreedom<InertialFrame> const centre_of_mass = centre_of_mass_.Get();
+  DegreesOfFreedom<InertialFrame> const centre_of_mass = this->centre_of_mass();
   return RigidMotion<SystemFrame, InertialFrame>(
       RigidTransformation<SystemFrame, InertialFrame>(
           SystemFrame::origin,
@@ -49,50 +56,96 @@ MechanicalSystem<InertialFrame, SystemFrame>::LinearMotion() const {
 
 template<typename InertialFrame, typename SystemFrame>
 Mass const& MechanicalSystem<InertialFrame, SystemFrame>::mass() const {
-  return centre_of_mass_.weight();
+  return mass_;
 }
 
 template<typename InertialFrame, typename SystemFrame>
 DegreesOfFreedom<InertialFrame>
 MechanicalSystem<InertialFrame, SystemFrame>::centre_of_mass() const {
-  return centre_of_mass_.Get();
+  BarycentreCalculator<DegreesOfFreedom<InertialFrame>, Mass> calculator;
+  calculator.Add(body_degrees_of_freedom_, body_masses_);
+  return calculator.Get();
 }
 
 template<typename InertialFrame, typename SystemFrame>
 Bivector<AngularMomentum, SystemFrame>
 MechanicalSystem<InertialFrame, SystemFrame>::AngularMomentum() const {
-  RigidMotion<InertialFrame, SystemFrame> const to_system_frame =
-      LinearMotion().Inverse();
-  Bivector<quantities::AngularMomentum, SystemFrame> result =
-      to_system_frame.orthogonal_map()(sum_of_intrinsic_angular_momenta_);
-  for (auto const& [degrees_of_freedom, m] : body_linear_motions_) {
-    DegreesOfFreedom<SystemFrame> const degrees_of_freedom_in_system_frame =
-        to_system_frame(degrees_of_freedom);
-    Displacement<SystemFrame> const r =
-        degrees_of_freedom_in_system_frame.position() - SystemFrame::origin;
-    Velocity<SystemFrame> const v =
-        degrees_of_freedom_in_system_frame.velocity();
-    Vector<Momentum, SystemFrame> const p = m * v;
-    result += Wedge(r, p) * Radian;
-  }
-  return result;
+  return ComputeMoments().angular_momentum;
 }
 
 template<typename InertialFrame, typename SystemFrame>
 InertiaTensor<SystemFrame>
 MechanicalSystem<InertialFrame, SystemFrame>::InertiaTensor() const {
-  RigidMotion<InertialFrame, SystemFrame> const to_system_frame =
-      LinearMotion().Inverse();
-  SymmetricBilinearForm<MomentOfInertia, SystemFrame, Vector> result =
-      to_system_frame.orthogonal_map()(sum_of_inertia_tensors_);
-  for (auto const& [degrees_of_freedom, m] : body_linear_motions_) {
-    DegreesOfFreedom<SystemFrame> const degrees_of_freedom_in_system_frame =
-        to_system_frame(degrees_of_freedom);
-    Displacement<SystemFrame> const r =
-        degrees_of_freedom_in_system_frame.position() - SystemFrame::origin;
-    result += m * SymmetricProduct(r, r);
-  }
-  return result.Anticommutator();
+  return ComputeMoments().inertia_tensor;
+}
+
+template<typename InertialFrame, typename SystemFrame>
+typename MechanicalSystem<InertialFrame, SystemFrame>::Moments
+MechanicalSystem<InertialFrame, SystemFrame>::ComputeMoments() const {
+  CHECK(!body_degrees_of_freedom_.empty()) << "Empty MechanicalSystem";
+  // The second moments are first taken with respect to the motion of the
+  // first body, since the centre of mass is only known at the end of the
+  // traversal.  That reference is close to the other bodies, so that the
+  // corrections below do not suffer from cancellations.  The centre of mass
+  // itself is accumulated as in |centre_of_mass()|, so that both agree.
+  DegreesOfFreedom<InertialFrame> const& reference =
+      body_degrees_of_freedom_.front();
+  auto const [mass,
+              absolute_first_moment,
+              absolute_linear_momentum,
+              first_moment,
+              linear_momentum,
+              second_moment,
+              angular_momentum] =
+      PairwiseSum<Mass,
+                  Vector<Product<Mass, Length>, InertialFrame>,
+                  Vector<Momentum, InertialFrame>,
+                  Vector<Product<Mass, Length>, InertialFrame>,
+                  Vector<Momentum, InertialFrame>,
+                  SymmetricBilinearForm<MomentOfInertia, InertialFrame, Vector>,
+                  Bivector<quantities::AngularMomentum, InertialFrame>>(
+          body_degrees_of_freedom_.size(),
+          [this, &reference](std::int64_t const i) {
+            Mass const& m = body_masses_[i];
+            DegreesOfFreedom<InertialFrame> const& degrees_of_freedom =
+                body_degrees_of_freedom_[i];
+            RelativeDegreesOfFreedom<InertialFrame> const relative =
+                degrees_of_freedom - reference;
+            Displacement<InertialFrame> const r = relative.displacement();
+            Vector<Momentum, InertialFrame> const p = m * relative.velocity();
+            return std::tuple(
+                m,
+                (degrees_of_freedom.position() - InertialFrame::origin) * m,
+                degrees_of_freedom.velocity() * m,
+                m * r,
+                p,
+                m * SymmetricProduct(r, r),
+                Wedge(r, p) * Radian);
+          });
+  Displacement<InertialFrame> const centre_of_mass_displacement =
+      first_moment / mass;
+  Velocity<InertialFrame> const centre_of_mass_velocity =
+      linear_momentum / mass;
+
+  // With c the centre of mass relative to the reference,
+  //   ∑ mᵢ (rᵢ - c) ⊙ (rᵢ - c) = ∑ mᵢ rᵢ ⊙ rᵢ - m c ⊙ c, and
+  //   ∑ mᵢ (rᵢ - c) ∧ (vᵢ - ċ) = ∑ mᵢ rᵢ ∧ vᵢ - m c ∧ ċ.
+  auto const to_system_frame =
+      OrthogonalMap<InertialFrame, SystemFrame>::Identity();
+  SymmetricBilinearForm<MomentOfInertia, SystemFrame, Vector> const
+      inertia_tensor = to_system_frame(
+          sum_of_inertia_tensors_ + second_moment -
+          mass * SymmetricProduct(centre_of_mass_displacement,
+                                  centre_of_mass_displacement));
+  Bivector<quantities::AngularMomentum, SystemFrame> const
+      total_angular_momentum = to_system_frame(
+          sum_of_intrinsic_angular_momenta_ + angular_momentum -
+          Wedge(centre_of_mass_displacement,
+                mass * centre_of_mass_velocity) * Radian);
+  return {{InertialFrame::origin + absolute_first_moment / mass,
+           absolute_linear_momentum / mass},
+          total_angular_momentum,
+          inertia_tensor.Anticommutator()};
 }
 
 }  // namespace internal_mechanical_system
@@ -1,8 +1,11 @@
 ﻿
 #include "physics/mechanical_system.hpp"
 
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "testing_utilities/almost_equals.hpp"
 #include "testing_utilities/componentwise.hpp"
 
 namespace principia {
@@ -16,10 +19,13 @@ using geometry::Identity;
 using geometry::Inertial;
 using geometry::NonRotating;
 using geometry::OrthogonalMap;
+using geometry::Position;
 using geometry::R3x3Matrix;
+using geometry::SymmetricProduct;
 using geometry::SymmetricBilinearForm;
 using geometry::Vector;
 using geometry::Velocity;
+using geometry::Wedge;
 using physics::RigidMotion;
 using physics::RigidTransformation;
 using quantities::AngularMomentum;
@@ -29,12 +35,14 @@ using quantities::Mass;
 using quantities::MomentOfInertia;
 using quantities::Momentum;
 using quantities::Pow;
+using quantities::Product;
 using quantities::Speed;
 using quantities::si::Kilogram;
 using quantities::si::Metre;
 using quantities::si::Radian;
 using quantities::si::Second;
 using quantities::si::Tonne;
+using testing_utilities::AlmostEquals;
 using testing_utilities::Componentwise;
 using ::testing::Eq;
 
@@ -215,5 +223,80 @@ TEST_F(MechanicalSystemTest, NonRigidTwoCubes) {
               Eq(Bivector<AngularMomentum, SystemFrame>{}));
 }
 
+TEST_F(MechanicalSystemTest, ManyPointMasses) {
+  // Point masses scattered around a vessel far from the origin of
+  // |InertialFrame|.  The expected moments are computed from the exact offsets
+  // of the masses with respect to the vessel.
+  using Body = Frame<enum class BodyTag>;
+  Position<InertialFrame> const vessel =
+      InertialFrame::origin +
+      Displacement<InertialFrame>({7e6 * Metre, -3e6 * Metre, 1e6 * Metre});
+  Velocity<InertialFrame> const vessel_velocity(
+      {1e3 * Metre / Second, 7e3 * Metre / Second, -2e3 * Metre / Second});
+  std::vector<Displacement<InertialFrame>> offsets;
+  std::vector<Velocity<InertialFrame>> relative_velocities;
+  std::vector<Mass> masses;
+  for (int i = 0; i < 200; ++i) {
+    offsets.emplace_back(Displacement<InertialFrame>(
+        {(i % 7) * Metre, (i % 11) * Metre, (i % 13) * 0.5 * Metre}));
+    relative_velocities.emplace_back(
+        Velocity<InertialFrame>({(i % 5) * Metre / Second,
+                                 (i % 3) * -Metre / Second,
+                                 (i % 17) * 0.25 * Metre / Second}));
+    masses.push_back((1 + i % 19) * Kilogram);
+    system_.AddRigidBody(
+        RigidMotion<Body, InertialFrame>(
+            RigidTransformation<Body, InertialFrame>(
+                Body::origin,
+                vessel + offsets.back(),
+                OrthogonalMap<Body, InertialFrame>::Identity()),
+            InertialFrame::nonrotating,
+            vessel_velocity + relative_velocities.back()),
+        masses.back(),
+        SymmetricBilinearForm<MomentOfInertia, Body, Bivector>{});
+  }
+
+  Mass total_mass;
+  Vector<Product<Mass, Length>, InertialFrame> first_moment;
+  Vector<Momentum, InertialFrame> linear_momentum;
+  for (int i = 0; i < masses.size(); ++i) {
+    total_mass += masses[i];
+    first_moment += masses[i] * offsets[i];
+    linear_momentum += masses[i] * relative_velocities[i];
+  }
+  Displacement<InertialFrame> const c = first_moment / total_mass;
+  Velocity<InertialFrame> const ċ = linear_momentum / total_mass;
+  Bivector<AngularMomentum, InertialFrame> angular_momentum;
+  SymmetricBilinearForm<MomentOfInertia, InertialFrame, Vector> inertia;
+  for (int i = 0; i < masses.size(); ++i) {
+    Displacement<InertialFrame> const r = offsets[i] - c;
+    Velocity<InertialFrame> const v = relative_velocities[i] - ċ;
+    angular_momentum += Wedge(r, masses[i] * v) * Radian;
+    inertia += masses[i] * SymmetricProduct(r, r);
+  }
+
+  auto const moments = system_.ComputeMoments();
+  EXPECT_THAT(moments.centre_of_mass,
+              Componentwise(AlmostEquals(vessel + c, 0),
+                            AlmostEquals(vessel_velocity + ċ, 0)));
+  // The z component of the angular momentum is small compared to the
+  // individual terms, hence the cancellations.
+  EXPECT_THAT(
+      moments.angular_momentum,
+      AlmostEquals(
+          Identity<InertialFrame, SystemFrame>()(angular_momentum), 1128));
+  auto const& actual_inertia = moments.inertia_tensor.coordinates();
+  auto const expected_inertia = inertia.Anticommutator().coordinates();
+  EXPECT_THAT(actual_inertia.row_x(),
+              AlmostEquals(expected_inertia.row_x(), 92));
+  EXPECT_THAT(actual_inertia.row_y(),
+              AlmostEquals(expected_inertia.row_y(), 17));
+  EXPECT_THAT(actual_inertia.row_z(),
+              AlmostEquals(expected_inertia.row_z(), 92));
+  EXPECT_THAT(system_.centre_of_mass(), Eq(moments.centre_of_mass));
+  EXPECT_THAT(system_.AngularMomentum(), Eq(moments.angular_momentum));
+  EXPECT_THAT(system_.InertiaTensor(), Eq(moments.inertia_tensor));
+}
+
 }  // namespace physics
 }  // namespace principia
@@ -3,7 +3,9 @@
 
 #include <functional>
 #include <type_traits>
+#include <vector>
 
+#include "absl/types/span.h"
 #include "base/not_null.hpp"
 #include "geometry/affine_map.hpp"
 #include "geometry/named_quantities.hpp"
@@ -61,6 +63,11 @@ class RigidMotion final {
   DegreesOfFreedom<ToFrame> operator()(
       DegreesOfFreedom<FromFrame> const& degrees_of_freedom) const;
 
+  // Applies this motion to all the elements of |degrees_of_freedom|, see
+  // |Rotation|.
+  std::vector<DegreesOfFreedom<ToFrame>> operator()(
+      absl::Span<DegreesOfFreedom<FromFrame> const> degrees_of_freedom) const;
+
   RigidMotion<ToFrame, FromFrame> Inverse() const;
 
   template<typename F = FromFrame,
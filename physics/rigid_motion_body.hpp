@@ -3,6 +3,8 @@
 
 #include "physics/rigid_motion.hpp"
 
+#include <vector>
+
 #include "geometry/identity.hpp"
 #include "geometry/linear_map.hpp"
 
@@ -69,6 +71,35 @@ DegreesOfFreedom<ToFrame> RigidMotion<FromFrame, ToFrame>::operator()(
                   Radian)};
 }
 
+template<typename FromFrame, typename ToFrame>
+std::vector<DegreesOfFreedom<ToFrame>>
+RigidMotion<FromFrame, ToFrame>::operator()(
+    absl::Span<DegreesOfFreedom<FromFrame> const> const degrees_of_freedom)
+    const {
+  Position<FromFrame> const to_frame_origin =
+      rigid_transformation_.Inverse()(ToFrame::origin);
+  std::vector<Position<FromFrame>> positions;
+  std::vector<Velocity<FromFrame>> velocities;
+  positions.reserve(degrees_of_freedom.size());
+  velocities.reserve(degrees_of_freedom.size());
+  for (auto const& dof : degrees_of_freedom) {
+    positions.push_back(dof.position());
+    velocities.push_back(dof.velocity() - velocity_of_to_frame_origin_ -
+                         angular_velocity_of_to_frame_ *
+                             (dof.position() - to_frame_origin) / Radian);
+  }
+  std::vector<Position<ToFrame>> const images_of_positions =
+      rigid_transformation_(absl::MakeConstSpan(positions));
+  std::vector<Velocity<ToFrame>> const images_of_velocities =
+      orthogonal_map()(absl::MakeConstSpan(velocities));
+  std::vector<DegreesOfFreedom<ToFrame>> images;
+  images.reserve(degrees_of_freedom.size());
+  for (std::size_t i = 0; i < degrees_of_freedom.size(); ++i) {
+    images.emplace_back(images_of_positions[i], images_of_velocities[i]);
+  }
+  return images;
+}
+
 template<typename FromFrame, typename ToFrame>
 RigidMotion<ToFrame, FromFrame>
 RigidMotion<FromFrame, ToFrame>::Inverse() const {
@@ -1,6 +1,8 @@
 ﻿
 #include "physics/rigid_motion.hpp"
 
+#include <vector>
+
 #include "geometry/frame.hpp"
 #include "geometry/permutation.hpp"
 #include "geometry/quaternion.hpp"
@@ -221,6 +223,29 @@ TEST_F(RigidMotionTest, GroupoidInverse) {
   EXPECT_THAT(d2.velocity(), AlmostEquals(degrees_of_freedom_.velocity(), 6));
 }
 
+TEST_F(RigidMotionTest, AppliedToDegreesOfFreedom) {
+  auto const terrestrial_to_lunar = selenocentric_to_lunar_ *
+                                    geocentric_to_selenocentric_ *
+                                    geocentric_to_terrestrial_.Inverse();
+  std::vector<DegreesOfFreedom<Terrestrial>> const degrees_of_freedom = {
+      degrees_of_freedom_,
+      {Terrestrial::origin, Terrestrial::unmoving},
+      {degrees_of_freedom_.position() +
+           Displacement<Terrestrial>(
+               {earth_moon_distance_, 0 * Metre, -earth_moon_distance_}),
+       -2 * degrees_of_freedom_.velocity()}};
+  std::vector<DegreesOfFreedom<Lunar>> const images =
+      terrestrial_to_lunar(absl::MakeConstSpan(degrees_of_freedom));
+  ASSERT_EQ(degrees_of_freedom.size(), images.size());
+  for (std::size_t i = 0; i < degrees_of_freedom.size(); ++i) {
+    DegreesOfFreedom<Lunar> const image =
+        terrestrial_to_lunar(degrees_of_freedom[i]);
+    EXPECT_THAT(images[i].position() - Lunar::origin,
+                AlmostEquals(image.position() - Lunar::origin, 0, 4));
+    EXPECT_THAT(images[i].velocity(), AlmostEquals(image.velocity(), 0, 4));
+  }
+}
+
 TEST_F(RigidMotionTest, SecondConstructor) {
   auto const terrestrial_to_selenocentric1 =
       geocentric_to_selenocentric_ * geocentric_to_terrestrial_.Inverse();
@@ -0,0 +1,75 @@
+﻿
+#pragma once
+
+#include <string>
+
+#include "geometry/r3x3_matrix.hpp"
+#include "physics/degrees_of_freedom.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/quantities.hpp"
+
+namespace principia {
+namespace physics {
+namespace internal_state_transition_matrix {
+
+using geometry::R3x3Matrix;
+using quantities::Frequency;
+using quantities::Time;
+
+// The matrix of the partial derivatives of the degrees of freedom (q, v) of a
+// massless body at some time t with respect to its degrees of freedom (q₀, v₀)
+// at some initial time t₀, expressed in the coordinates of |Frame|.  The 6×6
+// matrix is made of four 3×3 blocks of different dimensions:
+//   ⎛∂q/∂q₀ ∂q/∂v₀⎞
+//   ⎝∂v/∂q₀ ∂v/∂v₀⎠
+template<typename Frame>
+class StateTransitionMatrix final {
+ public:
+  // The identity, i.e., the matrix for t = t₀.
+  StateTransitionMatrix();
+  StateTransitionMatrix(R3x3Matrix<double> const& position_wrt_position,
+                        R3x3Matrix<Time> const& position_wrt_velocity,
+                        R3x3Matrix<Frequency> const& velocity_wrt_position,
+                        R3x3Matrix<double> const& velocity_wrt_velocity);
+
+  R3x3Matrix<double> const& position_wrt_position() const;
+  R3x3Matrix<Time> const& position_wrt_velocity() const;
+  R3x3Matrix<Frequency> const& velocity_wrt_position() const;
+  R3x3Matrix<double> const& velocity_wrt_velocity() const;
+
+  // Returns, to first order, the variation of the degrees of freedom at t that
+  // results from the variation |δ| of the degrees of freedom at t₀.
+  RelativeDegreesOfFreedom<Frame> operator()(
+      RelativeDegreesOfFreedom<Frame> const& δ) const;
+
+ private:
+  R3x3Matrix<double> position_wrt_position_;
+  R3x3Matrix<Time> position_wrt_velocity_;
+  R3x3Matrix<Frequency> velocity_wrt_position_;
+  R3x3Matrix<double> velocity_wrt_velocity_;
+};
+
+// If |left| is the matrix from t₁ to t₂ and |right| the matrix from t₀ to t₁,
+// returns the matrix from t₀ to t₂.
+template<typename Frame>
+StateTransitionMatrix<Frame> operator*(
+    StateTransitionMatrix<Frame> const& left,
+    StateTransitionMatrix<Frame> const& right);
+
+template<typename Frame>
+std::string DebugString(
+    StateTransitionMatrix<Frame> const& state_transition_matrix);
+
+template<typename Frame>
+std::ostream& operator<<(
+    std::ostream& out,
+    StateTransitionMatrix<Frame> const& state_transition_matrix);
+
+}  // namespace internal_state_transition_matrix
+
+using internal_state_transition_matrix::StateTransitionMatrix;
+
+}  // namespace physics
+}  // namespace principia
+
+#include "physics/state_transition_matrix_body.hpp"
@@ -0,0 +1,104 @@
+﻿
+#pragma once
+
+#include "physics/state_transition_matrix.hpp"
+
+#include <string>
+
+#include "geometry/grassmann.hpp"
+
+namespace principia {
+namespace physics {
+namespace internal_state_transition_matrix {
+
+using geometry::Displacement;
+using geometry::Velocity;
+
+template<typename Frame>
+StateTransitionMatrix<Frame>::StateTransitionMatrix()
+    : position_wrt_position_(R3x3Matrix<double>::Identity()),
+      velocity_wrt_velocity_(R3x3Matrix<double>::Identity()) {}
+
+template<typename Frame>
+StateTransitionMatrix<Frame>::StateTransitionMatrix(
+    R3x3Matrix<double> const& position_wrt_position,
+    R3x3Matrix<Time> const& position_wrt_velocity,
+    R3x3Matrix<Frequency> const& velocity_wrt_position,
+    R3x3Matrix<double> const& velocity_wrt_velocity)
+    : position_wrt_position_(position_wrt_position),
+      position_wrt_velocity_(position_wrt_velocity),
+      velocity_wrt_position_(velocity_wrt_position),
+      velocity_wrt_velocity_(velocity_wrt_velocity) {}
+
+template<typename Frame>
+R3x3Matrix<double> const&
+StateTransitionMatrix<Frame>::position_wrt_position() const {
+  return position_wrt_position_;
+}
+
+template<typename Frame>
+R3x3Matrix<Time> const&
+StateTransitionMatrix<Frame>::position_wrt_velocity() const {
+  return position_wrt_velocity_;
+}
+
+template<typename Frame>
+R3x3Matrix<Frequency> const&
+StateTransitionMatrix<Frame>::velocity_wrt_position() const {
+  return velocity_wrt_position_;
+}
+
+template<typename Frame>
+R3x3Matrix<double> const&
+StateTransitionMatrix<Frame>::velocity_wrt_velocity() const {
+  return velocity_wrt_velocity_;
+}
+
+template<typename Frame>
+RelativeDegreesOfFreedom<Frame> StateTransitionMatrix<Frame>::operator()(
+    RelativeDegreesOfFreedom<Frame> const& δ) const {
+  auto const& δq₀ = δ.displacement().coordinates();
+  auto const& δv₀ = δ.velocity().coordinates();
+  return RelativeDegreesOfFreedom<Frame>(
+      Displacement<Frame>(position_wrt_position_ * δq₀ +
+                          position_wrt_velocity_ * δv₀),
+      Velocity<Frame>(velocity_wrt_position_ * δq₀ +
+                      velocity_wrt_velocity_ * δv₀));
+}
+
+template<typename Frame>
+StateTransitionMatrix<Frame> operator*(
+    StateTransitionMatrix<Frame> const& left,
+    StateTransitionMatrix<Frame> const& right) {
+  return StateTransitionMatrix<Frame>(
+      left.position_wrt_position() * right.position_wrt_position() +
+          left.position_wrt_velocity() * right.velocity_wrt_position(),
+      left.position_wrt_position() * right.position_wrt_velocity() +
+          left.position_wrt_velocity() * right.velocity_wrt_velocity(),
+      left.velocity_wrt_position() * right.position_wrt_position() +
+          left.velocity_wrt_velocity() * right.velocity_wrt_position(),
+      left.velocity_wrt_position() * right.position_wrt_velocity() +
+          left.velocity_wrt_velocity() * right.velocity_wrt_velocity());
+}
+
+template<typename Frame>
+std::string DebugString(
+    StateTransitionMatrix<Frame> const& state_transition_matrix) {
+  return "{" +
+         DebugString(state_transition_matrix.position_wrt_position()) + ", " +
+         DebugString(state_transition_matrix.position_wrt_velocity()) + ", " +
+         DebugString(state_transition_matrix.velocity_wrt_position()) + ", " +
+         DebugString(state_transition_matrix.velocity_wrt_velocity()) + "}";
+}
+
+template<typename Frame>
+std::ostream& operator<<(
+    std::ostream& out,
+    StateTransitionMatrix<Frame> const& state_transition_matrix) {
+  out << DebugString(state_transition_matrix);
+  return out;
+}
+
+}  // namespace internal_state_transition_matrix
+}  // namespace physics
+}  // namespace principia
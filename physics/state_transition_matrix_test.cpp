@@ -0,0 +1,86 @@
+﻿
+#include "physics/state_transition_matrix.hpp"
+
+#include "geometry/frame.hpp"
+#include "geometry/grassmann.hpp"
+#include "geometry/r3x3_matrix.hpp"
+#include "gtest/gtest.h"
+#include "quantities/quantities.hpp"
+#include "quantities/si.hpp"
+#include "serialization/geometry.pb.h"
+#include "testing_utilities/almost_equals.hpp"
+
+namespace principia {
+namespace physics {
+namespace internal_state_transition_matrix {
+
+using geometry::Displacement;
+using geometry::Frame;
+using geometry::Velocity;
+using quantities::si::Metre;
+using quantities::si::Second;
+using testing_utilities::AlmostEquals;
+
+class StateTransitionMatrixTest : public ::testing::Test {
+ protected:
+  using World = Frame<serialization::Frame::TestTag,
+                      geometry::Inertial,
+                      geometry::Handedness::Right,
+                      serialization::Frame::TEST>;
+
+  StateTransitionMatrixTest()
+      : φ1_(R3x3Matrix<double>({1, 2, 3}, {4, 5, 6}, {7, 8, 10}),
+            R3x3Matrix<Time>({2 * Second, 0 * Second, 1 * Second},
+                             {0 * Second, 3 * Second, 0 * Second},
+                             {1 * Second, 0 * Second, 4 * Second}),
+            R3x3Matrix<Frequency>({0 / Second, 1 / Second, 0 / Second},
+                                  {-1 / Second, 0 / Second, 2 / Second},
+                                  {0 / Second, -2 / Second, 0 / Second}),
+            R3x3Matrix<double>({5, 0, 0}, {0, 6, 1}, {0, 1, 7})),
+        φ2_(R3x3Matrix<double>({1, 0, 0}, {0, 1, 0}, {0, 0, 1}),
+            R3x3Matrix<Time>({3 * Second, 0 * Second, 0 * Second},
+                             {0 * Second, 3 * Second, 0 * Second},
+                             {0 * Second, 0 * Second, 3 * Second}),
+            R3x3Matrix<Frequency>({0 / Second, 0 / Second, 1 / Second},
+                                  {0 / Second, 0 / Second, 0 / Second},
+                                  {1 / Second, 0 / Second, 0 / Second}),
+            R3x3Matrix<double>({1, 0, 0}, {0, 2, 0}, {0, 0, 1})),
+        δ_(Displacement<World>({1 * Metre, -2 * Metre, 3 * Metre}),
+           Velocity<World>({4 * Metre / Second,
+                            5 * Metre / Second,
+                            -6 * Metre / Second})) {}
+
+  StateTransitionMatrix<World> const φ1_;
+  StateTransitionMatrix<World> const φ2_;
+  RelativeDegreesOfFreedom<World> const δ_;
+};
+
+TEST_F(StateTransitionMatrixTest, Identity) {
+  StateTransitionMatrix<World> const identity;
+  EXPECT_EQ(δ_, identity(δ_));
+  EXPECT_EQ(φ1_(δ_), (identity * φ1_)(δ_));
+  EXPECT_EQ(φ1_(δ_), (φ1_ * identity)(δ_));
+}
+
+TEST_F(StateTransitionMatrixTest, Apply) {
+  RelativeDegreesOfFreedom<World> const φ1δ = φ1_(δ_);
+  EXPECT_EQ(Displacement<World>({(1 - 4 + 9 + 8 + 0 - 6) * Metre,
+                                 (4 - 10 + 18 + 0 + 15 + 0) * Metre,
+                                 (7 - 16 + 30 + 4 + 0 - 24) * Metre}),
+            φ1δ.displacement());
+  EXPECT_EQ(Velocity<World>({(0 - 2 + 0 + 20 + 0 + 0) * Metre / Second,
+                             (-1 + 0 + 6 + 0 + 30 - 6) * Metre / Second,
+                             (0 + 4 + 0 + 0 + 5 - 42) * Metre / Second}),
+            φ1δ.velocity());
+}
+
+TEST_F(StateTransitionMatrixTest, Composition) {
+  EXPECT_THAT((φ2_ * φ1_)(δ_).displacement(),
+              AlmostEquals(φ2_(φ1_(δ_)).displacement(), 0));
+  EXPECT_THAT((φ2_ * φ1_)(δ_).velocity(),
+              AlmostEquals(φ2_(φ1_(δ_)).velocity(), 0));
+}
+
+}  // namespace internal_state_transition_matrix
+}  // namespace physics
+}  // namespace principia
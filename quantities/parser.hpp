@@ -2,6 +2,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "quantities/quantities.hpp"
 
@@ -16,12 +17,22 @@ namespace internal_parser {
 //   product_unit        ⩴ exponentiation_unit [product_unit]
 //   exponentiation_unit ⩴ unit [^ exponent]
 //   exponent            ⩴ signed_integer
+// The units are looked up in a table built at compile time, and parsing does
+// not allocate.
 template<typename Q>
 Q ParseQuantity(std::string const& s);
 
+// Parses a unit according to the grammar |quotient_unit| above and returns it
+// as a quantity, e.g., |ParseUnit<Speed>("km/s") == Kilo(Metre) / Second|.
+// This may be evaluated at compile time, in which case an unsupported or
+// mismatched unit is a compilation error.
+template<typename Q>
+constexpr Q ParseUnit(std::string_view s);
+
 }  // namespace internal_parser
 
 using internal_parser::ParseQuantity;
+using internal_parser::ParseUnit;
 
 }  // namespace quantities
 }  // namespace principia
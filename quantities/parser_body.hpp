@@ -5,6 +5,8 @@
 
 #include <array>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "quantities/astronomy.hpp"
 #include "quantities/dimensions.hpp"
@@ -59,168 +61,201 @@ struct ExtractDimensions<Quantity<Dimensions<LengthExponent,
 
 struct Unit {
   template<typename Q>
-  explicit Unit(Q const& quantity);
+  constexpr explicit Unit(Q const& quantity);
 
-  Unit(RuntimeDimensions&& dimensions, double scale);
+  constexpr Unit(RuntimeDimensions const& dimensions, double scale);
 
   RuntimeDimensions dimensions;
   double scale;
 };
 
 template<typename Q>
-Unit::Unit(Q const& quantity)
+constexpr Unit::Unit(Q const& quantity)
     : dimensions(ExtractDimensions<Q>::dimensions()),
       scale(quantity / SIUnit<Q>()) {}
 
-inline Unit::Unit(RuntimeDimensions&& dimensions, double const scale)
+constexpr Unit::Unit(RuntimeDimensions const& dimensions, double const scale)
     : dimensions(dimensions),
       scale(scale) {}
 
-inline Unit operator*(Unit const& left, Unit const& right) {
-  RuntimeDimensions dimensions;
-  for (std::int64_t i = 0; i < dimensions.size(); ++i) {
+constexpr Unit operator*(Unit const& left, Unit const& right) {
+  RuntimeDimensions dimensions{};
+  for (std::size_t i = 0; i < dimensions.size(); ++i) {
     dimensions[i] = left.dimensions[i] + right.dimensions[i];
   }
-  return {std::move(dimensions), left.scale * right.scale};
+  return {dimensions, left.scale * right.scale};
 }
 
-inline Unit operator/(Unit const& left, Unit const& right) {
-  RuntimeDimensions dimensions;
-  for (std::int64_t i = 0; i < dimensions.size(); ++i) {
+constexpr Unit operator/(Unit const& left, Unit const& right) {
+  RuntimeDimensions dimensions{};
+  for (std::size_t i = 0; i < dimensions.size(); ++i) {
     dimensions[i] = left.dimensions[i] - right.dimensions[i];
   }
-  return {std::move(dimensions), left.scale / right.scale};
+  return {dimensions, left.scale / right.scale};
 }
 
-inline Unit operator^(Unit const& left, int const exponent) {
-  RuntimeDimensions dimensions;
-  for (std::int64_t i = 0; i < dimensions.size(); ++i) {
+constexpr Unit operator^(Unit const& left, int const exponent) {
+  RuntimeDimensions dimensions{};
+  for (std::size_t i = 0; i < dimensions.size(); ++i) {
     dimensions[i] = left.dimensions[i] * exponent;
   }
-  return {std::move(dimensions), std::pow(left.scale, exponent)};
+  double scale = 1;
+  for (int i = 0; i < (exponent < 0 ? -exponent : exponent); ++i) {
+    scale *= left.scale;
+  }
+  return {dimensions, exponent < 0 ? 1 / scale : scale};
 }
 
-inline Unit ParseUnit(std::string const& s) {
-  // Unitless quantities.
-  if (s == "") {
-    return Unit(1.0);
-  // Units of length.
-  } else if (s == u8"μm") {
-    return Unit(si::Micro(si::Metre));
-  } else if (s == "mm") {
-    return Unit(si::Milli(si::Metre));
-  } else if (s == "cm") {
-    return Unit(si::Centi(si::Metre));
-  } else if (s == "m") {
-    return Unit(si::Metre);
-  } else if (s == "km") {
-    return Unit(si::Kilo(si::Metre));
-  } else if (s == u8"R🜨") {
-    return Unit(astronomy::TerrestrialEquatorialRadius);
-  } else if (s == u8"R☉") {
-    return Unit(astronomy::SolarRadius);
-  } else if (s == "au") {
-    return Unit(astronomy::AstronomicalUnit);
-  // Units of mass.
-  } else if (s == "kg") {
-    return Unit(si::Kilogram);
-  // Units of time.
-  } else if (s == "ms") {
-    return Unit(si::Milli(si::Second));
-  } else if (s == "s") {
-    return Unit(si::Second);
-  } else if (s == "min") {
-    return Unit(si::Minute);
-  } else if (s == "h") {
-    return Unit(si::Hour);
-  } else if (s == "d") {
-    return Unit(si::Day);
-  // Units of gravitational parameter.
-  } else if (s == u8"GM🜨") {
-    return Unit(astronomy::TerrestrialGravitationalParameter);
-  } else if (s == u8"GM☉") {
-    return Unit(astronomy::SolarGravitationalParameter);
-  // Units of power.
-  } else if (s == "W") {
-    return Unit(si::Watt);
-  // Units of angle.
-  } else if (s == "deg" || s == u8"°") {
-    return Unit(si::Degree);
-  } else if (s == "rad") {
-    return Unit(si::Radian);
-  // Units of solid angle.
-  } else if (s == "sr") {
-    return Unit(si::Steradian);
-  } else {
-    LOG(FATAL) << "Unsupported unit " << s;
-    base::noreturn();
+// The units that may be combined by the grammar.
+inline constexpr std::array<std::pair<std::string_view, Unit>, 22> units{{
+    // Unitless quantities.
+    {"", Unit(1.0)},
+    // Units of length.
+    {u8"μm", Unit(si::Micro(si::Metre))},
+    {"mm", Unit(si::Milli(si::Metre))},
+    {"cm", Unit(si::Centi(si::Metre))},
+    {"m", Unit(si::Metre)},
+    {"km", Unit(si::Kilo(si::Metre))},
+    {u8"R🜨", Unit(astronomy::TerrestrialEquatorialRadius)},
+    {u8"R☉", Unit(astronomy::SolarRadius)},
+    {"au", Unit(astronomy::AstronomicalUnit)},
+    // Units of mass.
+    {"kg", Unit(si::Kilogram)},
+    // Units of time.
+    {"ms", Unit(si::Milli(si::Second))},
+    {"s", Unit(si::Second)},
+    {"min", Unit(si::Minute)},
+    {"h", Unit(si::Hour)},
+    {"d", Unit(si::Day)},
+    // Units of gravitational parameter.
+    {u8"GM🜨", Unit(astronomy::TerrestrialGravitationalParameter)},
+    {u8"GM☉", Unit(astronomy::SolarGravitationalParameter)},
+    // Units of power.
+    {"W", Unit(si::Watt)},
+    // Units of angle.
+    {"deg", Unit(si::Degree)},
+    {u8"°", Unit(si::Degree)},
+    {"rad", Unit(si::Radian)},
+    // Units of solid angle.
+    {"sr", Unit(si::Steradian)},
+}};
+
+// The following functions report errors.  They are not constexpr, so reaching
+// them during constant evaluation fails the compilation.
+
+inline Unit UnsupportedUnit(std::string_view const s) {
+  LOG(FATAL) << "Unsupported unit " << s;
+  base::noreturn();
+}
+
+inline int InvalidExponent(std::string_view const s) {
+  LOG(FATAL) << "invalid integer number " << s;
+  base::noreturn();
+}
+
+template<typename Q>
+Q IncompatibleUnit(std::string_view const s) {
+  LOG(FATAL) << "Incompatible unit " << s;
+  base::noreturn();
+}
+
+// Removes the leading and trailing blanks.
+constexpr std::string_view Trim(std::string_view const s) {
+  auto const first_nonblank = s.find_first_not_of(' ');
+  if (first_nonblank == std::string_view::npos) {
+    return std::string_view();
   }
+  auto const last_nonblank = s.find_last_not_of(' ');
+  return s.substr(first_nonblank, last_nonblank - first_nonblank + 1);
 }
 
-inline int ParseExponent(std::string const& s) {
-  // Parse an int.
-  char* interpreted_end;
-  char const* const c_string = s.c_str();
-  int const exponent = std::strtol(c_string, &interpreted_end, /*base=*/10);
-  int const interpreted = interpreted_end - c_string;
-  CHECK_LT(0, interpreted) << "invalid integer number " << s;
-  return exponent;
+constexpr Unit LookUpUnit(std::string_view const s) {
+  for (auto const& [name, unit] : units) {
+    if (name == s) {
+      return unit;
+    }
+  }
+  return UnsupportedUnit(s);
+}
+
+constexpr int ParseExponent(std::string_view const s) {
+  std::size_t i = 0;
+  bool negative = false;
+  if (i < s.size() && (s[i] == '+' || s[i] == '-')) {
+    negative = s[i] == '-';
+    ++i;
+  }
+  if (i == s.size()) {
+    return InvalidExponent(s);
+  }
+  int exponent = 0;
+  for (; i < s.size(); ++i) {
+    if (s[i] < '0' || s[i] > '9') {
+      return InvalidExponent(s);
+    }
+    exponent = 10 * exponent + (s[i] - '0');
+  }
+  return negative ? -exponent : exponent;
 }
 
-inline Unit ParseExponentiationUnit(std::string const& s) {
-  int const first_caret = s.find('^');
-  if (first_caret == std::string::npos) {
-    return ParseUnit(s);
+constexpr Unit ParseExponentiationUnit(std::string_view const s) {
+  auto const first_caret = s.find('^');
+  if (first_caret == std::string_view::npos) {
+    return LookUpUnit(s);
   } else {
-    int const first_nonblank = s.find_first_not_of(' ', first_caret + 1);
-    CHECK_NE(std::string::npos, first_nonblank);
-    int const last_nonblank = s.find_last_not_of(' ', first_caret - 1);
-    CHECK_NE(std::string::npos, last_nonblank);
-    auto const left = ParseUnit(s.substr(0, last_nonblank + 1));
-    auto const right = ParseExponent(s.substr(first_nonblank));
-    return left ^ right;
+    auto const left = Trim(s.substr(0, first_caret));
+    if (left.empty()) {
+      return UnsupportedUnit(s);
+    }
+    return LookUpUnit(left) ^ ParseExponent(Trim(s.substr(first_caret + 1)));
   }
 }
 
-inline Unit ParseProductUnit(std::string const& s) {
+constexpr Unit ParseProductUnit(std::string_view const s) {
   // For a product we are looking for a blank character that is not next to a
   // carret.
-  int first_blank;
-  int first_nonblank;
-  int last_nonblank;
-  for (int start = 0;; start = first_blank + 1) {
+  std::size_t first_blank = 0;
+  std::size_t first_nonblank = 0;
+  std::size_t last_nonblank = 0;
+  for (std::size_t start = 0;; start = first_blank + 1) {
     first_blank = s.find(' ', start);
-    if (first_blank == std::string::npos) {
+    if (first_blank == std::string_view::npos) {
       return ParseExponentiationUnit(s);
     } else {
       first_nonblank = s.find_first_not_of(' ', first_blank + 1);
-      last_nonblank = s.find_last_not_of(' ', first_blank - 1);
-      if ((first_nonblank == std::string::npos || s[first_nonblank] != '^') &&
-          (last_nonblank == std::string::npos || s[last_nonblank] != '^')) {
+      last_nonblank = first_blank == 0
+                          ? std::string_view::npos
+                          : s.find_last_not_of(' ', first_blank - 1);
+      if ((first_nonblank == std::string_view::npos ||
+           s[first_nonblank] != '^') &&
+          (last_nonblank == std::string_view::npos ||
+           s[last_nonblank] != '^')) {
         break;
       }
     }
   }
+  if (first_nonblank == std::string_view::npos) {
+    return ParseExponentiationUnit(Trim(s));
+  }
   auto const left = ParseExponentiationUnit(s.substr(0, last_nonblank + 1));
   auto const right = ParseProductUnit(s.substr(first_nonblank));
   return left * right;
 }
 
-inline Unit ParseQuotientUnit(std::string const& s) {
+constexpr Unit ParseQuotientUnit(std::string_view const s) {
   // Look for the slash from the back to achieve proper associativity.
-  int const last_slash = s.rfind('/');
-  if (last_slash == std::string::npos) {
+  auto const last_slash = s.rfind('/');
+  if (last_slash == std::string_view::npos) {
     // Not a quotient.
     return ParseProductUnit(s);
   } else {
     // A quotient.  Parse each half.
-    int const first_nonblank = s.find_first_not_of(' ', last_slash + 1);
-    CHECK_NE(std::string::npos, first_nonblank);
-    int const last_nonblank = s.find_last_not_of(' ', last_slash - 1);
-    CHECK_NE(std::string::npos, last_nonblank);
-    auto const left = ParseQuotientUnit(s.substr(0, last_nonblank + 1));
-    auto const right = ParseExponentiationUnit(s.substr(first_nonblank));
-    return left / right;
+    auto const left = Trim(s.substr(0, last_slash));
+    auto const right = Trim(s.substr(last_slash + 1));
+    if (left.empty() || right.empty()) {
+      return UnsupportedUnit(s);
+    }
+    return ParseQuotientUnit(left) / ParseExponentiationUnit(right);
   }
 }
 
@@ -233,17 +268,20 @@ Q ParseQuantity(std::string const& s) {
   int const interpreted = interpreted_end - c_string;
   CHECK_LT(0, interpreted) << "invalid floating-point number " << s;
 
-  // Locate the unit.  It may be empty for a double.
-  int const first_nonblank = s.find_first_not_of(' ', interpreted);
-  int const last_nonblank = s.find_last_not_of(' ');
-  std::string unit_string;
-  if (first_nonblank != std::string::npos) {
-    unit_string = s.substr(first_nonblank, last_nonblank - first_nonblank + 1);
-  }
+  // The unit may be empty for a double.
+  return magnitude * ParseUnit<Q>(std::string_view(s).substr(interpreted));
+}
 
-  Unit const unit = ParseQuotientUnit(unit_string);
-  CHECK(ExtractDimensions<Q>::dimensions() == unit.dimensions) << unit_string;
-  return magnitude * unit.scale * SIUnit<Q>();
+template<typename Q>
+constexpr Q ParseUnit(std::string_view const s) {
+  Unit const unit = ParseQuotientUnit(Trim(s));
+  constexpr RuntimeDimensions dimensions = ExtractDimensions<Q>::dimensions();
+  for (std::size_t i = 0; i < dimensions.size(); ++i) {
+    if (unit.dimensions[i] != dimensions[i]) {
+      return IncompatibleUnit<Q>(s);
+    }
+  }
+  return unit.scale * SIUnit<Q>();
 }
 
 }  // namespace internal_parser
@@ -72,6 +72,15 @@ TEST_F(ParserDeathTest, SpacesError) {
   }, "invalid integer");
 }
 
+TEST_F(ParserDeathTest, DimensionError) {
+  EXPECT_DEATH({
+    ParseQuantity<Length>("1.23 s");
+  }, "Incompatible unit");
+  EXPECT_DEATH({
+    ParseUnit<Speed>("km/s^2");
+  }, "Incompatible unit");
+}
+
 TEST_F(ParserDeathTest, UnitError) {
   EXPECT_DEATH({
     ParseQuantity<Length>("1.23 nm");
@@ -119,7 +128,7 @@ TEST_F(ParserTest, ParseGravitationalParameter) {
   EXPECT_EQ(1.23 * Pow<3>(Kilo(Metre)) / Pow<2>(Day),
             ParseQuantity<GravitationalParameter>("1.23 km^3/d^2"));
   EXPECT_THAT(ParseQuantity<GravitationalParameter>("1.23 au^3/d^2"),
-              AlmostEquals(1.23 * Pow<3>(AstronomicalUnit) / Pow<2>(Day), 2));
+              AlmostEquals(1.23 * Pow<3>(AstronomicalUnit) / Pow<2>(Day), 1));
 }
 
 TEST_F(ParserTest, ParseAcceleration) {
@@ -141,5 +150,19 @@ TEST_F(ParserTest, ParseRadiance) {
             ParseQuantity<Radiance>("1.23 W sr^-1 m^-2"));
 }
 
+TEST_F(ParserTest, ParseUnit) {
+  constexpr Speed kilometre_per_second = ParseUnit<Speed>("km/s");
+  static_assert(kilometre_per_second == Kilo(Metre) / Second, "");
+  constexpr GravitationalParameter kilometre³_per_day² =
+      ParseUnit<GravitationalParameter>("km^3 / d^2");
+  static_assert(kilometre³_per_day² == Pow<3>(Kilo(Metre)) / Pow<2>(Day), "");
+  constexpr AngularFrequency degree_per_day = ParseUnit<AngularFrequency>(
+      u8"° / d");
+  static_assert(degree_per_day == Degree / Day, "");
+  EXPECT_EQ(1.0, ParseUnit<double>(""));
+  EXPECT_EQ(Watt / (Steradian * Metre * Metre),
+            ParseUnit<Radiance>("W sr^-1 m^-2"));
+}
+
 }  // namespace quantities
 }  // namespace principia